@@ -0,0 +1,88 @@
+#!/bin/sh
+#
+# Previous benchmark - bench.sh
+#
+# Guest side of the benchmark suite. Install the directory of this script
+# as /usr/local/bench in the guest, compile the tools with
+#
+#   cc -O -o marker marker.c
+#   cc -O -o randio randio.c
+#   cc -O -o netget netget.c
+#
+# and add this line to the end of /etc/rc.local:
+#
+#   sh /usr/local/bench/bench.sh &
+#
+# The script runs each workload as a phase of the batch run and writes
+# DONE to the marker address at the end. If a workload fails, it writes
+# FAIL before DONE, and run.py reports the run as failed. It does nothing
+# unless the file /usr/local/bench/address holds the marker address used
+# by run.py.
+
+BENCH=/usr/local/bench
+ADDR=`cat $BENCH/address 2>/dev/null`
+[ -n "$ADDR" ] || exit 0
+cd $BENCH || exit 0
+
+phase() {
+	$BENCH/marker $ADDR "$1"
+}
+
+fail() {
+	echo "bench.sh: workload $1 failed" >&2
+	phase FAIL
+	# The marker is polled, FAIL must be seen before DONE replaces it
+	sleep 1
+	phase DONE
+	exit 1
+}
+
+# Let the login window come up
+sleep 10
+
+# CPU bound: compile the tools repeatedly
+phase CPU
+i=0
+while [ $i -lt 10 ]; do
+	cc -O -c -o /tmp/bench.o randio.c || fail CPU
+	cc -O -c -o /tmp/bench.o netget.c || fail CPU
+	i=`expr $i + 1`
+done
+rm -f /tmp/bench.o
+
+# Sequential disk I/O: write and read back 16 MB
+phase DSEQ
+dd if=/dev/zero of=/tmp/bench.dat bs=64k count=256 2>/dev/null || fail DSEQ
+sync
+dd if=/tmp/bench.dat of=/dev/null bs=64k 2>/dev/null || fail DSEQ
+
+# Random disk I/O on the same file
+phase DRND
+$BENCH/randio /tmp/bench.dat 4000 || fail DRND
+rm -f /tmp/bench.dat
+
+# Network: receive data from the host through slirp
+phase NET
+$BENCH/netget 10.0.2.2 `cat $BENCH/port 2>/dev/null || echo 5999` >/dev/null || fail NET
+
+# DSP: play a sound which needs sample rate conversion
+phase DSP
+if [ ! -f /tmp/bench.snd ]; then
+	sndconvert -s 22050 -o /tmp/bench.snd /NextLibrary/Sounds/Basso.snd || fail DSP
+fi
+i=0
+while [ $i -lt 20 ]; do
+	sndplay /tmp/bench.snd || fail DSP
+	i=`expr $i + 1`
+done
+
+# Display: fill and copy loop, done by the i860 on a NeXTdimension
+phase FILL
+pft < $BENCH/fill.ps > /tmp/bench.out 2>&1 || fail FILL
+if grep Error /tmp/bench.out >/dev/null; then
+	cat /tmp/bench.out >&2
+	fail FILL
+fi
+rm -f /tmp/bench.out
+
+phase DONE
@@ -0,0 +1,50 @@
+/*
+  Previous benchmark - marker.c
+
+  This file is distributed under the GNU Public License, version 2 or at
+  your option any later version. Read the file gpl.txt for details.
+
+  Write a phase name of up to four characters to the marker address of a
+  batch run. Runs as root inside the emulated machine:
+
+    marker <address> <name>
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+int main(int argc, char *argv[])
+{
+	unsigned long addr;
+	unsigned char tag[4];
+	int fd, len, i;
+
+	if (argc != 3)
+	{
+		fprintf(stderr, "usage: marker <address> <name>\n");
+		return 1;
+	}
+	addr = strtoul(argv[1], NULL, 0);
+	len = strlen(argv[2]);
+	for (i = 0; i < 4; i++)
+		tag[i] = i < len ? argv[2][i] : ' ';
+
+	fd = open("/dev/mem", O_WRONLY);
+	if (fd < 0)
+	{
+		perror("/dev/mem");
+		return 1;
+	}
+	/* The emulator reads the marker as one big endian long word */
+	if (lseek(fd, addr, SEEK_SET) < 0 || write(fd, tag, 4) != 4)
+	{
+		perror("marker");
+		close(fd);
+		return 1;
+	}
+	close(fd);
+	return 0;
+}
@@ -0,0 +1,50 @@
+/*
+  Previous benchmark - netget.c
+
+  This file is distributed under the GNU Public License, version 2 or at
+  your option any later version. Read the file gpl.txt for details.
+
+  Connect to a TCP port and read until the other side closes the
+  connection. With slirp the host is reachable as 10.0.2.2:
+
+    netget <address> <port>
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+
+int main(int argc, char *argv[])
+{
+	static char buf[16384];
+	struct sockaddr_in sin;
+	long total = 0;
+	int s, n;
+
+	if (argc != 3)
+	{
+		fprintf(stderr, "usage: netget <address> <port>\n");
+		return 1;
+	}
+	memset(&sin, 0, sizeof(sin));
+	sin.sin_family = AF_INET;
+	sin.sin_addr.s_addr = inet_addr(argv[1]);
+	sin.sin_port = htons(atoi(argv[2]));
+
+	s = socket(AF_INET, SOCK_STREAM, 0);
+	if (s < 0 || connect(s, (struct sockaddr *)&sin, sizeof(sin)) < 0)
+	{
+		perror("netget");
+		return 1;
+	}
+	while ((n = read(s, buf, sizeof(buf))) > 0)
+		total += n;
+	close(s);
+	printf("netget: %ld bytes\n", total);
+	return n < 0;
+}
@@ -0,0 +1,67 @@
+/*
+  Previous benchmark - randio.c
+
+  This file is distributed under the GNU Public License, version 2 or at
+  your option any later version. Read the file gpl.txt for details.
+
+  Read and rewrite random 8 kB blocks of a file. A fixed seed makes every
+  run access the same blocks:
+
+    randio <file> <count>
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#define BLOCK_SIZE  8192
+
+int main(int argc, char *argv[])
+{
+	static char buf[BLOCK_SIZE];
+	struct stat st;
+	long blocks, block;
+	int fd, count, i;
+
+	if (argc != 3)
+	{
+		fprintf(stderr, "usage: randio <file> <count>\n");
+		return 1;
+	}
+	count = atoi(argv[2]);
+	fd = open(argv[1], O_RDWR);
+	if (fd < 0 || fstat(fd, &st) < 0)
+	{
+		perror(argv[1]);
+		return 1;
+	}
+	blocks = st.st_size / BLOCK_SIZE;
+	if (blocks == 0)
+	{
+		fprintf(stderr, "randio: %s is too small\n", argv[1]);
+		return 1;
+	}
+
+	srandom(1);
+	for (i = 0; i < count; i++)
+	{
+		block = random() % blocks;
+		lseek(fd, block * BLOCK_SIZE, SEEK_SET);
+		if (read(fd, buf, BLOCK_SIZE) != BLOCK_SIZE)
+			break;
+		/* Every fourth access writes the block back */
+		if ((i & 3) == 0)
+		{
+			lseek(fd, block * BLOCK_SIZE, SEEK_SET);
+			buf[0]++;
+			if (write(fd, buf, BLOCK_SIZE) != BLOCK_SIZE)
+				break;
+		}
+	}
+	fsync(fd);
+	close(fd);
+	return i == count ? 0 : 1;
+}
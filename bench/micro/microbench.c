@@ -0,0 +1,796 @@
+/*
+  Previous micro benchmarks - microbench.c
+
+  This file is distributed under the GNU Public License, version 2 or at
+  your option any later version. Read the file gpl.txt for details.
+
+  Times single emulator components without booting a ROM: the 68030 and
+  68040 opcode handlers in the normal run loop, the 68030 MMU table walk,
+  memory write functions, the DSP, the i860, SoftFloat and the Reed-Solomon
+  codec of the MO drive. The DSP ALU kernel also compares its results with
+  a reference model, see microbench_dsp.c. The program is linked with all
+  emulator sources except main.c, which is replaced by the stubs below. The
+  machines use an empty ROM, the kernels write their own code and data to
+  guest memory.
+
+  Every kernel runs in batches until the given time has passed and reports
+  the host time per operation. The unit of an operation depends on the
+  kernel, e.g. one emulated instruction or one sector.
+*/
+const char MicroBench_fileid[] = "Previous microbench.c : " __DATE__ " " __TIME__;
+
+#include "main.h"
+#include "configuration.h"
+#include "paths.h"
+#include "m68000.h"
+#include "cycInt.h"
+#include "cpummu030.h"
+#include "dsp_core.h"
+#include "dsp_cpu.h"
+#include "softfloat.h"
+#include "rs.h"
+#include "microbench.h"
+
+#ifdef WIN32
+#define MICRO_EMPTY_ROM "NUL"
+#else
+#define MICRO_EMPTY_ROM "/dev/null"
+#endif
+
+#define MICRO_CODE      0x04000000  /* guest addresses, in the first memory bank */
+#define MICRO_DATA      0x04100000
+#define MICRO_STACK     0x04F00000
+
+#define MICRO_CPU_SLICE   1000000   /* CPU cycles per batch */
+#define MICRO_OP_REPEAT   256       /* copies of an opcode in the loop */
+#define MICRO_MMU_PAGES   1024      /* pages touched by the table walk */
+#define MICRO_MMU_TABLE_A 0x04100000
+#define MICRO_MMU_TABLE_B 0x04101000
+#define MICRO_DSP_STEPS   100000    /* DSP instructions per batch */
+#define MICRO_FP_VALUES   256
+
+#define MICRO_SECTOR_DATA 1024      /* MO sector sizes, see mo.c */
+#define MICRO_SECTOR_DISK 1296
+
+/* Stubs for the symbols of main.c */
+volatile int mainPauseEmulation;
+bool bQuitProgram = false;
+
+bool Main_PauseEmulation(bool visualize) { return false; }
+bool Main_UnPauseEmulation(void) { return false; }
+void Main_RequestQuit(void) { bQuitProgram = true; }
+void Main_WarpMouse(int x, int y) {}
+void Main_SetTitle(const char *title) {}
+void Main_SpeedReset(void) {}
+const char* Main_SpeedMsg(void) { return ""; }
+
+void Main_ThrottleInterrupt(void) {
+	CycInt_AcknowledgeInterrupt();
+}
+
+/* The event loop interrupt ends a batch of the CPU kernels */
+void Main_EventHandlerInterrupt(void) {
+	CycInt_AcknowledgeInterrupt();
+	M68000_Stop();
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Host time in seconds.
+ */
+static double Micro_Time(void)
+{
+	Uint64 nCounter = SDL_GetPerformanceCounter();
+
+	return (double)nCounter / SDL_GetPerformanceFrequency();
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Set up a machine with an empty ROM like Configuration_Apply does. The
+ * CPU tables are rebuilt if the CPU changes, memory is mapped again.
+ */
+static bool bCpuInit = false;
+
+static bool Micro_SetMachine(int nMachineType, bool bTurbo)
+{
+	const char *psError;
+
+	ConfigureParams.System.nMachineType = nMachineType;
+	ConfigureParams.System.bTurbo = bTurbo;
+	ConfigureParams.System.bColor = false;
+	Configuration_SetSystemDefaults();
+	ConfigureParams.System.bRealtime = false;
+	ConfigureParams.System.bMMU = true;
+	ConfigureParams.Rom.bUseCustomMac = false;
+	strcpy(ConfigureParams.Rom.szRom030FileName, MICRO_EMPTY_ROM);
+	strcpy(ConfigureParams.Rom.szRom040FileName, MICRO_EMPTY_ROM);
+	strcpy(ConfigureParams.Rom.szRomTurboFileName, MICRO_EMPTY_ROM);
+
+	if (!bCpuInit) {
+		M68000_Init();
+		bCpuInit = true;
+	}
+	M68000_CheckCpuSettings();
+
+	psError = memory_init(ConfigureParams.Memory.nMemoryBankSize);
+	if (psError) {
+		fprintf(stderr, "Error: %s\n", psError);
+		return false;
+	}
+	M68000_Reset(true);
+	CycInt_Reset();
+	return true;
+}
+
+
+/* ----------------------------------------------------------------------- */
+/* 68030 and 68040 CPU                                                      */
+/* ----------------------------------------------------------------------- */
+
+static const Uint16 MicroCpuLoop[] = {
+	0x41F9, 0x0410, 0x0000,     /* start: lea     $04100000,a0 */
+	0x43F9, 0x0420, 0x0000,     /*        lea     $04200000,a1 */
+	0x3E3C, 0x03FF,             /*        move.w  #1023,d7 */
+	0x2218,                     /* loop:  move.l  (a0)+,d1 */
+	0xD081,                     /*        add.l   d1,d0 */
+	0xC4C1,                     /*        mulu.w  d1,d2 */
+	0xB182,                     /*        eor.l   d0,d2 */
+	0x22C2,                     /*        move.l  d2,(a1)+ */
+	0x51CF, 0xFFF4,             /*        dbra    d7,loop */
+	0x60E0                      /*        bra.s   start */
+};
+
+/* Sets registers for the opcodes below, the loop starts after it */
+static const Uint16 MicroCpuPrologue[] = {
+	0x41F9, 0x0410, 0x0000,     /* lea      $04100000,a0 */
+	0x7003,                     /* moveq    #3,d0 */
+	0x7202,                     /* moveq    #2,d1 */
+	0x7405,                     /* moveq    #5,d2 */
+	0x7607,                     /* moveq    #7,d3 */
+	0xF200, 0x4000,             /* fmove.l  d0,fp0 */
+	0xF201, 0x4080              /* fmove.l  d1,fp1 */
+};
+
+typedef struct {
+	const char *name;
+	int nWords;
+	Uint16 nCode[4];
+} MICRO_OPCODE;
+
+static const MICRO_OPCODE MicroOpcodes[] = {
+	{ "nop",     1, { 0x4E71 } },                           /* nop */
+	{ "moveq",   1, { 0x7001 } },                           /* moveq #1,d0 */
+	{ "add",     1, { 0xD081 } },                           /* add.l d1,d0 */
+	{ "lsl",     1, { 0xE788 } },                           /* lsl.l #3,d0 */
+	{ "mulu",    1, { 0xC4C1 } },                           /* mulu.w d1,d2 */
+	{ "divu",    1, { 0x84C3 } },                           /* divu.w d3,d2 */
+	{ "load",    1, { 0x2210 } },                           /* move.l (a0),d1 */
+	{ "store",   1, { 0x2081 } },                           /* move.l d1,(a0) */
+	{ "fadd",    2, { 0xF200, 0x0422 } },                   /* fadd.x fp1,fp0 */
+	{ "fmuldiv", 4, { 0xF200, 0x0423, 0xF200, 0x0420 } },   /* fmul.x fp1,fp0; fdiv.x fp1,fp0 */
+	{ "fsqrt",   2, { 0xF200, 0x0404 } },                   /* fsqrt.x fp1,fp0 */
+	{ NULL }
+};
+
+static Uint32 nMicroCodeEnd;
+
+static void Micro_PutCode(Uint32 *pAddr, const Uint16 *pCode, int nWords)
+{
+	int i;
+
+	for (i = 0; i < nWords; i++, *pAddr += 2)
+		put_word(*pAddr, pCode[i]);
+}
+
+/**
+ * Start the CPU in supervisor mode with all interrupts masked.
+ */
+static void Micro_StartCpu(void)
+{
+	regs.s = 1;
+	regs.intmask = 7;
+	m68k_areg(regs, 7) = MICRO_STACK;
+	m68k_setpc(MICRO_CODE);
+}
+
+static bool Micro_CpuLoopSetup(int nMachineType)
+{
+	Uint32 nAddr = MICRO_CODE;
+	int i;
+
+	if (!Micro_SetMachine(nMachineType, false))
+		return false;
+
+	for (i = 0; i < 4096; i++)
+		put_long(MICRO_DATA + i * 4, (Uint32)i * 0x01010101);
+	Micro_PutCode(&nAddr, MicroCpuLoop, sizeof(MicroCpuLoop) / sizeof(Uint16));
+	nMicroCodeEnd = nAddr;
+	Micro_StartCpu();
+	return true;
+}
+
+static bool Micro_CpuOpSetup(int nMachineType, const MICRO_OPCODE *pOp)
+{
+	Uint32 nAddr = MICRO_CODE;
+	Uint32 nLoop;
+	Uint16 nBranch[2];
+	int i;
+
+	if (!Micro_SetMachine(nMachineType, false))
+		return false;
+
+	put_long(MICRO_DATA, 0x12345678);
+	Micro_PutCode(&nAddr, MicroCpuPrologue, sizeof(MicroCpuPrologue) / sizeof(Uint16));
+	nLoop = nAddr;
+	for (i = 0; i < MICRO_OP_REPEAT; i++)
+		Micro_PutCode(&nAddr, pOp->nCode, pOp->nWords);
+	nBranch[0] = 0x6000;                        /* bra.w loop */
+	nBranch[1] = nLoop - (nAddr + 2);
+	Micro_PutCode(&nAddr, nBranch, 2);
+	nMicroCodeEnd = nAddr;
+	Micro_StartCpu();
+	return true;
+}
+
+static Uint64 Micro_CpuRun(void)
+{
+	Uint64 nStart = nCpuInstructions;
+
+	CycInt_AddRelativeInterruptCycles(MICRO_CPU_SLICE, INTERRUPT_EVENT_LOOP);
+	M68000_Start();
+	return nCpuInstructions - nStart;
+}
+
+/* An exception would leave the code, e.g. for an unimplemented opcode */
+static bool Micro_CpuCheck(void)
+{
+	Uint32 pc = m68k_getpc();
+
+	return pc >= MICRO_CODE && pc < nMicroCodeEnd;
+}
+
+static bool Micro_Cpu030LoopSetup(void) { return Micro_CpuLoopSetup(NEXT_CUBE030); }
+static bool Micro_Cpu040LoopSetup(void) { return Micro_CpuLoopSetup(NEXT_CUBE040); }
+
+#define MICRO_CPU_OP(n) \
+	static bool Micro_Cpu030Op##n##Setup(void) { return Micro_CpuOpSetup(NEXT_CUBE030, &MicroOpcodes[n]); } \
+	static bool Micro_Cpu040Op##n##Setup(void) { return Micro_CpuOpSetup(NEXT_CUBE040, &MicroOpcodes[n]); }
+
+MICRO_CPU_OP(0)
+MICRO_CPU_OP(1)
+MICRO_CPU_OP(2)
+MICRO_CPU_OP(3)
+MICRO_CPU_OP(4)
+MICRO_CPU_OP(5)
+MICRO_CPU_OP(6)
+MICRO_CPU_OP(7)
+MICRO_CPU_OP(8)
+MICRO_CPU_OP(9)
+MICRO_CPU_OP(10)
+
+
+/* ----------------------------------------------------------------------- */
+/* 68030 MMU table walk                                                     */
+/* ----------------------------------------------------------------------- */
+
+static Uint32 nMicroMmuSum;
+
+/**
+ * Map the address space with two levels of 1024 entries and 4 kB pages.
+ * All entries of table A point to table B, which maps the first 4 MB of
+ * memory.
+ */
+static bool Micro_MmuSetup(void)
+{
+	int i;
+
+	if (!Micro_SetMachine(NEXT_CUBE030, false))
+		return false;
+
+	for (i = 0; i < 1024; i++) {
+		put_long(MICRO_MMU_TABLE_A + i * 4, MICRO_MMU_TABLE_B | 2);
+		put_long(MICRO_MMU_TABLE_B + i * 4, (MICRO_CODE + i * 4096) | 1);
+	}
+	tt0_030 = tt1_030 = 0;
+	crp_030 = ((uae_u64)0x7FFF0002 << 32) | MICRO_MMU_TABLE_A;
+	tc_030 = 0x80C0AA00;        /* enable, PS=4k, IS=0, TIA=10, TIB=10 */
+	if (mmu030_decode_rp(crp_030) || mmu030_decode_tc(tc_030))
+		return false;
+
+	nMicroMmuSum = 0;
+	return true;
+}
+
+/* Every access misses the ATC and walks the tables */
+static Uint64 Micro_MmuRun(void)
+{
+	Uint32 nAddr;
+	int i;
+
+	for (i = 0; i < MICRO_MMU_PAGES; i++) {
+		nAddr = ((Uint32)i << 22) | (((i * 7) & 1023) << 12) | ((i * 4) & 0xFFC);
+		mmu030_flush_atc_all();
+		nMicroMmuSum += mmu030_get_long(nAddr, 5);
+	}
+	return MICRO_MMU_PAGES;
+}
+
+static bool Micro_MmuCheck(void)
+{
+	/* The first data word of every page is its number times 4 */
+	return mmu030_get_long(0x00403000, 5) == get_long(MICRO_CODE + 3 * 4096);
+}
+
+static void Micro_MmuCleanup(void)
+{
+	tc_030 = 0;
+	mmu030_decode_tc(tc_030);
+	mmu030_flush_atc_all();
+}
+
+
+/* ----------------------------------------------------------------------- */
+/* Memory write functions of the non-Turbo monochrome machines              */
+/* ----------------------------------------------------------------------- */
+
+#define MICRO_MWF_LONGS 4096
+
+static bool Micro_MwfSetup(void)
+{
+	int i;
+
+	if (!Micro_SetMachine(NEXT_CUBE030, false))
+		return false;
+
+	for (i = 0; i < MICRO_MWF_LONGS; i++)
+		put_long(MICRO_DATA + i * 4, i * 0x00010001);
+	return true;
+}
+
+/* Write through the mirrors of functions 1 to 3 */
+static Uint64 Micro_MwfRun(void)
+{
+	Uint32 nAddr;
+	int i;
+
+	for (i = 0; i < MICRO_MWF_LONGS; i++) {
+		nAddr = 0x10000000 + ((i % 3) + 1) * 0x04000000 + (MICRO_DATA - MICRO_CODE) + i * 4;
+		put_long(nAddr, i * 0x9E3779B9);
+	}
+	return MICRO_MWF_LONGS;
+}
+
+/* Reference: the write functions of memory.c applied pixel by pixel */
+static const Uint8 MicroMwf[4][4][4] = {
+	{ { 0, 0, 0, 0 }, { 0, 0, 1, 1 }, { 0, 1, 1, 2 }, { 0, 1, 2, 3 } }, /* AB */
+	{ { 0, 1, 2, 3 }, { 1, 2, 3, 3 }, { 2, 3, 3, 3 }, { 3, 3, 3, 3 } }, /* ceil(A+B) */
+	{ { 0, 0, 0, 0 }, { 1, 1, 0, 0 }, { 2, 1, 1, 0 }, { 3, 2, 1, 0 } }, /* (1-A)B */
+	{ { 0, 1, 2, 3 }, { 1, 2, 2, 3 }, { 2, 2, 3, 3 }, { 3, 3, 3, 3 } }  /* A+B-AB */
+};
+
+static Uint32 Micro_MwfReference(Uint32 nOld, Uint32 nNew, int nFunction, int nSize)
+{
+	Uint32 v = 0;
+	int i;
+
+	for (i = 0; i < nSize * 4; i++)
+		v |= (Uint32)MicroMwf[nFunction][(nOld >> (i * 2)) & 3][(nNew >> (i * 2)) & 3] << (i * 2);
+	return v;
+}
+
+/**
+ * Write every combination of old and new byte through the mirrors of all
+ * four functions with all access sizes. The bytes of a word or long use
+ * different offsets, so each byte lane sees all combinations as well.
+ */
+static bool Micro_MwfCheck(void)
+{
+	const Uint32 nData = MICRO_DATA + MICRO_MWF_LONGS * 4;
+	Uint32 nOld, nNew, nResult, nAddr;
+	int nFunction, nSize, nErrors = 0;
+	int a, b, k;
+
+	for (nFunction = 0; nFunction < 4; nFunction++) {
+		nAddr = 0x10000000 + nFunction * 0x04000000 + (nData - MICRO_CODE);
+		for (nSize = 1; nSize <= 4; nSize *= 2) {
+			for (a = 0; a < 256; a++) {
+				for (b = 0; b < 256; b++) {
+					nOld = nNew = 0;
+					for (k = 0; k < nSize; k++) {
+						nOld |= (Uint32)((a + k * 0x55) & 0xFF) << (k * 8);
+						nNew |= (Uint32)((b + k * 0x33) & 0xFF) << (k * 8);
+					}
+					switch (nSize) {
+					case 1:
+						put_byte(nData, nOld);
+						put_byte(nAddr, nNew);
+						nResult = get_byte(nData);
+						break;
+					case 2:
+						put_word(nData, nOld);
+						put_word(nAddr, nNew);
+						nResult = get_word(nData);
+						break;
+					default:
+						put_long(nData, nOld);
+						put_long(nAddr, nNew);
+						nResult = get_long(nData);
+						break;
+					}
+					if (nResult != Micro_MwfReference(nOld, nNew, nFunction, nSize) &&
+					    nErrors++ < 10) {
+						fprintf(stderr, "memory.mwf: function %d, size %d: old=%08x new=%08x "
+						        "result=%08x expected=%08x\n", nFunction, nSize, nOld, nNew,
+						        nResult, Micro_MwfReference(nOld, nNew, nFunction, nSize));
+					}
+				}
+			}
+		}
+	}
+	return nErrors == 0;
+}
+
+
+/* ----------------------------------------------------------------------- */
+/* DSP56001                                                                 */
+/* ----------------------------------------------------------------------- */
+
+static const Uint32 MicroDspLoop[] = {
+	0x300000,               /* move  #$00,r0 */
+	0x340000,               /* move  #$00,r4 */
+	0x05FFA0,               /* movec #$ff,m0 */
+	0x05FFA4,               /* movec #$ff,m4 */
+	0x060081, 0x000006,     /* do    #$0100,p:$0006 */
+	0xF098D2,               /* mac   +y0,x0,a x:(r0)+,x0 y:(r4)+,y0 */
+	0x0C0000                /* jmp   p:$0000 */
+};
+
+static void Micro_DspHostInterrupt(int set) {}
+
+static bool Micro_DspSetup(void)
+{
+	int i;
+
+	dsp_core_init(Micro_DspHostInterrupt);
+	dsp_core_reset();
+	dsp_core_start(0);
+
+	for (i = 0; i < 256; i++) {
+		dsp_core.ramint[DSP_SPACE_X][i] = (i * 0x010203) & 0xFFFFFF;
+		dsp_core.ramint[DSP_SPACE_Y][i] = (i * 0x030201) & 0xFFFFFF;
+	}
+	for (i = 0; i < (int)(sizeof(MicroDspLoop) / sizeof(Uint32)); i++)
+		dsp_core.ramint[DSP_SPACE_P][i] = MicroDspLoop[i];
+	return true;
+}
+
+static Uint64 Micro_DspRun(void)
+{
+	int i;
+
+	for (i = 0; i < MICRO_DSP_STEPS; i++)
+		dsp56k_execute_instruction();
+	return MICRO_DSP_STEPS;
+}
+
+static bool Micro_DspCheck(void)
+{
+	return dsp_core.pc < sizeof(MicroDspLoop) / sizeof(Uint32) &&
+	       (dsp_core.registers[DSP_REG_A1] || dsp_core.registers[DSP_REG_A0]);
+}
+
+
+/* ----------------------------------------------------------------------- */
+/* SoftFloat                                                                */
+/* ----------------------------------------------------------------------- */
+
+static float_ctrl MicroFpCtrl;
+static floatx80 MicroFpValues[MICRO_FP_VALUES];
+static floatx80 MicroFpResult;
+
+static bool Micro_FpSetup(void)
+{
+	int i;
+
+	float_init(&MicroFpCtrl);
+	for (i = 0; i < MICRO_FP_VALUES; i++) {
+		/* Positive values between 1 and 2, with all mantissa bits used */
+		MicroFpValues[i] = floatx80_div(int32_to_floatx80(i * 7919 + 65537),
+		                                int32_to_floatx80(65536), &MicroFpCtrl);
+	}
+	return true;
+}
+
+static bool Micro_FpCheck(void)
+{
+	return !floatx80_is_nan(MicroFpResult);
+}
+
+#define MICRO_FP_BINARY(op) \
+	static Uint64 Micro_Fp_##op(void) { \
+		int i; \
+		for (i = 0; i < MICRO_FP_VALUES - 1; i++) \
+			MicroFpResult = floatx80_##op(MicroFpValues[i], MicroFpValues[i + 1], &MicroFpCtrl); \
+		return MICRO_FP_VALUES - 1; \
+	}
+
+#define MICRO_FP_UNARY(op) \
+	static Uint64 Micro_Fp_##op(void) { \
+		int i; \
+		for (i = 0; i < MICRO_FP_VALUES; i++) \
+			MicroFpResult = floatx80_##op(MicroFpValues[i], &MicroFpCtrl); \
+		return MICRO_FP_VALUES; \
+	}
+
+MICRO_FP_BINARY(add)
+MICRO_FP_BINARY(mul)
+MICRO_FP_BINARY(div)
+MICRO_FP_UNARY(sqrt)
+MICRO_FP_UNARY(sin)
+MICRO_FP_UNARY(logn)
+
+
+/* ----------------------------------------------------------------------- */
+/* Reed-Solomon codec of the MO drive                                       */
+/* ----------------------------------------------------------------------- */
+
+static Uint8 MicroSectorData[MICRO_SECTOR_DISK];
+static Uint8 MicroSectorCoded[MICRO_SECTOR_DISK];
+static Uint8 MicroSector[MICRO_SECTOR_DISK];
+static int nMicroRsErrors;
+
+static bool Micro_RsSetup(void)
+{
+	int i;
+
+	for (i = 0; i < MICRO_SECTOR_DATA; i++)
+		MicroSectorData[i] = (i * 167 + 13) & 0xFF;
+	memcpy(MicroSectorCoded, MicroSectorData, sizeof(MicroSectorCoded));
+	rs_encode(MicroSectorCoded);
+	return true;
+}
+
+static Uint64 Micro_RsEncode(void)
+{
+	memcpy(MicroSector, MicroSectorData, sizeof(MicroSector));
+	rs_encode(MicroSector);
+	return 1;
+}
+
+static Uint64 Micro_RsDecode(void)
+{
+	memcpy(MicroSector, MicroSectorCoded, sizeof(MicroSector));
+	nMicroRsErrors = rs_decode(MicroSector);
+	return 1;
+}
+
+/* Corrects one byte in each of 16 rows */
+static Uint64 Micro_RsCorrect(void)
+{
+	int i;
+
+	memcpy(MicroSector, MicroSectorCoded, sizeof(MicroSector));
+	for (i = 0; i < 16; i++)
+		MicroSector[i * 36 * 2 + i] ^= 0x5A;
+	nMicroRsErrors = rs_decode(MicroSector);
+	return 1;
+}
+
+static bool Micro_RsCheck(void)
+{
+	return nMicroRsErrors >= 0 && !memcmp(MicroSector, MicroSectorData, MICRO_SECTOR_DATA);
+}
+
+
+/* ----------------------------------------------------------------------- */
+
+static const MICRO_KERNEL MicroKernels[] = {
+	{ "cpu030.loop",      "insn",   Micro_Cpu030LoopSetup, Micro_CpuRun, Micro_CpuCheck, NULL },
+	{ "cpu030.nop",       "insn",   Micro_Cpu030Op0Setup,  Micro_CpuRun, Micro_CpuCheck, NULL },
+	{ "cpu030.moveq",     "insn",   Micro_Cpu030Op1Setup,  Micro_CpuRun, Micro_CpuCheck, NULL },
+	{ "cpu030.add",       "insn",   Micro_Cpu030Op2Setup,  Micro_CpuRun, Micro_CpuCheck, NULL },
+	{ "cpu030.lsl",       "insn",   Micro_Cpu030Op3Setup,  Micro_CpuRun, Micro_CpuCheck, NULL },
+	{ "cpu030.mulu",      "insn",   Micro_Cpu030Op4Setup,  Micro_CpuRun, Micro_CpuCheck, NULL },
+	{ "cpu030.divu",      "insn",   Micro_Cpu030Op5Setup,  Micro_CpuRun, Micro_CpuCheck, NULL },
+	{ "cpu030.load",      "insn",   Micro_Cpu030Op6Setup,  Micro_CpuRun, Micro_CpuCheck, NULL },
+	{ "cpu030.store",     "insn",   Micro_Cpu030Op7Setup,  Micro_CpuRun, Micro_CpuCheck, NULL },
+	{ "cpu030.fadd",      "insn",   Micro_Cpu030Op8Setup,  Micro_CpuRun, Micro_CpuCheck, NULL },
+	{ "cpu030.fmuldiv",   "insn",   Micro_Cpu030Op9Setup,  Micro_CpuRun, Micro_CpuCheck, NULL },
+	{ "cpu030.fsqrt",     "insn",   Micro_Cpu030Op10Setup, Micro_CpuRun, Micro_CpuCheck, NULL },
+	{ "cpu040.loop",      "insn",   Micro_Cpu040LoopSetup, Micro_CpuRun, Micro_CpuCheck, NULL },
+	{ "cpu040.nop",       "insn",   Micro_Cpu040Op0Setup,  Micro_CpuRun, Micro_CpuCheck, NULL },
+	{ "cpu040.moveq",     "insn",   Micro_Cpu040Op1Setup,  Micro_CpuRun, Micro_CpuCheck, NULL },
+	{ "cpu040.add",       "insn",   Micro_Cpu040Op2Setup,  Micro_CpuRun, Micro_CpuCheck, NULL },
+	{ "cpu040.lsl",       "insn",   Micro_Cpu040Op3Setup,  Micro_CpuRun, Micro_CpuCheck, NULL },
+	{ "cpu040.mulu",      "insn",   Micro_Cpu040Op4Setup,  Micro_CpuRun, Micro_CpuCheck, NULL },
+	{ "cpu040.divu",      "insn",   Micro_Cpu040Op5Setup,  Micro_CpuRun, Micro_CpuCheck, NULL },
+	{ "cpu040.load",      "insn",   Micro_Cpu040Op6Setup,  Micro_CpuRun, Micro_CpuCheck, NULL },
+	{ "cpu040.store",     "insn",   Micro_Cpu040Op7Setup,  Micro_CpuRun, Micro_CpuCheck, NULL },
+	{ "cpu040.fadd",      "insn",   Micro_Cpu040Op8Setup,  Micro_CpuRun, Micro_CpuCheck, NULL },
+	{ "cpu040.fmuldiv",   "insn",   Micro_Cpu040Op9Setup,  Micro_CpuRun, Micro_CpuCheck, NULL },
+	{ "cpu040.fsqrt",     "insn",   Micro_Cpu040Op10Setup, Micro_CpuRun, Micro_CpuCheck, NULL },
+	{ "mmu030.walk",      "walk",   Micro_MmuSetup,        Micro_MmuRun, Micro_MmuCheck, Micro_MmuCleanup },
+	{ "memory.mwf",       "long",   Micro_MwfSetup,        Micro_MwfRun, Micro_MwfCheck, NULL },
+	{ "dsp.mac",          "insn",   Micro_DspSetup,        Micro_DspRun, Micro_DspCheck, NULL },
+	{ "dsp.alu",          "case",   Micro_DspAluSetup,     Micro_DspAluRun, Micro_DspAluCheck, NULL },
+	{ "softfloat.add",    "op",     Micro_FpSetup,         Micro_Fp_add, Micro_FpCheck,  NULL },
+	{ "softfloat.mul",    "op",     Micro_FpSetup,         Micro_Fp_mul, Micro_FpCheck,  NULL },
+	{ "softfloat.div",    "op",     Micro_FpSetup,         Micro_Fp_div, Micro_FpCheck,  NULL },
+	{ "softfloat.sqrt",   "op",     Micro_FpSetup,         Micro_Fp_sqrt, Micro_FpCheck, NULL },
+	{ "softfloat.sin",    "op",     Micro_FpSetup,         Micro_Fp_sin, Micro_FpCheck,  NULL },
+	{ "softfloat.logn",   "op",     Micro_FpSetup,         Micro_Fp_logn, Micro_FpCheck, NULL },
+	{ "fpu.hostpath",     "op",     Micro_FpuSetup,        Micro_FpuRun, Micro_FpuCheck, NULL },
+	{ "rs.encode",        "sector", Micro_RsSetup,         Micro_RsEncode, NULL,         NULL },
+	{ "rs.decode",        "sector", Micro_RsSetup,         Micro_RsDecode, Micro_RsCheck, NULL },
+	{ "rs.correct",       "sector", Micro_RsSetup,         Micro_RsCorrect, Micro_RsCheck, NULL },
+	{ "i860.fzchk",       "op",     Micro_FzchkSetup,      Micro_FzchkRun, Micro_FzchkCheck, NULL },
+	/* Last, the NeXTdimension board stays registered for the i860 */
+	{ "i860.loop",        "cycle",  Micro_I860Setup,       Micro_I860Run, Micro_I860Check, Micro_I860Cleanup },
+	{ NULL }
+};
+
+
+/* ----------------------------------------------------------------------- */
+
+typedef struct {
+	const MICRO_KERNEL *pKernel;
+	Uint64 nOps;
+	double dSeconds;
+	const char *psStatus;
+} MICRO_RESULT;
+
+static MICRO_RESULT MicroResults[sizeof(MicroKernels) / sizeof(MICRO_KERNEL)];
+static int nMicroResults;
+
+/**
+ * Run one kernel in batches for at least dMinTime seconds, after one
+ * batch for warming up caches.
+ */
+static void Micro_RunKernel(const MICRO_KERNEL *pKernel, double dMinTime)
+{
+	MICRO_RESULT *pResult = &MicroResults[nMicroResults++];
+	double dStart;
+
+	pResult->pKernel = pKernel;
+	pResult->nOps = 0;
+	pResult->dSeconds = 0;
+	pResult->psStatus = "ok";
+
+	if (pKernel->setup && !pKernel->setup()) {
+		pResult->psStatus = "skipped";
+	} else {
+		pKernel->run();
+		dStart = Micro_Time();
+		do {
+			pResult->nOps += pKernel->run();
+			pResult->dSeconds = Micro_Time() - dStart;
+		} while (pResult->dSeconds < dMinTime);
+
+		if (pKernel->check && !pKernel->check())
+			pResult->psStatus = "failed";
+		if (pKernel->cleanup)
+			pKernel->cleanup();
+	}
+
+}
+
+
+/**
+ * Print all results as a table. The CPU core logs to stdout while the
+ * kernels are set up, so the table is printed after the last kernel.
+ */
+static void Micro_PrintResults(void)
+{
+	MICRO_RESULT *pResult;
+	int i;
+
+	printf("\n%-20s %12s %-9s %14s  %s\n", "kernel", "time", "", "operations", "status");
+	for (i = 0; i < nMicroResults; i++) {
+		pResult = &MicroResults[i];
+		if (pResult->nOps)
+			printf("%-20s %12.2f ns/%-6s %14"FMT_ll"u  %s\n", pResult->pKernel->name,
+			       pResult->dSeconds * 1e9 / pResult->nOps, pResult->pKernel->unit,
+			       (unsigned long long)pResult->nOps, pResult->psStatus);
+		else
+			printf("%-20s %12s %-9s %14s  %s\n", pResult->pKernel->name, "-", "", "-",
+			       pResult->psStatus);
+	}
+}
+
+
+/**
+ * Write all results as JSON.
+ */
+static bool Micro_WriteJson(const char *psFileName, double dMinTime)
+{
+	FILE *fp;
+	int i;
+
+	fp = fopen(psFileName, "w");
+	if (!fp) {
+		fprintf(stderr, "Error: Can not write %s\n", psFileName);
+		return false;
+	}
+	fprintf(fp, "{\n  \"suite\": \"previous-microbench\",\n  \"min_seconds\": %.3f,\n  \"kernels\": [", dMinTime);
+	for (i = 0; i < nMicroResults; i++) {
+		fprintf(fp, "%s\n    {\"name\": \"%s\", \"unit\": \"%s\", \"status\": \"%s\", "
+		        "\"ops\": %"FMT_ll"u, \"seconds\": %.6f, \"ns_per_op\": %.3f}",
+		        i ? "," : "", MicroResults[i].pKernel->name, MicroResults[i].pKernel->unit,
+		        MicroResults[i].psStatus, (unsigned long long)MicroResults[i].nOps, MicroResults[i].dSeconds,
+		        MicroResults[i].nOps ? MicroResults[i].dSeconds * 1e9 / MicroResults[i].nOps : 0.0);
+	}
+	fprintf(fp, "\n  ]\n}\n");
+	fclose(fp);
+	return true;
+}
+
+
+static void Micro_ShowHelp(void)
+{
+	printf("Usage:\n microbench [options]\n\nOptions:\n"
+	       "  -h, --help              Print this help text and exit\n"
+	       "  -l, --list              List the kernels and exit\n"
+	       "  -f, --filter <string>   Run only kernels whose name contains <string>\n"
+	       "  -t, --time <seconds>    Minimum time per kernel (default 0.5)\n"
+	       "  -j, --json <file>       Write the results to <file> in JSON format\n"
+	       "\nThe exit status is 1 if a kernel did not execute its code.\n");
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Main
+ */
+int main(int argc, char *argv[])
+{
+	const MICRO_KERNEL *pKernel;
+	const char *psFilter = NULL;
+	const char *psJson = NULL;
+	double dMinTime = 0.5;
+	int i, nFailed = 0;
+
+	for (i = 1; i < argc; i++) {
+		if (!strcmp(argv[i], "-h") || !strcmp(argv[i], "--help")) {
+			Micro_ShowHelp();
+			return 0;
+		} else if (!strcmp(argv[i], "-l") || !strcmp(argv[i], "--list")) {
+			for (pKernel = MicroKernels; pKernel->name; pKernel++)
+				printf("%s\n", pKernel->name);
+			return 0;
+		} else if ((!strcmp(argv[i], "-f") || !strcmp(argv[i], "--filter")) && i + 1 < argc) {
+			psFilter = argv[++i];
+		} else if ((!strcmp(argv[i], "-t") || !strcmp(argv[i], "--time")) && i + 1 < argc) {
+			dMinTime = atof(argv[++i]);
+		} else if ((!strcmp(argv[i], "-j") || !strcmp(argv[i], "--json")) && i + 1 < argc) {
+			psJson = argv[++i];
+		} else {
+			fprintf(stderr, "Error: Invalid option '%s'\nUse --help to list the available options.\n", argv[i]);
+			return 1;
+		}
+	}
+
+	Paths_Init(argv[0]);
+	Configuration_SetDefault();
+
+	for (pKernel = MicroKernels; pKernel->name; pKernel++) {
+		if (psFilter && !strstr(pKernel->name, psFilter))
+			continue;
+		fprintf(stderr, "Running %s ...\n", pKernel->name);
+		Micro_RunKernel(pKernel, dMinTime);
+	}
+
+	Micro_PrintResults();
+	for (i = 0; i < nMicroResults; i++) {
+		if (!strcmp(MicroResults[i].psStatus, "failed")) {
+			fprintf(stderr, "Error: %s did not execute its code\n", MicroResults[i].pKernel->name);
+			nFailed++;
+		}
+	}
+	if (psJson && !Micro_WriteJson(psJson, dMinTime))
+		return 1;
+
+	return nFailed ? 1 : 0;
+}
@@ -0,0 +1,49 @@
+/*
+  Previous micro benchmarks - microbench.h
+
+  This file is distributed under the GNU Public License, version 2 or at
+  your option any later version. Read the file gpl.txt for details.
+*/
+
+#ifndef PREV_MICROBENCH_H
+#define PREV_MICROBENCH_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/* One benchmark kernel. Setup returns false if the kernel can not run on
+ * this host, run executes one batch and returns the number of operations
+ * done, check returns false if the results show that the kernel did not
+ * execute the intended code. */
+typedef struct {
+	const char *name;
+	const char *unit;
+	bool   (*setup)(void);
+	Uint64 (*run)(void);
+	bool   (*check)(void);
+	void   (*cleanup)(void);
+} MICRO_KERNEL;
+
+extern bool   Micro_DspAluSetup(void);
+extern Uint64 Micro_DspAluRun(void);
+extern bool   Micro_DspAluCheck(void);
+
+extern bool   Micro_FpuSetup(void);
+extern Uint64 Micro_FpuRun(void);
+extern bool   Micro_FpuCheck(void);
+
+extern bool   Micro_I860Setup(void);
+extern Uint64 Micro_I860Run(void);
+extern bool   Micro_I860Check(void);
+extern void   Micro_I860Cleanup(void);
+
+extern bool   Micro_FzchkSetup(void);
+extern Uint64 Micro_FzchkRun(void);
+extern bool   Micro_FzchkCheck(void);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* PREV_MICROBENCH_H */
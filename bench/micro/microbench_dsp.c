@@ -0,0 +1,630 @@
+/*
+  Previous micro benchmarks - microbench_dsp.c
+
+  This file is distributed under the GNU Public License, version 2 or at
+  your option any later version. Read the file gpl.txt for details.
+
+  Check kernel for the 56-bit ALU of the DSP. Every case executes one ALU
+  instruction without parallel move on the DSP core, with random and edge
+  case values in the data ALU registers and random condition codes and
+  scaling mode. The same instruction is computed by a reference model made
+  of the former implementation of dsp_cpu.c, which handled accumulators as
+  three separate words. Any difference in the accumulators or in SR fails
+  the check.
+*/
+const char MicroBenchDsp_fileid[] = "Previous microbench_dsp.c : " __DATE__ " " __TIME__;
+
+#include "main.h"
+#include "dsp_core.h"
+#include "dsp_cpu.h"
+#include "microbench.h"
+
+#define MICRO_ALU_CASES   10000     /* cases per batch */
+#define MICRO_ALU_REPORT  10        /* differences printed */
+
+#define SIGN_PLUS  0
+#define SIGN_MINUS 1
+
+/* Operations of the reference model */
+enum {
+	REF_NONE,
+	REF_ADD, REF_ADC, REF_ADDL, REF_ADDR,
+	REF_SUB, REF_SBC, REF_SUBL, REF_SUBR,
+	REF_CMP, REF_CMPM, REF_TST, REF_RND,
+	REF_ASL, REF_ASR, REF_ABS, REF_NEG,
+	REF_MUL
+};
+
+static const Uint8 MicroAluKinds[5][8] = {
+	/* 0x00 - 0x0f */
+	{ REF_NONE, REF_NONE, REF_ADDR, REF_TST,  REF_NONE, REF_CMP,  REF_SUBR, REF_CMPM },
+	/* 0x10 - 0x1f */
+	{ REF_ADD,  REF_RND,  REF_ADDL, REF_NONE, REF_SUB,  REF_NONE, REF_SUBL, REF_NONE },
+	/* 0x20 - 0x2f */
+	{ REF_ADD,  REF_ADC,  REF_ASR,  REF_NONE, REF_SUB,  REF_SBC,  REF_ABS,  REF_NONE },
+	/* 0x30 - 0x3f */
+	{ REF_ADD,  REF_ADC,  REF_ASL,  REF_NONE, REF_SUB,  REF_SBC,  REF_NEG,  REF_NONE },
+	/* 0x40 - 0x7f */
+	{ REF_ADD,  REF_NONE, REF_NONE, REF_NONE, REF_SUB,  REF_CMP,  REF_NONE, REF_CMPM }
+};
+
+/* Sources of the 24 bits operands in 0x40 - 0x7f and of the multiplications */
+static const int MicroAluSource[4] = { DSP_REG_X0, DSP_REG_Y0, DSP_REG_X1, DSP_REG_Y1 };
+static const int MicroAluMul[8][2] = {
+	{ DSP_REG_X0, DSP_REG_X0 }, { DSP_REG_Y0, DSP_REG_Y0 },
+	{ DSP_REG_X1, DSP_REG_X0 }, { DSP_REG_Y1, DSP_REG_Y0 },
+	{ DSP_REG_X0, DSP_REG_Y1 }, { DSP_REG_Y0, DSP_REG_X0 },
+	{ DSP_REG_X1, DSP_REG_Y0 }, { DSP_REG_Y1, DSP_REG_X1 }
+};
+
+static const Uint32 MicroAluEdge24[] = {
+	0x000000, 0x000001, 0x400000, 0x7FFFFF, 0x800000, 0x800001, 0xC00000, 0xFFFFFF
+};
+static const Uint32 MicroAluEdge8[] = {
+	0x00, 0x01, 0x3F, 0x7F, 0x80, 0x81, 0xC0, 0xFF
+};
+
+static Uint8  MicroAluOps[256];
+static int    nMicroAluOps;
+static Uint64 nMicroAluSeed;
+static Uint64 nMicroAluErrors;
+
+/* Registers of the reference model */
+static Uint32 ref[64];
+
+
+/* ----------------------------------------------------------------------- */
+/* Reference model                                                          */
+/* ----------------------------------------------------------------------- */
+
+/* source,dest[0] is 55:48 */
+/* source,dest[1] is 47:24 */
+/* source,dest[2] is 23:00 */
+
+static Uint16 ref_sub56(Uint32 *source, Uint32 *dest);
+
+static Uint16 ref_abs56(Uint32 *dest)
+{
+	Uint32 zerodest[3];
+	Uint16 newsr;
+
+	/* D=|D| */
+
+	if (dest[0] & (1<<7)) {
+		zerodest[0] = zerodest[1] = zerodest[2] = 0;
+
+		newsr = ref_sub56(dest, zerodest);
+
+		dest[0] = zerodest[0];
+		dest[1] = zerodest[1];
+		dest[2] = zerodest[2];
+	} else {
+		newsr = 0;
+	}
+
+	return newsr;
+}
+
+static Uint16 ref_asl56(Uint32 *dest)
+{
+	Uint16 overflow, carry;
+
+	/* Shift left dest 1 bit: D<<=1 */
+
+	carry = (dest[0]>>7) & 1;
+
+	dest[0] <<= 1;
+	dest[0] |= (dest[1]>>23) & 1;
+	dest[0] &= BITMASK(8);
+
+	dest[1] <<= 1;
+	dest[1] |= (dest[2]>>23) & 1;
+	dest[1] &= BITMASK(24);
+
+	dest[2] <<= 1;
+	dest[2] &= BITMASK(24);
+
+	overflow = (carry != ((dest[0]>>7) & 1));
+
+	return (overflow<<DSP_SR_L)|(overflow<<DSP_SR_V)|(carry<<DSP_SR_C);
+}
+
+static Uint16 ref_asr56(Uint32 *dest)
+{
+	Uint16 carry;
+
+	/* Shift right dest 1 bit: D>>=1 */
+
+	carry = dest[2] & 1;
+
+	dest[2] >>= 1;
+	dest[2] |= (dest[1] & 1)<<23;
+
+	dest[1] >>= 1;
+	dest[1] |= (dest[0] & 1)<<23;
+
+	dest[0] >>= 1;
+	dest[0] |= (dest[0] & (1<<6))<<1;
+
+	return (carry<<DSP_SR_C);
+}
+
+static Uint16 ref_add56(Uint32 *source, Uint32 *dest)
+{
+	Uint16 overflow, carry, flg_s, flg_d, flg_r;
+
+	flg_s = (source[0]>>7) & 1;
+	flg_d = (dest[0]>>7) & 1;
+
+	/* Add source to dest: D = D+S */
+	dest[2] += source[2];
+	dest[1] += source[1]+((dest[2]>>24) & 1);
+	dest[0] += source[0]+((dest[1]>>24) & 1);
+
+	carry = (dest[0]>>8) & 1;
+
+	dest[2] &= BITMASK(24);
+	dest[1] &= BITMASK(24);
+	dest[0] &= BITMASK(8);
+
+	flg_r = (dest[0]>>7) & 1;
+
+	/*set overflow*/
+	overflow = (flg_s ^ flg_r) & (flg_d ^ flg_r);
+
+	return (overflow<<DSP_SR_L)|(overflow<<DSP_SR_V)|(carry<<DSP_SR_C);
+}
+
+static Uint16 ref_sub56(Uint32 *source, Uint32 *dest)
+{
+	Uint16 overflow, carry, flg_s, flg_d, flg_r, dest_save;
+
+	dest_save = dest[0];
+
+	/* Subtract source from dest: D = D-S */
+	dest[2] -= source[2];
+	dest[1] -= source[1]+((dest[2]>>24) & 1);
+	dest[0] -= source[0]+((dest[1]>>24) & 1);
+
+	carry = (dest[0]>>8) & 1;
+
+	dest[2] &= BITMASK(24);
+	dest[1] &= BITMASK(24);
+	dest[0] &= BITMASK(8);
+
+	flg_s = (source[0]>>7) & 1;
+	flg_d = (dest_save>>7) & 1;
+	flg_r = (dest[0]>>7) & 1;
+
+	/* set overflow */
+	overflow = (flg_s ^ flg_d) & (flg_r ^ flg_d);
+
+	return (overflow<<DSP_SR_L)|(overflow<<DSP_SR_V)|(carry<<DSP_SR_C);
+}
+
+static void ref_mul56(Uint32 source1, Uint32 source2, Uint32 *dest, Uint8 signe)
+{
+	Uint32 part[4], zerodest[3], value;
+
+	/* Multiply: D = S1*S2 */
+	if (source1 & (1<<23)) {
+		signe ^= 1;
+		source1 = (1<<24) - source1;
+	}
+	if (source2 & (1<<23)) {
+		signe ^= 1;
+		source2 = (1<<24) - source2;
+	}
+
+	/* bits 0-11 * bits 0-11 */
+	part[0]=(source1 & BITMASK(12))*(source2 & BITMASK(12));
+	/* bits 12-23 * bits 0-11 */
+	part[1]=((source1>>12) & BITMASK(12))*(source2 & BITMASK(12));
+	/* bits 0-11 * bits 12-23 */
+	part[2]=(source1 & BITMASK(12))*((source2>>12)  & BITMASK(12));
+	/* bits 12-23 * bits 12-23 */
+	part[3]=((source1>>12) & BITMASK(12))*((source2>>12) & BITMASK(12));
+
+	/* Calc dest 2 */
+	dest[2] = part[0];
+	dest[2] += (part[1] & BITMASK(12)) << 12;
+	dest[2] += (part[2] & BITMASK(12)) << 12;
+
+	/* Calc dest 1 */
+	dest[1] = (part[1]>>12) & BITMASK(12);
+	dest[1] += (part[2]>>12) & BITMASK(12);
+	dest[1] += part[3];
+
+	/* Calc dest 0 */
+	dest[0] = 0;
+
+	/* Add carries */
+	value = (dest[2]>>24) & BITMASK(8);
+	if (value) {
+		dest[1] += value;
+		dest[2] &= BITMASK(24);
+	}
+	value = (dest[1]>>24) & BITMASK(8);
+	if (value) {
+		dest[0] += value;
+		dest[1] &= BITMASK(24);
+	}
+
+	/* Get rid of extra sign bit */
+	ref_asl56(dest);
+
+	if (signe) {
+		zerodest[0] = zerodest[1] = zerodest[2] = 0;
+
+		ref_sub56(dest, zerodest);
+
+		dest[0] = zerodest[0];
+		dest[1] = zerodest[1];
+		dest[2] = zerodest[2];
+	}
+}
+
+static void ref_rnd56(Uint32 *dest)
+{
+	Uint32 rnd_const[3];
+
+	rnd_const[0] = 0;
+
+	/* Scaling mode S0 */
+	if (ref[DSP_REG_SR] & (1<<DSP_SR_S0)) {
+		rnd_const[1] = 1;
+		rnd_const[2] = 0;
+		ref_add56(rnd_const, dest);
+
+		if ((dest[2]==0) && ((dest[1] & 1) == 0)) {
+			dest[1] &= (0xffffff - 0x3);
+		}
+		dest[1] &= 0xfffffe;
+		dest[2]=0;
+	}
+	/* Scaling mode S1 */
+	else if (ref[DSP_REG_SR] & (1<<DSP_SR_S1)) {
+		rnd_const[1] = 0;
+		rnd_const[2] = (1<<22);
+		ref_add56(rnd_const, dest);
+
+		if ((dest[2] & 0x7fffff) == 0){
+			dest[2] = 0;
+		}
+		dest[2] &= 0x800000;
+	}
+	/* No Scaling */
+	else {
+		rnd_const[1] = 0;
+		rnd_const[2] = (1<<23);
+		ref_add56(rnd_const, dest);
+
+		if (dest[2] == 0) {
+			dest[1] &= 0xfffffe;
+		}
+		dest[2]=0;
+	}
+}
+
+static void ref_ccr_update_e_u_n_z(Uint32 reg0, Uint32 reg1, Uint32 reg2)
+{
+	Uint32 scaling, value_e, value_u;
+
+	/* Initialize SR register */
+	ref[DSP_REG_SR] &= BITMASK(16)-((1<<DSP_SR_E) | (1<<DSP_SR_U) | (1<<DSP_SR_N) | (1<<DSP_SR_Z));
+
+	scaling = (ref[DSP_REG_SR]>>DSP_SR_S0) & BITMASK(2);
+	switch(scaling) {
+		case 0:
+			/* Extension Bit (E) */
+			value_e = (reg0<<1) + (reg1>>23);
+			if ((value_e != 0) && (value_e != BITMASK(9)))
+				ref[DSP_REG_SR] |= 1 << DSP_SR_E;
+
+			/* Unnormalized bit (U) */
+			if ((reg1 & 0xc00000) == 0 || (reg1 & 0xc00000) == 0xc00000)
+				ref[DSP_REG_SR] |= 1 << DSP_SR_U;
+			break;
+		case 1:
+			/* Extension Bit (E) */
+			if ((reg0 != 0) && (reg0 != BITMASK(8)))
+				ref[DSP_REG_SR] |= 1 << DSP_SR_E;
+
+			/* Unnormalized bit (U) */
+			value_u = ((reg0<<1) + (reg1>>23)) & 3;
+			if (value_u == 0 || value_u == 3)
+				ref[DSP_REG_SR] |= 1 << DSP_SR_U;
+			break;
+		case 2:
+			/* Extension Bit (E) */
+			value_e = (reg0<<2) + (reg1>>22);
+			if ((value_e != 0) && (value_e != BITMASK(10)))
+				ref[DSP_REG_SR] |= 1 << DSP_SR_E;
+
+			/* Unnormalized bit (U) */
+			if ((reg1 & 0x600000) == 0 || (reg1 & 0x600000) == 0x600000)
+				ref[DSP_REG_SR] |= 1 << DSP_SR_U;
+			break;
+		default:
+			return;
+			break;
+	}
+
+	/* Zero Flag (Z) */
+	if ((reg1 == 0) && (reg2 == 0) && (reg0 == 0))
+		ref[DSP_REG_SR] |= 1 << DSP_SR_Z;
+
+	/* Negative Flag (N) */
+	ref[DSP_REG_SR] |= (reg0>>4) & 0x8;
+}
+
+/* Accumulator A (numreg 0) or B (numreg 1) */
+static void ref_read_acc(int numreg, Uint32 *dest)
+{
+	dest[0] = ref[DSP_REG_A2+numreg];
+	dest[1] = ref[DSP_REG_A1+numreg];
+	dest[2] = ref[DSP_REG_A0+numreg];
+}
+
+static void ref_write_acc(int numreg, Uint32 *source)
+{
+	ref[DSP_REG_A2+numreg] = source[0];
+	ref[DSP_REG_A1+numreg] = source[1];
+	ref[DSP_REG_A0+numreg] = source[2];
+}
+
+/* Sign extend a 48 bits source to 56 bits */
+static void ref_sext(Uint32 hi, Uint32 lo, Uint32 *dest)
+{
+	dest[1] = hi;
+	dest[2] = lo;
+	dest[0] = dest[1] & (1<<23) ? 0xff : 0x0;
+}
+
+static int ref_kind(Uint8 op)
+{
+	if (op & 0x80)
+		return REF_MUL;
+	return MicroAluKinds[op < 0x40 ? op>>4 : 4][op & 7];
+}
+
+/**
+ * Execute ALU opcode op on the reference registers, the same way the
+ * former instruction handlers did.
+ */
+static void ref_alu(Uint8 op)
+{
+	Uint32 one[3] = { 0, 0, 1 };
+	Uint32 source[3], dest[3], curcarry, overflowed;
+	Uint16 newsr = 0, mask = (1<<DSP_SR_V)|(1<<DSP_SR_C);
+	int numreg = (op>>3) & 1;
+	bool bWrite = true;
+
+	curcarry = (ref[DSP_REG_SR]>>DSP_SR_C) & 1;
+	ref_read_acc(numreg, dest);
+
+	if (op & 0x80) {
+		ref_mul56(ref[MicroAluMul[(op>>4) & 7][0]], ref[MicroAluMul[(op>>4) & 7][1]],
+		          source, (op & 4) ? SIGN_MINUS : SIGN_PLUS);
+		if (op & 2) {
+			newsr = ref_add56(source, dest);
+		} else {
+			dest[0] = source[0];
+			dest[1] = source[1];
+			dest[2] = source[2];
+		}
+		if (op & 1) {
+			ref_rnd56(dest);
+		}
+		ref_write_acc(numreg, dest);
+		ref_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+		ref[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
+		ref[DSP_REG_SR] |= newsr & 0xfe;
+		return;
+	}
+
+	if (op < 0x20) {
+		ref_read_acc(numreg ^ 1, source);
+	} else if (op < 0x40) {
+		if (op & 0x10)
+			ref_sext(ref[DSP_REG_Y1], ref[DSP_REG_Y0], source);
+		else
+			ref_sext(ref[DSP_REG_X1], ref[DSP_REG_X0], source);
+	} else {
+		ref_sext(ref[MicroAluSource[(op>>4) & 3]], 0, source);
+	}
+
+	switch (ref_kind(op)) {
+		case REF_ADD:
+			newsr = ref_add56(source, dest);
+			break;
+		case REF_ADC:
+			newsr = ref_add56(source, dest);
+			if (curcarry)
+				newsr |= ref_add56(one, dest);
+			break;
+		case REF_ADDL:
+			newsr = ref_asl56(dest);
+			newsr |= ref_add56(source, dest);
+			break;
+		case REF_ADDR:
+			newsr = ref_asr56(dest);
+			newsr |= ref_add56(source, dest);
+			break;
+		case REF_SUB:
+			newsr = ref_sub56(source, dest);
+			break;
+		case REF_SBC:
+			newsr = ref_sub56(source, dest);
+			if (curcarry)
+				newsr |= ref_sub56(one, dest);
+			break;
+		case REF_SUBL:
+			newsr = ref_asl56(dest);
+			newsr |= ref_sub56(source, dest);
+			break;
+		case REF_SUBR:
+			newsr = ref_asr56(dest);
+			newsr |= ref_sub56(source, dest);
+			break;
+		case REF_CMP:
+			newsr = ref_sub56(source, dest);
+			bWrite = false;
+			break;
+		case REF_CMPM:
+			ref_abs56(dest);
+			ref_abs56(source);
+			newsr = ref_sub56(source, dest);
+			bWrite = false;
+			break;
+		case REF_TST:
+			mask = 1<<DSP_SR_V;
+			bWrite = false;
+			break;
+		case REF_RND:
+			ref_rnd56(dest);
+			mask = 0;
+			break;
+		case REF_ASL:
+			newsr = ref_asl56(dest);
+			break;
+		case REF_ASR:
+			newsr = ref_asr56(dest);
+			break;
+		case REF_ABS:
+		case REF_NEG:
+			overflowed = ((dest[2]==0) && (dest[1]==0) && (dest[0]==0x80));
+			if (op & 0x10) {
+				source[0] = dest[0];
+				source[1] = dest[1];
+				source[2] = dest[2];
+				dest[0] = dest[1] = dest[2] = 0;
+				ref_sub56(source, dest);
+			} else {
+				ref_abs56(dest);
+			}
+			newsr = (overflowed<<DSP_SR_L)|(overflowed<<DSP_SR_V);
+			mask = 1<<DSP_SR_V;
+			break;
+	}
+
+	if (bWrite)
+		ref_write_acc(numreg, dest);
+	ref_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	ref[DSP_REG_SR] &= BITMASK(16)-mask;
+	ref[DSP_REG_SR] |= newsr;
+}
+
+
+/* ----------------------------------------------------------------------- */
+/* Kernel                                                                   */
+/* ----------------------------------------------------------------------- */
+
+static Uint32 Micro_DspAluRandom(void)
+{
+	/* xorshift64* */
+	nMicroAluSeed ^= nMicroAluSeed >> 12;
+	nMicroAluSeed ^= nMicroAluSeed << 25;
+	nMicroAluSeed ^= nMicroAluSeed >> 27;
+	return (Uint32)((nMicroAluSeed * 0x2545F4914F6CDD1DULL) >> 32);
+}
+
+/* Half of the values are taken from the edge cases */
+static Uint32 Micro_DspAluValue(const Uint32 *pEdge, Uint32 nMask)
+{
+	Uint32 r = Micro_DspAluRandom();
+
+	if (r & 0x80000000)
+		return pEdge[r & 7];
+	return (r >> 3) & nMask;
+}
+
+static void Micro_DspAluPrint(const char *psName, const Uint32 *pRegs)
+{
+	fprintf(stderr, "  %-8s a=%02x:%06x:%06x b=%02x:%06x:%06x x=%06x:%06x y=%06x:%06x sr=%04x\n",
+	        psName, pRegs[DSP_REG_A2], pRegs[DSP_REG_A1], pRegs[DSP_REG_A0],
+	        pRegs[DSP_REG_B2], pRegs[DSP_REG_B1], pRegs[DSP_REG_B0],
+	        pRegs[DSP_REG_X1], pRegs[DSP_REG_X0], pRegs[DSP_REG_Y1], pRegs[DSP_REG_Y0],
+	        pRegs[DSP_REG_SR]);
+}
+
+static void Micro_DspHostInterrupt(int set) {}
+
+/**
+ * Load all checked opcodes to P memory, one at each address.
+ */
+bool Micro_DspAluSetup(void)
+{
+	int i;
+
+	dsp_core_init(Micro_DspHostInterrupt);
+	dsp_core_reset();
+	dsp_core_start(0);
+
+	nMicroAluOps = 0;
+	for (i = 0; i < 256; i++) {
+		if (ref_kind(i) != REF_NONE)
+			MicroAluOps[nMicroAluOps++] = i;
+		dsp_core.ramint[DSP_SPACE_P][i] = 0x200000 | i;
+	}
+	dsp56k_flush_decode_cache();
+
+	nMicroAluSeed = 0x0123456789ABCDEFULL;
+	nMicroAluErrors = 0;
+	return true;
+}
+
+Uint64 Micro_DspAluRun(void)
+{
+	static const int regs[] = {
+		DSP_REG_A0, DSP_REG_A1, DSP_REG_A2, DSP_REG_B0, DSP_REG_B1, DSP_REG_B2, DSP_REG_SR
+	};
+	Uint32 input[64];
+	Uint8 op;
+	int i, j;
+
+	for (i = 0; i < MICRO_ALU_CASES; i++) {
+		op = MicroAluOps[Micro_DspAluRandom() % nMicroAluOps];
+
+		dsp_core.registers[DSP_REG_X0] = Micro_DspAluValue(MicroAluEdge24, BITMASK(24));
+		dsp_core.registers[DSP_REG_X1] = Micro_DspAluValue(MicroAluEdge24, BITMASK(24));
+		dsp_core.registers[DSP_REG_Y0] = Micro_DspAluValue(MicroAluEdge24, BITMASK(24));
+		dsp_core.registers[DSP_REG_Y1] = Micro_DspAluValue(MicroAluEdge24, BITMASK(24));
+		dsp_core.registers[DSP_REG_A0] = Micro_DspAluValue(MicroAluEdge24, BITMASK(24));
+		dsp_core.registers[DSP_REG_A1] = Micro_DspAluValue(MicroAluEdge24, BITMASK(24));
+		dsp_core.registers[DSP_REG_A2] = Micro_DspAluValue(MicroAluEdge8, BITMASK(8));
+		dsp_core.registers[DSP_REG_B0] = Micro_DspAluValue(MicroAluEdge24, BITMASK(24));
+		dsp_core.registers[DSP_REG_B1] = Micro_DspAluValue(MicroAluEdge24, BITMASK(24));
+		dsp_core.registers[DSP_REG_B2] = Micro_DspAluValue(MicroAluEdge8, BITMASK(8));
+
+		/* Condition codes and scaling mode, interrupts stay masked */
+		dsp_core.registers[DSP_REG_SR] = (3<<DSP_SR_I0) | (Micro_DspAluRandom() &
+		                                 ((3<<DSP_SR_S0) | BITMASK(8)));
+
+		memcpy(input, dsp_core.registers, sizeof(input));
+		memcpy(ref, dsp_core.registers, sizeof(ref));
+
+		dsp_core.pc = op;
+		dsp56k_execute_instruction();
+		ref_alu(op);
+
+		for (j = 0; j < (int)(sizeof(regs) / sizeof(int)); j++) {
+			if (dsp_core.registers[regs[j]] != ref[regs[j]])
+				break;
+		}
+		if (j < (int)(sizeof(regs) / sizeof(int))) {
+			if (nMicroAluErrors++ < MICRO_ALU_REPORT) {
+				fprintf(stderr, "dsp.alu: ALU opcode 0x%02x differs\n", op);
+				Micro_DspAluPrint("input", input);
+				Micro_DspAluPrint("result", dsp_core.registers);
+				Micro_DspAluPrint("expected", ref);
+			}
+		}
+	}
+	return MICRO_ALU_CASES;
+}
+
+bool Micro_DspAluCheck(void)
+{
+	return nMicroAluErrors == 0;
+}
@@ -0,0 +1,238 @@
+/*
+  Previous micro benchmarks - microbench_fpu.c
+
+  This file is distributed under the GNU Public License, version 2 or at
+  your option any later version. Read the file gpl.txt for details.
+
+  Check kernel for the host FPU fast path of fpp-softfloat.h. Every case
+  divides two values or takes the square root of one value through
+  fp_host_arithmetic() and, if the host path accepted the operation, through
+  floatx80_div() or floatx80_sqrt(). Operands are random normal values, values
+  near the exponent limits, denormals, zeros, infinities and NaNs, unnormals
+  and products of short mantissas that give exact results, with random signs.
+  Any difference in the result or in the softfloat exception flags fails the
+  check. A quarter of the cases use another FPCR mode, where the host path
+  must not be taken at all.
+*/
+const char MicroBenchFpu_fileid[] = "Previous microbench_fpu.c : " __DATE__ " " __TIME__;
+
+#include "main.h"
+#include "hatari-glue.h"
+#include "sysconfig.h"
+#include "sysdeps.h"
+#include "options_cpu.h"
+#include "memory.h"
+#include "newcpu.h"
+/* The fast path is compiled with its own control word, fpp.c keeps fp_ctrl */
+#define fp_ctrl MicroFpuCtrl
+#include "fpp-softfloat.h"
+#include "microbench.h"
+
+#define MICRO_FPU_CASES   10000     /* cases per batch */
+#define MICRO_FPU_REPORT  10        /* differences printed */
+
+#if FPP_HOST_FASTPATH
+
+static float_ctrl MicroFpuExact;
+static Uint64 nMicroFpuSeed;
+static Uint64 nMicroFpuErrors;
+static Uint64 nMicroFpuAccepted;
+
+
+static Uint32 Micro_FpuRandom(void)
+{
+	/* xorshift64* */
+	nMicroFpuSeed ^= nMicroFpuSeed >> 12;
+	nMicroFpuSeed ^= nMicroFpuSeed << 25;
+	nMicroFpuSeed ^= nMicroFpuSeed >> 27;
+	return (Uint32)((nMicroFpuSeed * 0x2545F4914F6CDD1DULL) >> 32);
+}
+
+static Uint64 Micro_FpuMantissa(void)
+{
+	return ((Uint64)Micro_FpuRandom() << 32) | Micro_FpuRandom();
+}
+
+/* Normal value with only the upper 32 mantissa bits used, products of two
+ * such values are exact */
+static floatx80 Micro_FpuShort(int nExpRange)
+{
+	floatx80 f;
+
+	f.high = 0x3FFF + (int)(Micro_FpuRandom() % (2 * nExpRange + 1)) - nExpRange;
+	f.low = ((Uint64)(Micro_FpuRandom() | 0x80000000) << 32);
+	return f;
+}
+
+static floatx80 Micro_FpuValue(void)
+{
+	Uint32 r = Micro_FpuRandom();
+	floatx80 f;
+
+	switch (r & 7) {
+		case 0: /* Normal, full exponent range */
+		case 1:
+			f.high = 1 + (Micro_FpuRandom() % 0x7FFE);
+			f.low = Micro_FpuMantissa() | LIT64(0x8000000000000000);
+			break;
+		case 2: /* Normal, near the exponent limits */
+			f.high = Micro_FpuRandom() % 64;
+			if (r & 0x100)
+				f.high = 0x7FFE - f.high;
+			else
+				f.high += 1;
+			f.low = Micro_FpuMantissa() | LIT64(0x8000000000000000);
+			break;
+		case 3: /* Normal, near one */
+			f.high = 0x3FFF + (int)(Micro_FpuRandom() % 17) - 8;
+			f.low = Micro_FpuMantissa() | LIT64(0x8000000000000000);
+			break;
+		case 4: /* Denormal, or pseudo denormal */
+			f.high = 0;
+			f.low = Micro_FpuMantissa() >> (Micro_FpuRandom() % 64);
+			break;
+		case 5: /* Zero */
+			f.high = 0;
+			f.low = 0;
+			break;
+		case 6: /* Infinity, NaN or unnormal */
+			f.high = (r & 0x100) ? 0x7FFF : 1 + (Micro_FpuRandom() % 0x7FFE);
+			f.low = (r & 0x200) ? Micro_FpuMantissa() >> 1 : 0;
+			if (r & 0x400)
+				f.low |= LIT64(0x8000000000000000);
+			break;
+		default: /* Short mantissa */
+			f = Micro_FpuShort(64);
+			break;
+	}
+	if (r & 0x80000000)
+		f.high |= 0x8000;
+	return f;
+}
+
+/* Default mode without exception enables is the only one using the host */
+static uae_u32 Micro_FpuMode(void)
+{
+	uae_u32 mode;
+
+	do {
+		mode = Micro_FpuRandom() & 0xFFF0;
+		/* Half of the modes without exception enables */
+		if (mode & 0x100)
+			mode &= 0x00F0;
+	} while (mode == 0);
+	return mode;
+}
+
+static void Micro_FpuReport(const char *pOp, uae_u32 mode, floatx80 *a, floatx80 *b,
+                            floatx80 *r, int8 flags, floatx80 *e, int8 eflags)
+{
+	if (nMicroFpuErrors++ >= MICRO_FPU_REPORT)
+		return;
+	fprintf(stderr, "fpu.hostpath: %s differs, mode %04x\n", pOp, mode);
+	fprintf(stderr, "  a        %04x %016llx\n", a->high, (unsigned long long)a->low);
+	fprintf(stderr, "  b        %04x %016llx\n", b->high, (unsigned long long)b->low);
+	if (r)
+		fprintf(stderr, "  result   %04x %016llx flags %02x\n", r->high,
+		        (unsigned long long)r->low, flags & 0xff);
+	if (e)
+		fprintf(stderr, "  expected %04x %016llx flags %02x\n", e->high,
+		        (unsigned long long)e->low, eflags & 0xff);
+}
+
+static void Micro_FpuCase(int op, uae_u32 mode, floatx80 a, floatx80 b)
+{
+	const char *pOp = (op == FP_HOST_DIV) ? "fdiv" : "fsqrt";
+	floatx80 r, e;
+	int8 flags, eflags;
+
+	set_float_exception_flags(0, &fp_ctrl);
+	r = a;
+	if (!fp_host_arithmetic(&r, &b, op))
+		return;
+	flags = get_float_exception_flags(&fp_ctrl);
+
+	if (mode != 0) {
+		Micro_FpuReport(pOp, mode, &a, &b, NULL, 0, NULL, 0);
+		return;
+	}
+	nMicroFpuAccepted++;
+
+	set_float_exception_flags(0, &fp_ctrl);
+	if (op == FP_HOST_DIV)
+		e = floatx80_div(a, b, &fp_ctrl);
+	else
+		e = floatx80_sqrt(b, &fp_ctrl);
+	eflags = get_float_exception_flags(&fp_ctrl);
+
+	if (r.high != e.high || r.low != e.low || flags != eflags)
+		Micro_FpuReport(pOp, mode, &a, &b, &r, flags, &e, eflags);
+}
+
+bool Micro_FpuSetup(void)
+{
+	init_fp_mode(68882);
+	set_fp_mode(0);
+	float_init(&MicroFpuExact);
+
+	nMicroFpuSeed = 0x0123456789ABCDEFULL;
+	nMicroFpuErrors = 0;
+	nMicroFpuAccepted = 0;
+	return true;
+}
+
+Uint64 Micro_FpuRun(void)
+{
+	floatx80 a, b;
+	uae_u32 mode;
+	int i;
+
+	for (i = 0; i < MICRO_FPU_CASES; i++) {
+		mode = (Micro_FpuRandom() & 3) ? 0 : Micro_FpuMode();
+		set_fp_mode(mode);
+
+		a = Micro_FpuValue();
+		b = Micro_FpuValue();
+		if ((i & 7) == 0) {
+			/* Exact quotient */
+			b = Micro_FpuShort(1000);
+			a = floatx80_mul(b, Micro_FpuShort(1000), &MicroFpuExact);
+			b.high |= Micro_FpuRandom() & 0x8000;
+		}
+		Micro_FpuCase(FP_HOST_DIV, mode, a, b);
+
+		if ((i & 7) == 1) {
+			/* Exact square root */
+			b = Micro_FpuShort(1000);
+			b = floatx80_mul(b, b, &MicroFpuExact);
+		}
+		Micro_FpuCase(FP_HOST_SQRT, mode, a, b);
+	}
+	set_fp_mode(0);
+	return 2 * MICRO_FPU_CASES;
+}
+
+/* The host path has to be taken, else the kernel did not check anything */
+bool Micro_FpuCheck(void)
+{
+	return nMicroFpuErrors == 0 && nMicroFpuAccepted != 0;
+}
+
+#else	/* FPP_HOST_FASTPATH */
+
+bool Micro_FpuSetup(void)
+{
+	return false;
+}
+
+Uint64 Micro_FpuRun(void)
+{
+	return 0;
+}
+
+bool Micro_FpuCheck(void)
+{
+	return true;
+}
+
+#endif	/* FPP_HOST_FASTPATH */
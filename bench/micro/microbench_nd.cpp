@@ -0,0 +1,205 @@
+/*
+  Previous micro benchmarks - microbench_nd.cpp
+
+  This file is distributed under the GNU Public License, version 2 or at
+  your option any later version. Read the file gpl.txt for details.
+
+  i860 kernels of the micro benchmarks. The loop kernel creates a
+  NeXTdimension board without ROM, which is not added to the NextBus. A
+  short boot stub in the ROM jumps to a loop in RAM, which is executed
+  cycle by cycle on the calling thread. The fzchk kernel compares the SSE2
+  version of the z-buffer check with the scalar version.
+*/
+const char MicroBenchND_fileid[] = "Previous microbench_nd.cpp : " __DATE__ " " __TIME__;
+
+#include "main.h"
+#include "configuration.h"
+#include "m68000.h"
+#include "sysdeps.h"
+#include "dimension.hpp"
+#include "host.h"
+#include "microbench.h"
+
+#define MICRO_I860_CYCLES   100000  /* i860 cycles per batch */
+#define MICRO_I860_RAM      0xF8000000
+#define MICRO_I860_LOOP     0xF8001000
+#define MICRO_I860_DATA     0x00100000  /* offset in RAM */
+#define MICRO_FZCHK_OPS     100000      /* operand pairs per batch */
+
+/* Executed in CS8 mode from the reset vector at 0xFFFFFF00 */
+static const Uint32 MicroI860Boot[] = {
+    0xEC04F800,     /* orh   0xf800,r0,r4 */
+    0xE4841000,     /* or    0x1000,r4,r4 */
+    0x40002000,     /* bri   r4 */
+    0x38400000      /* st.c  r0,dirbase (leaves CS8 mode) */
+};
+
+static const Uint32 MicroI860Loop[] = {
+    0xEC04F810,     /*       orh   0xf810,r0,r4 */
+    0x14850001,     /* loop: ld.l  0(r4),r5 */
+    0x80C62800,     /*       addu  r5,r6,r6 */
+    0xF0E73000,     /*       xor   r6,r7,r7 */
+    0xA4E80003,     /*       shl   3,r7,r8 */
+    0x1C804005,     /*       st.l  r8,4(r4) */
+    0x95290001,     /*       adds  1,r9,r9 */
+    0x6BFFFFF8,     /*       br    loop */
+    0xA0000000      /*       nop */
+};
+
+static NextDimension* nd;
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Create the board, load the code and reset the i860.
+ */
+bool Micro_I860Setup(void) {
+    ConfigureParams.Dimension.bI860Thread = false;
+    ConfigureParams.Dimension.board[0].nMemoryBankSize[0] = 16;
+    ConfigureParams.Dimension.board[0].nMemoryBankSize[1] = 0;
+    ConfigureParams.Dimension.board[0].nMemoryBankSize[2] = 0;
+    ConfigureParams.Dimension.board[0].nMemoryBankSize[3] = 0;
+    ConfigureParams.Dimension.board[0].szRomFileName[0] = '\0';
+
+    /* The board opens a window for its screen */
+    SDL_setenv("SDL_VIDEODRIVER", "dummy", 0);
+    if (SDL_InitSubSystem(SDL_INIT_VIDEO) < 0)
+        return false;
+
+    nd = new NextDimension(ND_SLOT(0));
+
+    /* The ROM is fetched byte by byte in CS8 mode */
+    for (unsigned i = 0; i < sizeof(MicroI860Boot) / sizeof(Uint32); i++) {
+        for (int b = 0; b < 4; b++)
+            nd->rom[0x1FF00 + i * 4 + b] = MicroI860Boot[i] >> (b * 8);
+    }
+    /* Instruction pairs are fetched as big endian 64-bit words, the
+     * instruction at the lower address in the lower half */
+    for (unsigned i = 0; i < sizeof(MicroI860Loop) / sizeof(Uint32); i++) {
+        Uint32 addr = MICRO_I860_LOOP - MICRO_I860_RAM + i * 4;
+        do_put_mem_long(nd->ram + (addr ^ 4), MicroI860Loop[i]);
+    }
+    memset(nd->ram + MICRO_I860_DATA, 0x55, 16);
+
+    nd->handle_msgs();
+    return true;
+}
+
+Uint64 Micro_I860Run(void) {
+    for (int i = 0; i < MICRO_I860_CYCLES; i++)
+        nd->i860.run_cycle();
+    return MICRO_I860_CYCLES;
+}
+
+/* The loop stores its result next to the word it loads */
+bool Micro_I860Check(void) {
+    for (int i = 0; i < 16; i++) {
+        if (nd->ram[MICRO_I860_DATA + i] != 0x55)
+            return true;
+    }
+    return false;
+}
+
+void Micro_I860Cleanup(void) {
+    delete nd;
+    nd = NULL;
+    SDL_QuitSubSystem(SDL_INIT_VIDEO);
+}
+
+static Uint64 nFzchkSeed;
+static Uint64 nFzchkErrors;
+
+static Uint64 Micro_FzchkRandom(void) {
+    /* xorshift64* */
+    nFzchkSeed ^= nFzchkSeed >> 12;
+    nFzchkSeed ^= nFzchkSeed << 25;
+    nFzchkSeed ^= nFzchkSeed >> 27;
+    return nFzchkSeed * 0x2545F4914F6CDD1DULL;
+}
+
+/* Fields at the ends of the range and around the sign bit */
+static Uint64 Micro_FzchkEdge(Uint64 r, int is16) {
+    static const Uint32 edge[8] = {
+        0x00000000, 0x00000001, 0x00007FFF, 0x00008000,
+        0x0000FFFF, 0x7FFFFFFF, 0x80000000, 0xFFFFFFFF
+    };
+    int bits = is16 ? 16 : 32;
+    Uint64 mask = is16 ? 0xFFFF : 0xFFFFFFFF;
+    Uint64 v = 0;
+
+    for (int i = 0; i < 64 / bits; i++) {
+        v |= (edge[(r >> (i * 3)) & 7] & mask) << (i * bits);
+    }
+    return v;
+}
+
+/* Add -1, 0 or +1 to each field, with wrap around inside the field */
+static Uint64 Micro_FzchkNear(Uint64 v, Uint64 r, int is16) {
+    int bits = is16 ? 16 : 32;
+    Uint64 mask = is16 ? 0xFFFF : 0xFFFFFFFF;
+    Uint64 result = 0;
+
+    for (int i = 0; i < 64 / bits; i++) {
+        Uint64 f = (v >> (i * bits)) & mask;
+        f = (f + ((r >> (i * 2)) % 3) - 1) & mask;
+        result |= f << (i * bits);
+    }
+    return result;
+}
+
+bool Micro_FzchkSetup(void) {
+#if defined(__SSE2__)
+    nFzchkSeed = 0x0123456789ABCDEFULL;
+    nFzchkErrors = 0;
+    return true;
+#else
+    return false;
+#endif
+}
+
+/* Random, edge case and near equal operands for fzchks and fzchkl. The
+ * bits returned in le become the PM bits of the instruction. */
+Uint64 Micro_FzchkRun(void) {
+#if defined(__SSE2__)
+    for (int i = 0; i < MICRO_FZCHK_OPS; i++) {
+        Uint64 r = Micro_FzchkRandom();
+        int is16 = r & 1;
+        Uint64 src1, src2, res1, res2;
+        UINT32 le1, le2;
+
+        switch ((r >> 1) & 3) {
+            case 0:
+                src1 = Micro_FzchkRandom();
+                src2 = Micro_FzchkRandom();
+                break;
+            case 1:
+                src1 = Micro_FzchkEdge(Micro_FzchkRandom(), is16);
+                src2 = Micro_FzchkEdge(Micro_FzchkRandom(), is16);
+                break;
+            case 2:
+                src1 = Micro_FzchkRandom();
+                src2 = Micro_FzchkNear(src1, Micro_FzchkRandom(), is16);
+                break;
+            default:
+                src1 = Micro_FzchkEdge(Micro_FzchkRandom(), is16);
+                src2 = Micro_FzchkNear(src1, Micro_FzchkRandom(), is16);
+                break;
+        }
+
+        res1 = i860_fzchk_sse2(src1, src2, is16, &le1);
+        res2 = i860_fzchk_scalar(src1, src2, is16, &le2);
+        if (res1 != res2 || le1 != le2) {
+            if (nFzchkErrors++ < 10) {
+                fprintf(stderr, "i860.fzchk: fzchk%c %016llx,%016llx: sse2 %016llx le=%x, "
+                        "scalar %016llx le=%x\n", is16 ? 's' : 'l',
+                        (unsigned long long)src1, (unsigned long long)src2,
+                        (unsigned long long)res1, le1, (unsigned long long)res2, le2);
+            }
+        }
+    }
+#endif
+    return MICRO_FZCHK_OPS;
+}
+
+bool Micro_FzchkCheck(void) {
+    return nFzchkErrors == 0;
+}
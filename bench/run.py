@@ -0,0 +1,194 @@
+#!/usr/bin/env python3
+#
+# Previous benchmark - run.py
+#
+# This file is distributed under the GNU Public License, version 2 or at
+# your option any later version. Read the file gpl.txt for details.
+#
+# Run the reference machines in batch mode and collect the reports of all
+# runs in one JSON file. See readme.txt in this directory.
+
+import argparse
+import json
+import os
+import shutil
+import socket
+import subprocess
+import sys
+import tempfile
+import threading
+import time
+
+BENCH_DIR = os.path.dirname(os.path.abspath(__file__))
+SRC_DIR = os.path.join(os.path.dirname(BENCH_DIR), "src")
+
+CONFIGS = ["cube030", "turbocolor", "turbodimension"]
+
+ROMS = [
+    ("ROM.szRom030FileName", "Rev_1.0_v41.BIN"),
+    ("ROM.szRom040FileName", "Rev_2.5_v66.BIN"),
+    ("ROM.szRomTurboFileName", "Rev_3.3_v74.BIN"),
+    ("Dimension.szRomFileName0", "ND_step1_v43_eeprom.bin"),
+]
+
+# Phase names written by guest/bench.sh, "DONE" ends the run
+MARKER_DONE = 0x444F4E45
+
+NET_BYTES = 16 * 1024 * 1024
+
+
+def serve_network(server):
+    """Send NET_BYTES to every guest which connects."""
+    block = bytes(64 * 1024)
+    while True:
+        try:
+            conn, _ = server.accept()
+        except OSError:
+            return
+        with conn:
+            try:
+                for _ in range(NET_BYTES // len(block)):
+                    conn.sendall(block)
+            except OSError:
+                pass
+
+
+def run_previous(args, config, workload, options, home):
+    """Run one batch run and return its result record."""
+    report = os.path.join(home, "report.json")
+    cmd = [args.previous,
+           "--configfile", os.path.join(BENCH_DIR, "configs", config + ".cfg"),
+           "--batch", "--report", report]
+    for key, rom in ROMS:
+        cmd += ["--set", "%s=%s" % (key, os.path.join(SRC_DIR, rom))]
+    cmd += options
+
+    # A private home directory keeps the user configuration out of the run
+    env = dict(os.environ, HOME=home, SDL_VIDEODRIVER="dummy", SDL_AUDIODRIVER="dummy")
+    print("Running %s/%s ..." % (config, workload), file=sys.stderr)
+    start = time.time()
+    with open(os.path.join(home, "previous.log"), "w") as log:
+        status = subprocess.call(cmd, env=env, stdout=log, stderr=subprocess.STDOUT)
+
+    result = {"config": config, "workload": workload, "status": status,
+              "wall_seconds": round(time.time() - start, 3)}
+    try:
+        with open(report) as f:
+            result["report"] = json.load(f)
+        os.remove(report)
+    except (OSError, ValueError) as e:
+        result["error"] = str(e)
+        return result
+
+    # guest/bench.sh writes FAIL after a workload failed
+    phases = [p["name"] for p in result["report"].get("phases", [])]
+    if "FAIL" in phases:
+        i = phases.index("FAIL")
+        result["error"] = "workload %s failed" % (phases[i - 1] if i else "unknown")
+    return result
+
+
+def run_micro(binary):
+    """Run the micro benchmarks and return their results."""
+    handle, report = tempfile.mkstemp(prefix="previous-micro-", suffix=".json")
+    os.close(handle)
+    print("Running micro benchmarks ...", file=sys.stderr)
+    try:
+        status = subprocess.call([binary, "--json", report], stdout=subprocess.DEVNULL)
+        with open(report) as f:
+            result = json.load(f)
+        result["status"] = status
+    except (OSError, ValueError) as e:
+        result = {"status": -1, "error": str(e)}
+    finally:
+        os.remove(report)
+    return result
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Run the Previous benchmark suite.")
+    parser.add_argument("--previous", required=True, help="emulator binary")
+    parser.add_argument("--disk", help="NeXTSTEP disk image prepared with guest/bench.sh")
+    parser.add_argument("--configs", default=",".join(CONFIGS),
+                        help="comma separated machine configurations (default: all)")
+    parser.add_argument("--rom-time", type=float, default=30,
+                        help="emulated seconds for the ROM workload")
+    parser.add_argument("--guest-timeout", type=float, default=1800,
+                        help="emulated seconds after which a guest run fails")
+    parser.add_argument("--marker", default="0x04FFF000",
+                        help="marker address, must match the address file in the guest")
+    parser.add_argument("--port", type=int, default=5999, help="host port for the network workload")
+    parser.add_argument("--micro", help="micro benchmark binary, runs it in addition to the machines")
+    parser.add_argument("--out", default="bench.json", help="result file")
+    args = parser.parse_args()
+
+    server = None
+    if args.disk:
+        server = socket.socket(socket.AF_INET, socket.SOCK_STREAM)
+        server.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
+        server.bind(("127.0.0.1", args.port))
+        server.listen(1)
+        threading.Thread(target=serve_network, args=(server,), daemon=True).start()
+
+    runs = []
+    for config in args.configs.split(","):
+        home = tempfile.mkdtemp(prefix="previous-bench-")
+        try:
+            # Power-on test and ROM monitor, no disk required
+            runs.append(run_previous(args, config, "rom", [
+                "--set", "Boot.nBootDevice=0",
+                "--set", "Boot.bEnableDRAMTest=TRUE",
+                "--set", "HardDisk.bDiskInserted0=FALSE",
+                "--set", "Ethernet.bEthernetConnected=FALSE",
+                "--run-time", str(args.rom_time)], home))
+
+            # Boot to login and run the workloads of guest/bench.sh
+            if args.disk:
+                disk = os.path.join(home, "disk.img")
+                shutil.copyfile(args.disk, disk)
+                runs.append(run_previous(args, config, "guest", [
+                    "--set", "Boot.nBootDevice=1",
+                    "--set", "HardDisk.szImageName0=" + disk,
+                    "--set", "HardDisk.nDeviceType0=1",
+                    "--set", "HardDisk.bDiskInserted0=TRUE",
+                    "--set", "HardDisk.bWriteProtected0=FALSE",
+                    "--set", "Ethernet.bEthernetConnected=TRUE",
+                    "--set", "Ethernet.nHostInterface=0",
+                    "--exit-on-write", "%s=0x%08X" % (args.marker, MARKER_DONE),
+                    "--run-time", str(args.guest_timeout)], home))
+        finally:
+            shutil.rmtree(home, ignore_errors=True)
+
+    if server:
+        server.close()
+
+    try:
+        revision = subprocess.check_output(["git", "describe", "--always", "--dirty"],
+                                           cwd=BENCH_DIR, stderr=subprocess.DEVNULL).decode().strip()
+    except (OSError, subprocess.CalledProcessError):
+        revision = None
+
+    micro = run_micro(args.micro) if args.micro else None
+
+    results = {"suite": "previous-bench",
+               "date": time.strftime("%Y-%m-%dT%H:%M:%SZ", time.gmtime()),
+               "revision": revision,
+               "runs": runs}
+    if micro:
+        results["micro"] = micro
+    with open(args.out, "w") as f:
+        json.dump(results, f, indent=2)
+        f.write("\n")
+
+    failed = [r for r in runs if r["status"] != 0 or "error" in r]
+    for r in failed:
+        print("%s/%s failed (status %d%s)" % (r["config"], r["workload"], r["status"],
+                                            ", " + r["error"] if "error" in r else ""), file=sys.stderr)
+    if micro and micro["status"] != 0:
+        print("micro benchmarks failed (status %d)" % micro["status"], file=sys.stderr)
+        failed.append(micro)
+    return 1 if failed else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -51,3 +51,12 @@
 
 /* Define to 1 if you have the '_aligned_alloc' function */
 #cmakedefine HAVE__ALIGNED_ALLOC 1
+
+/* Define to 1 if you have the 'mmap' function */
+#cmakedefine HAVE_MMAP 1
+
+/* Define to 1 if you have the 'madvise' function */
+#cmakedefine HAVE_MADVISE 1
+
+/* Define to 1 if you have the 'fork' function */
+#cmakedefine HAVE_FORK 1
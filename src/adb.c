@@ -4,6 +4,7 @@
 #include "sysdeps.h"
 #include "sysReg.h"
 #include "adb.h"
+#include "memorySnapShot.h"
 
 
 /* Apple Desktop Bus emulation */
@@ -315,3 +316,7 @@ void ADB_Reset(void) {
 	adb.data0 = 0;
 	adb.data1 = 0;
 }
+
+void ADB_MemorySnapShot_Capture(bool bSave) {
+	MemorySnapShot_Store(&adb, sizeof(adb));
+}
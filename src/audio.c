@@ -7,6 +7,7 @@
 #include "dma.h"
 #include "snd.h"
 #include "host.h"
+#include "journal.h"
 
 #include <SDL.h>
 
@@ -28,6 +29,12 @@ static Uint32        recBufferWr         = 0;
 static Uint32        recBufferRd         = 0;
 static lock_t        recBufferLock;
 
+/* Samples read by the emulation are journaled in blocks */
+#define JOURNAL_BLOCK_SZ    4096
+static Uint8         journalBlock[JOURNAL_BLOCK_SZ];
+static int           journalLen          = 0;
+static int           journalPos          = 0;
+
 void Audio_Output_Queue(Uint8* data, int len) {
     int chunkSize = AUDIO_BUFFER_SAMPLES;
     if (bSoundOutputWorking) {
@@ -57,13 +64,13 @@ Uint32 Audio_Output_Queue_Size() {
 static void Audio_Input_CallBack(void *userdata, Uint8 *stream, int len) {
     Log_Printf(LOG_WARN, "Audio_Input_CallBack %d", len);
     if(len == 0) return;
-    Audio_Input_Lock();
+    host_lock(&recBufferLock);
     while(len--) {
         recBuffer[recBufferWr++&REC_BUFFER_MASK] = *stream++;		
 	}
 	recBufferWr &= REC_BUFFER_MASK;
 	recBufferWr &= ~1; /* Just to be sure */
-    Audio_Input_Unlock();
+    host_unlock(&recBufferLock);
 }
 
 void Audio_Input_Lock() {
@@ -83,7 +90,7 @@ static void Audio_Input_InitBuf(void) {
 	}
 }
 
-int Audio_Input_Read(void) {
+static int Audio_Input_ReadHost(void) {
 	Sint16 sample = 0;
 	
     if (bSoundInputWorking) {
@@ -100,8 +107,41 @@ int Audio_Input_Read(void) {
 	}
 }
 
+/* Returns the next sample or -1 if no sample is available */
+int Audio_Input_Read(void) {
+	int value;
+	
+	if (Journal_Replaying()) {
+		if (journalPos == journalLen) {
+			journalLen = Journal_Replay(JOURNAL_SNDIN, journalBlock, JOURNAL_BLOCK_SZ);
+			journalPos = 0;
+			if (journalLen <= 0) {
+				journalLen = 0;
+				return -1;
+			}
+		}
+		return journalBlock[journalPos++];
+	}
+	
+	value = Audio_Input_ReadHost();
+	if (value >= 0 && Journal_Recording()) {
+		journalBlock[journalLen++] = value;
+		if (journalLen == JOURNAL_BLOCK_SZ) {
+			Journal_Record(JOURNAL_SNDIN, journalBlock, journalLen);
+			journalLen = 0;
+		}
+	}
+	return value;
+}
+
+/* Only called by the emulation, the audio callback uses the lock directly */
 void Audio_Input_Unlock() {
     host_unlock(&recBufferLock);
+    
+    if (Journal_Recording() && journalLen > 0) {
+        Journal_Record(JOURNAL_SNDIN, journalBlock, journalLen);
+    }
+    journalLen = journalPos = 0;
 }
 
 static bool check_audio(int requested, int granted, const char* attribute) {
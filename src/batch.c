@@ -0,0 +1,527 @@
+/*
+  Previous - batch.c
+
+  This file is distributed under the GNU Public License, version 2 or at
+  your option any later version. Read the file gpl.txt for details.
+
+  Batch mode
+
+  In batch mode the machine runs without user interaction and as fast as
+  the host allows. The run ends after a given number of emulated seconds or
+  as soon as the guest signals the end of its workload, either by writing a
+  value to a long word in the first memory bank or by sending a string to a
+  serial port. The memory marker is checked together with the host events,
+  so the guest has to leave the value in place for a few milliseconds.
+
+  The long word of the memory marker also divides the run into phases. When
+  the guest writes four printable characters there, like 'DISK', a phase of
+  that name begins and the previous one ends. The phase before the first
+  name is called boot. This allows to measure several workloads in one run.
+
+  When the run ends a report is written in JSON format. It contains the
+  emulated and real time, the number of executed instructions and the
+  counters of the DMA channels, disks and network for the whole run and
+  for each phase, as well as the i860 and host reports.
+*/
+const char Batch_fileid[] = "Previous batch.c : " __DATE__ " " __TIME__;
+
+#include "main.h"
+#include "configuration.h"
+#include "cycInt.h"
+#include "dma.h"
+#include "ethernet.h"
+#include "host.h"
+#include "log.h"
+#include "m68000.h"
+#include "mo.h"
+#include "scsi.h"
+#include "worker.h"
+#include "batch.h"
+#include "dimension.hpp"
+
+#define BATCH_MAX_MARKER  256
+#define BATCH_MAX_PHASES  32
+#define BATCH_DMA_CHANNELS 12
+
+enum {
+	BATCH_RUNNING,
+	BATCH_EXIT_QUIT,        /* Quit by the user or the guest */
+	BATCH_EXIT_TIME,        /* Run time has elapsed */
+	BATCH_EXIT_WRITE,       /* Guest wrote the marker value */
+	BATCH_EXIT_SERIAL       /* Guest sent the marker string */
+};
+
+static const char *BatchExitNames[] = {
+	"running", "quit", "time", "write", "serial"
+};
+
+static const char *BatchDMANames[BATCH_DMA_CHANNELS] = {
+	"scsi", "sound_out", "disk", "sound_in", "printer", "scc",
+	"dsp", "enet_tx", "enet_rx", "video", "m2r", "r2m"
+};
+
+typedef struct {
+	Uint64 nCycles;
+	Uint64 nInstructions;
+	Uint64 nTicks;
+	Uint64 nDMA[BATCH_DMA_CHANNELS];
+	Uint64 nSCSIRead, nSCSIWritten;
+	Uint64 nMORead, nMOWritten;
+	Uint64 nEnetReceived, nEnetSent;
+} BATCH_COUNTERS;
+
+typedef struct {
+	char sName[8];
+	BATCH_COUNTERS Start;
+	BATCH_COUNTERS End;
+} BATCH_PHASE;
+
+static bool bBatchMode = false;
+static int nBatchExit = BATCH_RUNNING;
+static char sReportFileName[FILENAME_MAX];
+
+static double dRunTime = 0;         /* Seconds of emulated time, 0 = no limit */
+static bool bWriteMarker = false;
+static Uint32 nWriteAddr, nWriteValue;
+static Uint32 nMarkerValue;         /* Last value seen at the marker address */
+static char sSerialMarker[BATCH_MAX_MARKER];
+static int nSerialMarkerLen = 0;
+static char SerialHistory[BATCH_MAX_MARKER];
+
+/* The cycle counter restarts at every reset, so cycles are summed up here */
+static Uint64 nCycles;
+static Sint64 nLastCycles;
+
+static BATCH_COUNTERS RunStart;
+static BATCH_PHASE Phases[BATCH_MAX_PHASES];
+static int nPhases = 0;
+static bool bPhaseActive = false;
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Switch to batch mode.
+ */
+void Batch_Enable(void)
+{
+	bBatchMode = true;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Return true if the emulator runs in batch mode.
+ */
+bool Batch_IsActive(void)
+{
+	return bBatchMode;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Stop the run after the given number of emulated seconds.
+ */
+void Batch_SetRunTime(double dSeconds)
+{
+	dRunTime = dSeconds;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Stop the run when the guest writes nValue to the long word at nAddr.
+ * The address is checked against the memory configuration at the start of
+ * the run. Returns false if the address is not aligned.
+ */
+bool Batch_SetWriteMarker(Uint32 nAddr, Uint32 nValue)
+{
+	if (nAddr & 3)
+	{
+		Log_Printf(LOG_ERROR, "[Batch] Marker address $%08x is not aligned.\n", nAddr);
+		return false;
+	}
+	bWriteMarker = true;
+	nWriteAddr = nAddr;
+	nWriteValue = nValue;
+	return true;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Stop the run when the guest sends the given string to a serial port.
+ */
+bool Batch_SetSerialMarker(const char *psString)
+{
+	int nLen = strlen(psString);
+
+	if (nLen == 0 || nLen >= BATCH_MAX_MARKER)
+	{
+		Log_Printf(LOG_ERROR, "[Batch] Serial marker must have 1 to %d characters.\n", BATCH_MAX_MARKER - 1);
+		return false;
+	}
+	strcpy(sSerialMarker, psString);
+	nSerialMarkerLen = nLen;
+	memset(SerialHistory, 0, sizeof(SerialHistory));
+	return true;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Write the report to the given file instead of standard output.
+ */
+void Batch_SetReportFile(const char *psFileName)
+{
+	strncpy(sReportFileName, psFileName, sizeof(sReportFileName) - 1);
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Add the cycles since the last call to the total.
+ */
+static void Batch_CountCycles(void)
+{
+	Sint64 nDelta = nCyclesMainCounter - nLastCycles;
+
+	/* Counter was reset */
+	if (nDelta < 0)
+		nDelta = nCyclesMainCounter;
+	nCycles += nDelta;
+	nLastCycles = nCyclesMainCounter;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Take a snapshot of all counters.
+ */
+static void Batch_GetCounters(BATCH_COUNTERS *pCounters)
+{
+	int i;
+
+	Batch_CountCycles();
+	pCounters->nCycles = nCycles;
+	pCounters->nInstructions = nCpuInstructions;
+	pCounters->nTicks = SDL_GetPerformanceCounter();
+	for (i = 0; i < BATCH_DMA_CHANNELS; i++)
+		pCounters->nDMA[i] = nDMACompleted[i];
+	pCounters->nSCSIRead = nSCSIBlocksRead;
+	pCounters->nSCSIWritten = nSCSIBlocksWritten;
+	pCounters->nMORead = nMOSectorsRead;
+	pCounters->nMOWritten = nMOSectorsWritten;
+	pCounters->nEnetReceived = nEnetFramesReceived;
+	pCounters->nEnetSent = nEnetFramesSent;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * End the current phase, if there is one.
+ */
+static void Batch_EndPhase(const BATCH_COUNTERS *pCounters)
+{
+	if (!bPhaseActive)
+		return;
+	Phases[nPhases - 1].End = *pCounters;
+	bPhaseActive = false;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * End the current phase and begin a new one.
+ */
+static void Batch_BeginPhase(const char *psName)
+{
+	BATCH_COUNTERS Counters;
+
+	Batch_GetCounters(&Counters);
+	Batch_EndPhase(&Counters);
+	if (nPhases == BATCH_MAX_PHASES)
+	{
+		Log_Printf(LOG_WARN, "[Batch] Too many phases, ignoring phase '%s'.\n", psName);
+		return;
+	}
+	Log_Printf(LOG_WARN, "[Batch] Phase '%s' begins.\n", psName);
+	strcpy(Phases[nPhases].sName, psName);
+	Phases[nPhases].Start = Counters;
+	nPhases++;
+	bPhaseActive = true;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Begin a phase if the marker holds four printable characters.
+ */
+static void Batch_CheckPhase(Uint32 nValue)
+{
+	char sName[5];
+	int i;
+
+	for (i = 0; i < 4; i++)
+	{
+		sName[i] = nValue >> (24 - i * 8);
+		if (sName[i] < 0x20 || sName[i] > 0x7e)
+			return;
+	}
+	/* Trailing blanks are not part of the name */
+	for (sName[4] = '\0'; i > 0 && sName[i - 1] == ' '; i--)
+		sName[i - 1] = '\0';
+	if (i > 0)
+		Batch_BeginPhase(sName);
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Finish the run and stop the CPU core.
+ */
+static void Batch_Finish(int nExit)
+{
+	BATCH_COUNTERS Counters;
+
+	if (nBatchExit != BATCH_RUNNING)
+		return;
+	nBatchExit = nExit;
+	Batch_GetCounters(&Counters);
+	Batch_EndPhase(&Counters);
+	Log_Printf(LOG_WARN, "[Batch] Run finished (%s).\n", BatchExitNames[nExit]);
+	bQuitProgram = true;
+	M68000_SetSpecial(SPCFLAG_BRK);
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Start measuring. Called right before the CPU core is started.
+ */
+void Batch_Start(void)
+{
+	if (!bBatchMode)
+		return;
+
+	/* Nobody is there to confirm */
+	ConfigureParams.Log.bConfirmQuit = false;
+
+	nCycles = 0;
+	nLastCycles = nCyclesMainCounter;
+	Batch_GetCounters(&RunStart);
+	Log_Printf(LOG_WARN, "[Batch] Run started.\n");
+
+	if (!bWriteMarker)
+		return;
+
+	/* Reading memory bank 0 never causes a bus error */
+	if (nWriteAddr < 0x04000000 ||
+	    nWriteAddr - 0x04000000 >= (Uint32)ConfigureParams.Memory.nMemoryBankSize[0] * 1024 * 1024)
+	{
+		Log_Printf(LOG_ERROR, "[Batch] Marker address $%08x is not in memory bank 0.\n", nWriteAddr);
+		Batch_Finish(BATCH_EXIT_QUIT);
+		return;
+	}
+	nMarkerValue = get_long(nWriteAddr);
+	Batch_BeginPhase("boot");
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Check if the run is finished or a new phase begins. Called together
+ * with the host events.
+ */
+void Batch_Check(void)
+{
+	Uint32 nValue;
+
+	if (!bBatchMode || nBatchExit != BATCH_RUNNING)
+		return;
+
+	if (bWriteMarker)
+	{
+		nValue = get_long(nWriteAddr);
+		if (nValue == nWriteValue)
+		{
+			Batch_Finish(BATCH_EXIT_WRITE);
+			return;
+		}
+		if (nValue != nMarkerValue)
+		{
+			nMarkerValue = nValue;
+			Batch_CheckPhase(nValue);
+		}
+	}
+
+	Batch_CountCycles();
+	if (dRunTime > 0 && (double)nCycles / (ConfigureParams.System.nCpuFreq * 1000.0 * 1000.0) >= dRunTime)
+		Batch_Finish(BATCH_EXIT_TIME);
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Compare the output of the serial ports with the marker string.
+ */
+void Batch_SerialOutput(Uint8 val)
+{
+	if (!bBatchMode || nSerialMarkerLen == 0)
+		return;
+
+	memmove(SerialHistory, SerialHistory + 1, nSerialMarkerLen - 1);
+	SerialHistory[nSerialMarkerLen - 1] = val;
+	if (!memcmp(SerialHistory, sSerialMarker, nSerialMarkerLen))
+		Batch_Finish(BATCH_EXIT_SERIAL);
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Write a string with JSON escapes.
+ */
+static void Batch_WriteString(FILE *fp, const char *s)
+{
+	fputc('"', fp);
+	for (; *s; s++)
+	{
+		if (*s == '"' || *s == '\\')
+			fprintf(fp, "\\%c", *s);
+		else if ((unsigned char)*s < 0x20)
+			fprintf(fp, "\\u%04x", *s);
+		else
+			fputc(*s, fp);
+	}
+	fputc('"', fp);
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Write the difference of two sets of counters as JSON members.
+ */
+static void Batch_WriteCounters(FILE *fp, const char *psIndent,
+                                const BATCH_COUNTERS *pStart, const BATCH_COUNTERS *pEnd)
+{
+	double dEmuTime, dRealTime;
+	Uint64 nInstructions;
+	int i;
+
+	dEmuTime = (double)(pEnd->nCycles - pStart->nCycles) / (ConfigureParams.System.nCpuFreq * 1000.0 * 1000.0);
+	dRealTime = (double)(pEnd->nTicks - pStart->nTicks) / SDL_GetPerformanceFrequency();
+	if (dRealTime <= 0)
+		dRealTime = 1e-6;
+	nInstructions = pEnd->nInstructions - pStart->nInstructions;
+
+	fprintf(fp, "%s\"emulated_seconds\": %.6f,\n", psIndent, dEmuTime);
+	fprintf(fp, "%s\"real_seconds\": %.6f,\n", psIndent, dRealTime);
+	/* Same measure as the speed factor of Main_SpeedMsg */
+	fprintf(fp, "%s\"realtime_ratio\": %.4f,\n", psIndent, dEmuTime / dRealTime);
+	fprintf(fp, "%s\"cycles\": %"FMT_ll"u,\n", psIndent, (unsigned long long)(pEnd->nCycles - pStart->nCycles));
+	fprintf(fp, "%s\"instructions\": %"FMT_ll"u,\n", psIndent, (unsigned long long)nInstructions);
+	fprintf(fp, "%s\"mips\": %.3f,\n", psIndent, nInstructions / dRealTime / 1000000.0);
+
+	fprintf(fp, "%s\"dma\": {", psIndent);
+	for (i = 0; i < BATCH_DMA_CHANNELS; i++)
+		fprintf(fp, "%s \"%s\": %"FMT_ll"u", i ? "," : "", BatchDMANames[i],
+		        (unsigned long long)(pEnd->nDMA[i] - pStart->nDMA[i]));
+	fprintf(fp, " },\n");
+	fprintf(fp, "%s\"scsi\": { \"blocks_read\": %"FMT_ll"u, \"blocks_written\": %"FMT_ll"u },\n", psIndent,
+	        (unsigned long long)(pEnd->nSCSIRead - pStart->nSCSIRead),
+	        (unsigned long long)(pEnd->nSCSIWritten - pStart->nSCSIWritten));
+	fprintf(fp, "%s\"mo\": { \"sectors_read\": %"FMT_ll"u, \"sectors_written\": %"FMT_ll"u },\n", psIndent,
+	        (unsigned long long)(pEnd->nMORead - pStart->nMORead),
+	        (unsigned long long)(pEnd->nMOWritten - pStart->nMOWritten));
+	fprintf(fp, "%s\"ethernet\": { \"frames_received\": %"FMT_ll"u, \"frames_sent\": %"FMT_ll"u }", psIndent,
+	        (unsigned long long)(pEnd->nEnetReceived - pStart->nEnetReceived),
+	        (unsigned long long)(pEnd->nEnetSent - pStart->nEnetSent));
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Write the report of the run. Each worker writes to its own file, the
+ * number of the worker is appended to the name.
+ */
+void Batch_Report(void)
+{
+	char sFileName[FILENAME_MAX + 8];
+	BATCH_COUNTERS RunEnd;
+	double dRealTime, dHostTime;
+	FILE *fp = stdout;
+	int i;
+
+	if (!bBatchMode)
+		return;
+
+	if (nBatchExit == BATCH_RUNNING)
+		nBatchExit = BATCH_EXIT_QUIT;
+	Batch_GetCounters(&RunEnd);
+	Batch_EndPhase(&RunEnd);
+
+	if (sReportFileName[0])
+	{
+		if (Worker_GetIndex() > 0)
+			snprintf(sFileName, sizeof(sFileName), "%s.%d", sReportFileName, Worker_GetIndex());
+		else
+			strcpy(sFileName, sReportFileName);
+		fp = fopen(sFileName, "w");
+		if (!fp)
+		{
+			Log_Printf(LOG_ERROR, "[Batch] Unable to write report to %s.\n", sFileName);
+			return;
+		}
+	}
+
+	fprintf(fp, "{\n");
+	fprintf(fp, "  \"version\": ");
+	Batch_WriteString(fp, PROG_NAME);
+	fprintf(fp, ",\n  \"machine\": { \"type\": %d, \"turbo\": %s, \"color\": %s, \"cpu_mhz\": %d, \"dimension\": %s },\n",
+	        ConfigureParams.System.nMachineType,
+	        ConfigureParams.System.bTurbo ? "true" : "false",
+	        ConfigureParams.System.bColor ? "true" : "false",
+	        ConfigureParams.System.nCpuFreq,
+	        ConfigureParams.Dimension.board[0].bEnabled ? "true" : "false");
+	fprintf(fp, "  \"worker\": %d,\n", Worker_GetIndex());
+	fprintf(fp, "  \"exit\": \"%s\",\n", BatchExitNames[nBatchExit]);
+	Batch_WriteCounters(fp, "  ", &RunStart, &RunEnd);
+
+	host_time(&dRealTime, &dHostTime);
+	fprintf(fp, ",\n  \"i860\": ");
+	Batch_WriteString(fp, nd_reports(dRealTime, dHostTime));
+	fprintf(fp, ",\n  \"host\": ");
+	Batch_WriteString(fp, host_report(dRealTime, dHostTime));
+
+	fprintf(fp, ",\n  \"phases\": [");
+	for (i = 0; i < nPhases; i++)
+	{
+		fprintf(fp, "%s\n    {\n      \"name\": ", i ? "," : "");
+		Batch_WriteString(fp, Phases[i].sName);
+		fprintf(fp, ",\n");
+		Batch_WriteCounters(fp, "      ", &Phases[i].Start, &Phases[i].End);
+		fprintf(fp, "\n    }");
+	}
+	fprintf(fp, "%s]\n}\n", nPhases ? "\n  " : "");
+
+	if (fp == stdout)
+		fflush(fp);
+	else
+		fclose(fp);
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Return the exit status of the run: 1 if the guest never reached a
+ * marker that was set, 0 otherwise.
+ */
+int Batch_ExitStatus(void)
+{
+	if (!bBatchMode)
+		return 0;
+	if ((bWriteMarker || nSerialMarkerLen) &&
+	    nBatchExit != BATCH_EXIT_WRITE && nBatchExit != BATCH_EXIT_SERIAL)
+		return 1;
+	return 0;
+}
@@ -3,6 +3,7 @@
 #include "m68000.h"
 #include "sysdeps.h"
 #include "bmap.h"
+#include "memorySnapShot.h"
 
 
 /* NeXT bmap chip emulation */
@@ -163,3 +164,8 @@ void bmap_init(void) {
     }
     bmap_tpe_select = 0;
 }
+
+void bmap_MemorySnapShot_Capture(bool bSave) {
+    MemorySnapShot_Store(NEXTbmap, sizeof(NEXTbmap));
+    MemorySnapShot_Store(&bmap_tpe_select, sizeof(bmap_tpe_select));
+}
@@ -65,6 +65,66 @@ const char CfgOpts_fileid[] = "Hatari cfgopts.c : " __DATE__ " " __TIME__;
 #include "str.h"
 
 
+/**
+ * Set the option 'code' from the string 'value'. Returns 1 if the option
+ * was set, 0 if there is no such option and -1 if its type is unknown.
+ */
+int set_config_value(const struct Config_Tag configs[], const char *code, const char *value)
+{
+	const struct Config_Tag *ptr;
+
+	for (ptr = configs; ptr->buf; ++ptr)    /* scan for token */
+	{
+		if (strcmp(code, ptr->code))
+			continue;
+
+		switch (ptr->type)      /* check type */
+		{
+			case Bool_Tag:
+				if (!strcasecmp(value,"FALSE"))
+					*((bool *)(ptr->buf)) = false;
+				else if (!strcasecmp(value,"TRUE"))
+					*((bool *)(ptr->buf)) = true;
+				break;
+
+			case Char_Tag:
+				sscanf(value, "%c", (char *)(ptr->buf));
+				break;
+
+			case Short_Tag:
+				sscanf(value, "%hd", (short *)(ptr->buf));
+				break;
+
+			case Int_Tag:
+				sscanf(value, "%d", (int *)(ptr->buf));
+				break;
+
+			case Long_Tag:
+				sscanf(value, "%ld", (long *)(ptr->buf));
+				break;
+
+			case Float_Tag:
+				sscanf(value, "%g", (float *)ptr->buf);
+				break;
+
+			case Double_Tag:
+				sscanf(value, "%lg", (double *)ptr->buf);
+				break;
+
+			case String_Tag:
+				strcpy((char *)ptr->buf, value);
+				break;
+
+			case Error_Tag:
+			default:
+				return -1;
+		}
+		return 1;
+	}
+	return 0;
+}
+
+
 /**
  * ---------------------------------------------------------------------/
  * /   reads from an input configuration (INI) file.
@@ -80,7 +140,6 @@ const char CfgOpts_fileid[] = "Hatari cfgopts.c : " __DATE__ " " __TIME__;
  */
 int input_config(const char *filename, const struct Config_Tag configs[], const char *header)
 {
-	const struct Config_Tag *ptr;
 	int count=0, lineno=0;
 	FILE *file;
 	char *fptr,*tok,*next;
@@ -118,56 +177,15 @@ int input_config(const char *filename, const struct Config_Tag configs[], const
             next = Str_Trim(strtok(NULL, "="));     /* get actual config information */
             if (next == NULL)
                 continue;
-            for (ptr = configs; ptr->buf; ++ptr)    /* scan for token */
+            switch (set_config_value(configs, tok, next))
             {
-                if (!strcmp(tok, ptr->code))    /* got a match? */
-                {
+                case 1:
                     count++;
-                    switch (ptr->type)      /* check type */
-                    {
-                        case Bool_Tag:
-                            if (!strcasecmp(next,"FALSE"))
-                                *((bool *)(ptr->buf)) = false;
-                            else if (!strcasecmp(next,"TRUE"))
-                                *((bool *)(ptr->buf)) = true;
-                            break;
-
-                        case Char_Tag:
-                            sscanf(next, "%c", (char *)(ptr->buf));
-                            break;
-
-                        case Short_Tag:
-                            sscanf(next, "%hd", (short *)(ptr->buf));
-                            break;
-
-                        case Int_Tag:
-                            sscanf(next, "%d", (int *)(ptr->buf));
-                            break;
-
-                        case Long_Tag:
-                            sscanf(next, "%ld", (long *)(ptr->buf));
-                            break;
-
-                        case Float_Tag:
-                            sscanf(next, "%g", (float *)ptr->buf);
-                            break;
-
-                        case Double_Tag:
-                            sscanf(next, "%lg", (double *)ptr->buf);
-                            break;
-
-                        case String_Tag:
-                            strcpy((char *)ptr->buf, next);
-                            break;
-
-                        case Error_Tag:
-                        default:
-                            count--;
-                            printf("Error in Config file %s on line %d\n", filename, lineno);
-                            break;
-                    }
-				}
-			}
+                    break;
+                case -1:
+                    printf("Error in Config file %s on line %d\n", filename, lineno);
+                    break;
+            }
 		}
 		while (fptr != NULL && fptr[0] != '[');
 
@@ -109,9 +109,10 @@ bool Change_DoNeedReset(CNF_PARAMS *current, CNF_PARAMS *changed)
         return true;
     }
 	
-	/* Did we change DSP type or memory? */
+	/* Did we change DSP type, memory or threading? */
 	if ((current->System.nDSPType != changed->System.nDSPType) ||
-		(current->System.bDSPMemoryExpansion != changed->System.bDSPMemoryExpansion)) {
+		(current->System.bDSPMemoryExpansion != changed->System.bDSPMemoryExpansion) ||
+		(current->System.bDSPThread != changed->System.bDSPThread)) {
 		printf("dsp type reset\n");
 		return true;
 	}
@@ -16,9 +16,11 @@ const char Configuration_fileid[] = "Hatari configuration.c : " __DATE__ " " __T
 #include "main.h"
 #include "configuration.h"
 #include "cfgopts.h"
+#include "change.h"
 #include "file.h"
 #include "log.h"
 #include "m68000.h"
+#include "memorySnapShot.h"
 #include "paths.h"
 #include "screen.h"
 #include "video.h"
@@ -35,6 +37,8 @@ static const struct Config_Tag configs_Log[] =
 	{ "nTextLogLevel", Int_Tag, &ConfigureParams.Log.nTextLogLevel },
 	{ "nAlertDlgLogLevel", Int_Tag, &ConfigureParams.Log.nAlertDlgLogLevel },
 	{ "bConfirmQuit", Bool_Tag, &ConfigureParams.Log.bConfirmQuit },
+	{ "sJournalFileName", String_Tag, ConfigureParams.Log.sJournalFileName },
+	{ "nJournalMode", Int_Tag, &ConfigureParams.Log.nJournalMode },
 	{ NULL , Error_Tag, NULL }
 };
 
@@ -100,6 +104,8 @@ static const struct Config_Tag configs_ShortCutWithMod[] =
     { "keyDebuggerI860",Int_Tag, &ConfigureParams.Shortcut.withModifier[SHORTCUT_DEBUG_I860] },
 	{ "keyQuit",        Int_Tag, &ConfigureParams.Shortcut.withModifier[SHORTCUT_QUIT] },
 	{ "keyDimension",   Int_Tag, &ConfigureParams.Shortcut.withModifier[SHORTCUT_DIMENSION] },
+	{ "keySaveMem",     Int_Tag, &ConfigureParams.Shortcut.withModifier[SHORTCUT_SAVEMEM] },
+	{ "keyLoadMem",     Int_Tag, &ConfigureParams.Shortcut.withModifier[SHORTCUT_LOADMEM] },
 	{ NULL , Error_Tag, NULL }
 };
 
@@ -118,6 +124,8 @@ static const struct Config_Tag configs_ShortCutWithoutMod[] =
     { "keyDebuggerI860",Int_Tag, &ConfigureParams.Shortcut.withoutModifier[SHORTCUT_DEBUG_I860] },
 	{ "keyQuit",        Int_Tag, &ConfigureParams.Shortcut.withoutModifier[SHORTCUT_QUIT] },
 	{ "keyDimension",   Int_Tag, &ConfigureParams.Shortcut.withoutModifier[SHORTCUT_DIMENSION] },
+	{ "keySaveMem",     Int_Tag, &ConfigureParams.Shortcut.withoutModifier[SHORTCUT_SAVEMEM] },
+	{ "keyLoadMem",     Int_Tag, &ConfigureParams.Shortcut.withoutModifier[SHORTCUT_LOADMEM] },
 	{ NULL , Error_Tag, NULL }
 };
 
@@ -138,6 +146,9 @@ static const struct Config_Tag configs_Memory[] =
 	{ "nMemoryBankSize2", Int_Tag, &ConfigureParams.Memory.nMemoryBankSize[2] },
 	{ "nMemoryBankSize3", Int_Tag, &ConfigureParams.Memory.nMemoryBankSize[3] },
     { "nMemorySpeed", Int_Tag, &ConfigureParams.Memory.nMemorySpeed },
+	{ "szMemoryCaptureFileName", String_Tag, ConfigureParams.Memory.szMemoryCaptureFileName },
+	{ "bAutoSave", Bool_Tag, &ConfigureParams.Memory.bAutoSave },
+	{ "nForkWorkers", Int_Tag, &ConfigureParams.Memory.nForkWorkers },
 	{ NULL , Error_Tag, NULL }
 };
 
@@ -194,6 +205,8 @@ static const struct Config_Tag configs_SCSI[] =
     { "bWriteProtected6", Bool_Tag, &ConfigureParams.SCSI.target[6].bWriteProtected },
 
     { "nWriteProtection", Int_Tag, &ConfigureParams.SCSI.nWriteProtection },
+    { "bFastTransfer", Bool_Tag, &ConfigureParams.SCSI.bFastTransfer },
+    { "nFastTransferRate", Int_Tag, &ConfigureParams.SCSI.nFastTransferRate },
     
     { NULL , Error_Tag, NULL }
 };
@@ -211,6 +224,8 @@ static const struct Config_Tag configs_MO[] =
     { "bDiskInserted1", Bool_Tag, &ConfigureParams.MO.drive[1].bDiskInserted },
     { "bWriteProtected1", Bool_Tag, &ConfigureParams.MO.drive[1].bWriteProtected },
 
+    { "nTiming", Int_Tag, &ConfigureParams.MO.nTiming },
+
 	{ NULL , Error_Tag, NULL }
 };
 
@@ -227,6 +242,8 @@ static const struct Config_Tag configs_Floppy[] =
     { "bDiskInserted1", Bool_Tag, &ConfigureParams.Floppy.drive[1].bDiskInserted },
     { "bWriteProtected1", Bool_Tag, &ConfigureParams.Floppy.drive[1].bWriteProtected },
     
+    { "nTiming", Int_Tag, &ConfigureParams.Floppy.nTiming },
+    
     { NULL , Error_Tag, NULL }
 };
 
@@ -265,6 +282,7 @@ static const struct Config_Tag configs_Printer[] =
 {
 	{ "bPrinterConnected", Bool_Tag, &ConfigureParams.Printer.bPrinterConnected },
 	{ "nPaperSize", Int_Tag, &ConfigureParams.Printer.nPaperSize },
+	{ "nOutputFormat", Int_Tag, &ConfigureParams.Printer.nOutputFormat },
 	{ "szPrintToFileName", String_Tag, ConfigureParams.Printer.szPrintToFileName },
 	{ NULL , Error_Tag, NULL }
 };
@@ -285,6 +303,7 @@ static const struct Config_Tag configs_System[] =
 	{ "bRealtime", Bool_Tag, &ConfigureParams.System.bRealtime },
 	{ "nDSPType", Int_Tag, &ConfigureParams.System.nDSPType },
 	{ "bDSPMemoryExpansion", Bool_Tag, &ConfigureParams.System.bDSPMemoryExpansion },
+	{ "bDSPThread", Bool_Tag, &ConfigureParams.System.bDSPThread },
 	{ "bRealTimeClock", Bool_Tag, &ConfigureParams.System.bRealTimeClock },
     { "n_FPUType", Int_Tag, &ConfigureParams.System.n_FPUType },
     { "bCompatibleFPU", Bool_Tag, &ConfigureParams.System.bCompatibleFPU },
@@ -323,6 +342,34 @@ static const struct Config_Tag configs_Dimension[] =
     { NULL , Error_Tag, NULL }
 };
 
+/* Sections for setting single options by name */
+static const struct {
+	const char *name;
+	const struct Config_Tag *configs;
+} configs_Sections[] =
+{
+	{ "Log", configs_Log },
+	{ "ConfigDialog", configs_ConfigDialog },
+	{ "Debugger", configs_Debugger },
+	{ "Screen", configs_Screen },
+	{ "Keyboard", configs_Keyboard },
+	{ "ShortcutsWithModifiers", configs_ShortCutWithMod },
+	{ "ShortcutsWithoutModifiers", configs_ShortCutWithoutMod },
+	{ "Mouse", configs_Mouse },
+	{ "Sound", configs_Sound },
+	{ "Memory", configs_Memory },
+	{ "Boot", configs_Boot },
+	{ "HardDisk", configs_SCSI },
+	{ "MagnetoOptical", configs_MO },
+	{ "Floppy", configs_Floppy },
+	{ "Ethernet", configs_Ethernet },
+	{ "ROM", configs_Rom },
+	{ "Printer", configs_Printer },
+	{ "System", configs_System },
+	{ "Dimension", configs_Dimension },
+	{ NULL, NULL }
+};
+
 /*-----------------------------------------------------------------------*/
 /**
  * Set default configuration values.
@@ -346,6 +393,9 @@ void Configuration_SetDefault(void)
 	ConfigureParams.Log.nTextLogLevel = LOG_TODO;
 	ConfigureParams.Log.nAlertDlgLogLevel = LOG_ERROR;
 	ConfigureParams.Log.bConfirmQuit = true;
+	sprintf(ConfigureParams.Log.sJournalFileName, "%s%cprevious.jnl",
+	        psHomeDir, PATHSEP);
+	ConfigureParams.Log.nJournalMode = JOURNAL_OFF;
     
     /* Set defaults for config dialog */
 	ConfigureParams.ConfigDialog.bShowConfigDialogAtStartup = true;
@@ -373,6 +423,8 @@ void Configuration_SetDefault(void)
         ConfigureParams.SCSI.target[i].bWriteProtected = false;
     }
     ConfigureParams.SCSI.nWriteProtection = WRITEPROT_OFF;
+    ConfigureParams.SCSI.bFastTransfer = false;
+    ConfigureParams.SCSI.nFastTransferRate = 20480;
     
     /* Set defaults for MO drives */
     for (i = 0; i < MO_MAX_DRIVES; i++) {
@@ -381,6 +433,7 @@ void Configuration_SetDefault(void)
         ConfigureParams.MO.drive[i].bDiskInserted = false;
         ConfigureParams.MO.drive[i].bWriteProtected = false;
     }
+    ConfigureParams.MO.nTiming = TIMING_ACCURATE;
     
     /* Set defaults for floppy drives */
     for (i = 0; i < FLP_MAX_DRIVES; i++) {
@@ -389,6 +442,7 @@ void Configuration_SetDefault(void)
         ConfigureParams.Floppy.drive[i].bDiskInserted = false;
         ConfigureParams.Floppy.drive[i].bWriteProtected = false;
     }
+    ConfigureParams.Floppy.nTiming = TIMING_ACCURATE;
     
     /* Set defaults for Ethernet */
     ConfigureParams.Ethernet.bEthernetConnected = false;
@@ -425,15 +479,22 @@ void Configuration_SetDefault(void)
 	ConfigureParams.Shortcut.withModifier[SHORTCUT_SOUND]         = SDLK_s;
 	ConfigureParams.Shortcut.withModifier[SHORTCUT_QUIT]          = SDLK_q;
 	ConfigureParams.Shortcut.withModifier[SHORTCUT_DIMENSION]     = SDLK_n;
+	ConfigureParams.Shortcut.withModifier[SHORTCUT_SAVEMEM]       = SDLK_k;
+	ConfigureParams.Shortcut.withModifier[SHORTCUT_LOADMEM]       = SDLK_l;
 
 	/* Set defaults for Memory */
 	memset(ConfigureParams.Memory.nMemoryBankSize, 16, 
            sizeof(ConfigureParams.Memory.nMemoryBankSize)); /* 64 MiB */
     ConfigureParams.Memory.nMemorySpeed = MEMORY_100NS;
+	sprintf(ConfigureParams.Memory.szMemoryCaptureFileName, "%s%cprevious.sav",
+	        psHomeDir, PATHSEP);
+	ConfigureParams.Memory.bAutoSave = false;
+	ConfigureParams.Memory.nForkWorkers = 0;
 
 	/* Set defaults for Printer */
 	ConfigureParams.Printer.bPrinterConnected = false;
 	ConfigureParams.Printer.nPaperSize = PAPER_A4;
+	ConfigureParams.Printer.nOutputFormat = PRINT_PNG;
 	sprintf(ConfigureParams.Printer.szPrintToFileName, "%s%c",
 	        psHomeDir, PATHSEP);
 
@@ -475,6 +536,7 @@ void Configuration_SetDefault(void)
 	ConfigureParams.System.bRealtime = false;
 	ConfigureParams.System.nDSPType = DSP_TYPE_EMU;
 	ConfigureParams.System.bDSPMemoryExpansion = false;
+	ConfigureParams.System.bDSPThread = false;
 	ConfigureParams.System.bRealTimeClock = true;
     ConfigureParams.System.n_FPUType = FPU_68882;
     ConfigureParams.System.bCompatibleFPU = true;
@@ -552,6 +614,9 @@ void Configuration_Apply(bool bReset) {
     
     /* Make sure twisted pair ethernet is disabled on 68030 Cube */
     Configuration_CheckEthernetSettings();
+    
+    /* Make sure timing does not depend on the host while journaling */
+    Configuration_CheckJournalSettings();
 	
 	/* Clean file and directory names */    
     File_MakeAbsoluteName(ConfigureParams.Rom.szRom030FileName);
@@ -578,6 +643,7 @@ void Configuration_Apply(bool bReset) {
 	/* make path names absolute, but handle special file names */
 	File_MakeAbsoluteSpecialName(ConfigureParams.Log.sLogFileName);
 	File_MakeAbsoluteSpecialName(ConfigureParams.Log.sTraceFileName);
+	File_MakeAbsoluteName(ConfigureParams.Log.sJournalFileName);
 }
 
 
@@ -788,6 +854,14 @@ void Configuration_CheckEthernetSettings(void) {
     }
 }
 
+void Configuration_CheckJournalSettings(void) {
+    if (ConfigureParams.Log.nJournalMode != JOURNAL_OFF) {
+        ConfigureParams.System.bRealtime = false;
+        ConfigureParams.System.bDSPThread = false;
+        ConfigureParams.Dimension.bI860Thread = false;
+    }
+}
+
 
 /*-----------------------------------------------------------------------*/
 /**
@@ -845,6 +919,25 @@ void Configuration_Load(const char *psFileName)
 }
 
 
+/*-----------------------------------------------------------------------*/
+/**
+ * Set a single option as it would be written in the configuration file.
+ * The section name is given without brackets. Returns false if there is
+ * no such option.
+ */
+bool Configuration_SetValue(const char *psSection, const char *psKey, const char *psValue)
+{
+	int i;
+
+	for (i = 0; configs_Sections[i].name; i++)
+	{
+		if (!strcasecmp(psSection, configs_Sections[i].name))
+			return set_config_value(configs_Sections[i].configs, psKey, psValue) > 0;
+	}
+	return false;
+}
+
+
 /*-----------------------------------------------------------------------*/
 /**
  * Save a settings section to configuration file
@@ -893,3 +986,34 @@ void Configuration_Save(void)
     Configuration_SaveSection(sConfigFileName, configs_Dimension, "[Dimension]");
 }
 
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Save/restore the configuration of the emulated machine to/from memory
+ * snapshot. Restoring it resets the machine, so the configuration must be
+ * the first part of a snapshot.
+ */
+void Configuration_MemorySnapShot_Capture(bool bSave)
+{
+	static CNF_PARAMS SnapShotParams;
+
+	SnapShotParams = ConfigureParams;
+
+	MemorySnapShot_Store(&SnapShotParams.System, sizeof(SnapShotParams.System));
+	MemorySnapShot_Store(SnapShotParams.Memory.nMemoryBankSize, sizeof(SnapShotParams.Memory.nMemoryBankSize));
+	MemorySnapShot_Store(&SnapShotParams.Memory.nMemorySpeed, sizeof(SnapShotParams.Memory.nMemorySpeed));
+	MemorySnapShot_Store(&SnapShotParams.Boot, sizeof(SnapShotParams.Boot));
+	MemorySnapShot_Store(&SnapShotParams.Rom, sizeof(SnapShotParams.Rom));
+	MemorySnapShot_Store(&SnapShotParams.SCSI, sizeof(SnapShotParams.SCSI));
+	MemorySnapShot_Store(&SnapShotParams.MO, sizeof(SnapShotParams.MO));
+	MemorySnapShot_Store(&SnapShotParams.Floppy, sizeof(SnapShotParams.Floppy));
+	MemorySnapShot_Store(&SnapShotParams.Ethernet, sizeof(SnapShotParams.Ethernet));
+	MemorySnapShot_Store(&SnapShotParams.Dimension, sizeof(SnapShotParams.Dimension));
+
+	if (!bSave)
+	{
+		/* Disk images are opened and the machine is reset */
+		Change_CopyChangedParamsToConfiguration(&ConfigureParams, &SnapShotParams, true);
+	}
+}
+
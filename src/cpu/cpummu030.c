@@ -39,6 +39,7 @@
 #include "memory.h"
 #include "newcpu.h"
 #include "cpummu030.h"
+#include "memorySnapShot.h"
 
 #define MMU030_OP_DBG_MSG 0
 #define MMU030_ATC_DBG_MSG 0
@@ -58,6 +59,9 @@ static int bBusErrorReadWrite;
 static int atcindextable[32];
 static int tt_enabled;
 
+/* Translation disabled, accesses go directly to physical memory */
+bool mmu030_direct = true;
+
 int mmu030_idx;
 
 uae_u32 mm030_stageb_address;
@@ -780,12 +784,14 @@ bool mmu030_decode_tc(uae_u32 TC)
 		if (!mmu030.enabled)
 			mmu030_do_fake_prefetch();
         mmu030.enabled = true;
+        mmu030_direct = false;
     } else {
 		if (mmu030.enabled) {
 			mmu030_do_fake_prefetch();
 			write_log(_T("MMU disabled PC=%08x\n"), M68K_GETPC);
 		}
         mmu030.enabled = false;
+        mmu030_direct = true;
         return false;
     }
     
@@ -2311,6 +2317,7 @@ void mmu030_reset(int hardreset)
 {
     /* A CPU reset causes the E-bits of TC and TT registers to be zeroed. */
     mmu030.enabled = false;
+    mmu030_direct = true;
 	regs.mmu_page_size = 0;
 	tc_030 &= ~TC_ENABLE_TRANSLATION;
 	tt0_030 &= ~TT_ENABLE;
@@ -2324,6 +2331,21 @@ void mmu030_reset(int hardreset)
 	mmu030_set_funcs();
 }
 
+/* Save/restore MMU registers and ATC to/from memory snapshot */
+void mmu030_MemorySnapShot_Capture(bool bSave)
+{
+	MemorySnapShot_Store(&srp_030, sizeof(srp_030));
+	MemorySnapShot_Store(&crp_030, sizeof(crp_030));
+	MemorySnapShot_Store(&tt0_030, sizeof(tt0_030));
+	MemorySnapShot_Store(&tt1_030, sizeof(tt1_030));
+	MemorySnapShot_Store(&tc_030, sizeof(tc_030));
+	MemorySnapShot_Store(&mmusr_030, sizeof(mmusr_030));
+	MemorySnapShot_Store(&mmu030, sizeof(mmu030));
+	MemorySnapShot_Store(atcindextable, sizeof(atcindextable));
+	MemorySnapShot_Store(&tt_enabled, sizeof(tt_enabled));
+	MemorySnapShot_Store(&mmu030_direct, sizeof(mmu030_direct));
+}
+
 void mmu030_set_funcs(void)
 {
 	if (currprefs.mmu_model != 68030)
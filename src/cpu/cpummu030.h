@@ -10,6 +10,7 @@ extern uae_u16 mmusr_030;
 #define MAX_MMU030_ACCESS 10
 extern uae_u32 mm030_stageb_address;
 extern int mmu030_idx;
+extern bool mmu030_direct;
 extern bool mmu030_retry;
 extern int mmu030_opcode, mmu030_opcode_stageb;
 extern int mmu030_fake_prefetch;
@@ -68,6 +69,7 @@ void mmu030_flush_atc_page(uaecptr logical_addr);
 void mmu030_flush_atc_page_fc(uaecptr logical_addr, uae_u32 fc_base, uae_u32 fc_mask);
 void mmu030_flush_atc_all(void);
 void mmu030_reset(int hardreset);
+void mmu030_MemorySnapShot_Capture(bool bSave);
 void mmu030_set_funcs(void);
 uaecptr mmu030_translate(uaecptr addr, bool super, bool data, bool write);
 
@@ -106,11 +108,16 @@ static ALWAYS_INLINE uae_u32 uae_mmu030_get_ilong(uaecptr addr)
 
 	if (unlikely(is_unaligned(addr, 4)))
 		return mmu030_get_ilong_unaligned(addr, fc, 0);
+	if (likely(mmu030_direct))
+		return phys_get_long(addr);
 	return mmu030_get_ilong(addr, fc);
 }
 static ALWAYS_INLINE uae_u16 uae_mmu030_get_iword(uaecptr addr)
 {
     uae_u32 fc = (regs.s ? 4 : 0) | 2;
+
+	if (likely(mmu030_direct))
+		return phys_get_word(addr);
 	return mmu030_get_iword(addr, fc);
 }
 static ALWAYS_INLINE uae_u16 uae_mmu030_get_ibyte(uaecptr addr)
@@ -125,6 +132,8 @@ static ALWAYS_INLINE uae_u32 uae_mmu030_get_long(uaecptr addr)
 
 	if (unlikely(is_unaligned(addr, 4)))
 		return mmu030_get_long_unaligned(addr, fc, 0);
+	if (likely(mmu030_direct))
+		return phys_get_long(addr);
 	return mmu030_get_long(addr, fc);
 }
 static ALWAYS_INLINE uae_u16 uae_mmu030_get_word(uaecptr addr)
@@ -133,12 +142,16 @@ static ALWAYS_INLINE uae_u16 uae_mmu030_get_word(uaecptr addr)
 
 	if (unlikely(is_unaligned(addr, 2)))
 		return mmu030_get_word_unaligned(addr, fc, 0);
+	if (likely(mmu030_direct))
+		return phys_get_word(addr);
 	return mmu030_get_word(addr, fc);
 }
 static ALWAYS_INLINE uae_u8 uae_mmu030_get_byte(uaecptr addr)
 {
     uae_u32 fc = (regs.s ? 4 : 0) | 1;
 
+	if (likely(mmu030_direct))
+		return phys_get_byte(addr);
 	return mmu030_get_byte(addr, fc);
 }
 static ALWAYS_INLINE void uae_mmu030_put_long(uaecptr addr, uae_u32 val)
@@ -147,6 +160,8 @@ static ALWAYS_INLINE void uae_mmu030_put_long(uaecptr addr, uae_u32 val)
     
 	if (unlikely(is_unaligned(addr, 4)))
 		mmu030_put_long_unaligned(addr, val, fc, 0);
+	else if (likely(mmu030_direct))
+		phys_put_long(addr, val);
 	else
 		mmu030_put_long(addr, val, fc);
 }
@@ -156,6 +171,8 @@ static ALWAYS_INLINE void uae_mmu030_put_word(uaecptr addr, uae_u16 val)
 
 	if (unlikely(is_unaligned(addr, 2)))
 		mmu030_put_word_unaligned(addr, val, fc, 0);
+	else if (likely(mmu030_direct))
+		phys_put_word(addr, val);
 	else
 		mmu030_put_word(addr, val, fc);
 }
@@ -163,7 +180,10 @@ static ALWAYS_INLINE void uae_mmu030_put_byte(uaecptr addr, uae_u8 val)
 {
     uae_u32 fc = (regs.s ? 4 : 0) | 1;
 
-	mmu030_put_byte(addr, val, fc);
+	if (likely(mmu030_direct))
+		phys_put_byte(addr, val);
+	else
+		mmu030_put_byte(addr, val, fc);
 }
 
 static ALWAYS_INLINE uae_u32 sfc030_get_long(uaecptr addr)
@@ -13,9 +13,29 @@
 #define FPP_H
 
 #include <softfloat.h>
+#include <float.h>
 
 float_ctrl fp_ctrl;
 
+/* Host FPU fast path for division and square root. The x87 unit uses the
+ * same extended format as the 68882. The host result is used in round to
+ * nearest extended precision mode without exception enables, when operands
+ * and result are normal or zero. Reading the x87 status word is slow, so
+ * inexact results are detected by multiplying back the mantissas. Everything
+ * else is left to softfloat. Add, subtract and multiply stay in softfloat,
+ * they are about as fast there as on the host. */
+#if defined(__x86_64__) && defined(__GNUC__) && LDBL_MANT_DIG == 64
+#define FPP_HOST_FASTPATH 1
+#endif
+
+#define FP_HOST_DIV     0
+#define FP_HOST_SQRT    1
+
+#if FPP_HOST_FASTPATH
+static bool    fp_host_enabled = false;
+static uae_u16 fp_host_cw = 0;
+#endif
+
 #define	FPCR_ROUNDING_MODE	0x00000030
 #define	FPCR_ROUND_NEAR		0x00000000
 #define	FPCR_ROUND_ZERO		0x00000010
@@ -34,6 +54,9 @@ extern uae_u32 fpp_get_fpsr (void);
 STATIC_INLINE void init_fp_mode(int fpu_model)
 {
     float_init(&fp_ctrl);
+#if FPP_HOST_FASTPATH
+    __asm__ volatile ("fnstcw %0" : "=m" (fp_host_cw));
+#endif
     
     if (fpu_model == 68040) {
         set_special_flags(cmp_signed_nan, &fp_ctrl);
@@ -76,6 +99,16 @@ STATIC_INLINE void set_fp_mode(uae_u32 mode_control)
             set_float_rounding_mode(float_round_up, &fp_ctrl);
             break;
     }
+
+#if FPP_HOST_FASTPATH
+    /* The host is only used in its default mode, round to nearest with
+     * extended precision. Single and double precision also narrow the
+     * exponent range and exception handlers need softfloat's internals. */
+    fp_host_enabled = !(mode_control & 0xff00) &&
+                      (mode_control & FPCR_ROUNDING_PRECISION) == FPCR_PRECISION_EXTENDED &&
+                      (mode_control & FPCR_ROUNDING_MODE) == FPCR_ROUND_NEAR &&
+                      (fp_host_cw & 0x0f3f) == 0x033f;
+#endif
 }
 STATIC_INLINE void get_fp_status(uae_u32 *status)
 {
@@ -439,6 +472,79 @@ STATIC_INLINE void fp_round(fptype *a)
     }
 }
 
+#if FPP_HOST_FASTPATH
+typedef union {
+    long double v;
+    struct {
+        uae_u64 low;
+        uae_u16 high;
+    } x;
+} fp_host_extended;
+
+STATIC_INLINE bool fp_is_host_extended(uae_u16 high, uae_u64 low)
+{
+    int exp = high & 0x7fff;
+
+    if (exp == 0)
+        return low == 0;
+    return exp != 0x7fff && (low & LIT64(0x8000000000000000));
+}
+
+/* Returns false if softfloat has to do the operation */
+STATIC_INLINE bool fp_host_arithmetic(fptype *a, fptype *b, int op)
+{
+    fp_host_extended x, y, r;
+    unsigned __int128 p, m;
+    int exp;
+
+    if (!fp_host_enabled)
+        return false;
+    if (!fp_is_host_extended(b->high, b->low))
+        return false;
+
+    y.v = 0.0L;
+    y.x.low = b->low;
+    y.x.high = b->high;
+
+    if (op == FP_HOST_DIV) {
+        /* Division by zero sets flags, let softfloat handle it */
+        if (!fp_is_host_extended(a->high, a->low) || b->low == 0)
+            return false;
+        x.v = 0.0L;
+        x.x.low = a->low;
+        x.x.high = a->high;
+        r.v = x.v / y.v;
+        /* Exact if quotient times divisor gives back the dividend */
+        p = (unsigned __int128)r.x.low * b->low;
+        m = a->low;
+    } else {
+        /* Square root of a negative number is invalid */
+        if ((b->high & 0x8000) && b->low)
+            return false;
+        r.v = __builtin_sqrtl(y.v);
+        p = (unsigned __int128)r.x.low * r.x.low;
+        m = b->low;
+    }
+
+    /* Results must not underflow or overflow, zero is only exact for zero input */
+    exp = r.x.high & 0x7fff;
+    if (r.x.low) {
+        if (exp <= 1 || exp >= 0x7fff)
+            return false;
+        if (p != (m << 63) && p != (m << 64))
+            set_float_exception_flags(get_float_exception_flags(&fp_ctrl) | float_flag_inexact, &fp_ctrl);
+    } else if (m) {
+        return false;
+    }
+
+    a->low = r.x.low;
+    a->high = r.x.high;
+    return true;
+}
+#else
+#define fp_host_arithmetic(a, b, op) false
+#endif
+
 /* Arithmetic functions */
 STATIC_INLINE void fp_move(fptype *a, fptype *b)
 {
@@ -454,6 +560,8 @@ STATIC_INLINE void fp_intrz(fptype *a, fptype *b)
 }
 STATIC_INLINE void fp_sqrt(fptype *a, fptype *b)
 {
+    if (fp_host_arithmetic(a, b, FP_HOST_SQRT))
+        return;
     *a = floatx80_sqrt(*b, &fp_ctrl);
 }
 STATIC_INLINE void fp_abs(fptype *a, fptype *b)
@@ -474,6 +582,8 @@ STATIC_INLINE void fp_getman(fptype *a, fptype *b)
 }
 STATIC_INLINE void fp_div(fptype *a, fptype *b)
 {
+    if (fp_host_arithmetic(a, b, FP_HOST_DIV))
+        return;
     *a = floatx80_div(*a, *b, &fp_ctrl);
 }
 STATIC_INLINE void fp_mod(fptype *a, fptype *b, uae_u64 *q, uae_s8 *s)
@@ -27,6 +27,7 @@ const char Memory_fileid[] = "Previous memory.c : " __DATE__ " " __TIME__;
 #include "reset.h"
 #include "m68000.h"
 #include "configuration.h"
+#include "memorySnapShot.h"
 #include "NextBus.hpp"
 
 #include "newcpu.h"
@@ -570,46 +571,55 @@ static uae_u8 mwf3[4][4] = { /* A+B-AB */
 	{ 3, 3, 3, 3 }
 };
 
+/* Write function results for four pixels at once, indexed by old and new byte */
+static uae_u8 mwf_lut[4][256][256];
+
+static void init_mwf_lut(void)
+{
+	uae_u8 (*mwf[4])[4] = { mwf0, mwf1, mwf2, mwf3 };
+	int f,a,b,i;
+	uae_u8 v;
+	
+	for (f=0; f<4; f++) {
+		for (a=0; a<256; a++) {
+			for (b=0; b<256; b++) {
+				v=0;
+				for (i=0; i<4; i++) {
+					v|=mwf[f][(a>>(i*2))&3][(b>>(i*2))&3]<<(i*2);
+				}
+				mwf_lut[f][a][b]=v;
+			}
+		}
+	}
+}
+
 static uae_u32 memory_write_func(uae_u32 old, uae_u32 new, int function, int size)
 {
-	int a,b,i;
-	uae_u32 v=0;
+	uae_u8 (*lut)[256];
 #if 0
 	write_log("[MWF] Function%i: size=%i, old=%08X, new=%08X\n",function,size,old,new);
 #endif
 	
-	switch (function) {
-		case 0:
-			for (i=0; i<(size*4); i++) {
-				a=old>>(i*2)&3;
-				b=new>>(i*2)&3;
-				v|=mwf0[a][b]<<(i*2);
-			}
-			return v;
-		case 1:
-			for (i=0; i<(size*4); i++) {
-				a=old>>(i*2)&3;
-				b=new>>(i*2)&3;
-				v|=mwf1[a][b]<<(i*2);
-			}
-			return v;
+	if (function < 0 || function > 3) {
+		write_log("Unknown memory write function!\n");
+		abort();
+	}
+	lut = mwf_lut[function];
+	
+	switch (size) {
+		case 4:
+			return ((uae_u32)lut[old>>24][new>>24]<<24) |
+			       ((uae_u32)lut[(old>>16)&0xFF][(new>>16)&0xFF]<<16) |
+			       ((uae_u32)lut[(old>>8)&0xFF][(new>>8)&0xFF]<<8) |
+			        (uae_u32)lut[old&0xFF][new&0xFF];
 		case 2:
-			for (i=0; i<(size*4); i++) {
-				a=old>>(i*2)&3;
-				b=new>>(i*2)&3;
-				v|=mwf2[a][b]<<(i*2);
-			}
-			return v;
-		case 3:
-			for (i=0; i<(size*4); i++) {
-				a=old>>(i*2)&3;
-				b=new>>(i*2)&3;
-				v|=mwf3[a][b]<<(i*2);
-			}
-			return v;
+			return ((uae_u32)lut[(old>>8)&0xFF][(new>>8)&0xFF]<<8) |
+			        (uae_u32)lut[old&0xFF][new&0xFF];
+		case 1:
+			return lut[old&0xFF][new&0xFF];
 			
 		default:
-			write_log("Unknown memory write function!\n");
+			write_log("Unknown memory write function size!\n");
 			abort();
 	}
 }
@@ -993,8 +1003,8 @@ mem_put_func bank_bput[65536];
 const char* memory_init(int *nNewNEXTMemSize)
 {
     if(!(NEXTRam)) {
-        NEXTRam   = host_malloc_aligned(128*1024*1024);
-        NEXTVideo = host_malloc_aligned(2*1024*1024);
+        NEXTRam   = host_map_memory(128*1024*1024);
+        NEXTVideo = host_map_memory(2*1024*1024);
         NEXTIo    = host_malloc_aligned(0x20000);
         NEXTRom   = host_malloc_aligned(NEXT_EPROM_SIZE);
     }
@@ -1023,6 +1033,7 @@ const char* memory_init(int *nNewNEXTMemSize)
 	
 	/* Fill every 65536 bank with dummy */
 	init_mem_banks();
+	init_mwf_lut();
 	
 	/* Map ROM */
 	map_banks(&ROM_bank, NEXT_EPROM_START >> 16, NEXT_EPROM_SIZE>>16);
@@ -1202,11 +1213,14 @@ const char* memory_init(int *nNewNEXTMemSize)
 	
 	{
 		int i;
-		for (i=0;i<sizeof(NEXTVideo);i++) NEXTVideo[i]=0;
-		for (i=0;i<sizeof(NEXTRam);i++) NEXTRam[i]=0;
+		/* Drop guest memory pages, they are committed again on first access */
+		host_reclaim_memory(NEXTVideo, 2*1024*1024);
+		host_reclaim_memory(NEXTRam, 128*1024*1024);
 		for (i=0;i<sizeof(NEXTIo);i++) NEXTIo[i]=0;
 	}
 	
+	write_log("Memory init: Host resident size: %iMB\n", (int)(host_resident_size()>>20));
+	
 	IoMem_Init();
 	
 	return NULL;
@@ -1221,6 +1235,20 @@ void memory_uninit (void)
 }
 
 
+/*
+ * Save/restore main and video memory to/from memory snapshot.
+ */
+void memory_MemorySnapShot_Capture(bool bSave)
+{
+	static Uint64 *ram_hashes = NULL;
+	static Uint64 *video_hashes = NULL;
+
+	MemorySnapShot_StorePages(NEXTRam, 128*1024*1024, &ram_hashes);
+	MemorySnapShot_StorePages(NEXTVideo, 2*1024*1024, &video_hashes);
+	MemorySnapShot_Store(NEXTIo, 0x20000);
+}
+
+
 void map_banks (addrbank *bank, int start, int size) {
 	int bnr;
 	
@@ -58,6 +58,7 @@ extern mem_put_func bank_bput[65536];
 
 const char* memory_init(int *membanks);
 void memory_uninit (void);
+void memory_MemorySnapShot_Capture(bool bSave);
 void map_banks(addrbank *bank, int first, int count);
 
 #define get_long(addr)   (call_mem_get_func(get_mem_bank(bank_lget, addr), addr))
@@ -20,6 +20,7 @@ struct m68k_exception {
 #define THROW(n) throw m68k_exception(n)
 #define THROW_AGAIN(var) throw
 #define ENDTRY
+#define STOPTRY
 #else
 /* we are in plain C, just use a stack of long jumps */
 #include <setjmp.h>
@@ -29,6 +30,8 @@ extern int     __exvalue;
                   if (__exvalue==0) { __pushtry(&__exbuf);
 #define CATCH(x)  __poptry(); } else {m68k_exception x=__exvalue; x=x;
 #define ENDTRY    __poptry();}
+/* leave a TRY block early, e.g. with return */
+#define STOPTRY   __poptry()
 #define THROW(x) if (__is_catched()) {siglongjmp(__exbuf,x);}
 #define THROW_AGAIN(var) if (__is_catched()) siglongjmp(*__poptry(),__exvalue)
 #define SAVE_EXCEPTION
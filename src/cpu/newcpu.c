@@ -1205,14 +1205,47 @@ void doint (void)
 		set_special (SPCFLAG_DOINT);
 }
 
-#define IDLETIME (currprefs.cpu_idle * sleep_resolution / 700)
+/*
+ * Number of cycles to let pass while the CPU is stopped. Without realtime
+ * the STOP state jumps straight to the next cycle interrupt. In realtime
+ * mode the host thread sleeps until the next interrupt is due, in slices
+ * of at most STOP_MAX_SLEEP_US so that host events are still polled.
+ * The DSP is clocked by the CPU and keeps the cycle by cycle stepping.
+ */
+#define STOP_MAX_SLEEP_US 1000
+#define STOP_MAX_CYCLES   (1<<30)
+
+static int stop_idle_cycles (void)
+{
+    Sint64 cycles = PendingInterrupt.type == CYC_INT_CPU ? PendingInterrupt.time : INT64_MAX;
+
+    if (dsp_core.running || cycles <= cpu_cycles)
+        return cpu_cycles;
+
+    if (ConfigureParams.System.bRealtime) {
+        Sint64 us = cycles / ConfigureParams.System.nCpuFreq;
+        Sint64 usnext = CycInt_NextInterruptUs();
+
+        if (usnext < us)
+            us = usnext;
+        if (us > STOP_MAX_SLEEP_US)
+            us = STOP_MAX_SLEEP_US;
+        if (us <= 0)
+            return cpu_cycles;
+
+        host_sleep_us(us);
+        cycles = us * ConfigureParams.System.nCpuFreq;
+    }
+
+    if (cycles > STOP_MAX_CYCLES)
+        cycles = STOP_MAX_CYCLES;
+    return cycles < cpu_cycles ? cpu_cycles : (int)cycles;
+}
 
 /*
  * Handle special flags
  */
 
-static int vpos = 0;
-
 static int do_specialties (int cycles)
 {
 	if (regs.spcflags & SPCFLAG_DOTRACE)
@@ -1226,7 +1259,7 @@ static int do_specialties (int cycles)
             if (regs.spcflags & SPCFLAG_BRK)
                 return 1;
         
-            M68000_AddCycles(cpu_cycles);
+            M68000_AddCycles(stop_idle_cycles());
 
             /* It is possible one or more ints happen at the same time */
             /* We must process them during the same cpu cycle until the special INT flag is set */
@@ -1240,21 +1273,6 @@ static int do_specialties (int cycles)
                     m68k_resumestopped ();
                     return 1;
                 }
-
-                if (currprefs.cpu_idle && ((regs.spcflags & SPCFLAG_STOP)) == SPCFLAG_STOP) {
-                    /* sleep 1ms if STOP-instruction is executed */
-                    if (1) {
-                        static int sleepcnt, lvpos;
-                        if (vpos != lvpos) {
-                            sleepcnt--;
-                            lvpos = vpos;
-                            if (sleepcnt < 0) {
-                                    /*sleepcnt = IDLETIME / 2; */  /* Laurent : badly removed for now */
-                                host_sleep_ms(1);
-                            }
-                        }
-                    }
-                }
             }
         }
 	}
@@ -1351,6 +1369,7 @@ insretry:
             
             M68000_AddCycles(cpu_cycles);
             cpu_cycles = nCyclesMainCounter - beforeCycles;
+            nCpuInstructions++;
             
             run_other_MPUs();
 
@@ -1373,8 +1392,10 @@ insretry:
             lastintr = intr;
             
             if (regs.spcflags & ~SPCFLAG_INT) {
-				if (do_specialties (cpu_cycles))
+				if (do_specialties (cpu_cycles)) {
+					STOPTRY;
 					return;
+				}
 			}
 		}
 	} CATCH (prb) {
@@ -1430,6 +1451,7 @@ static void m68k_run_mmu040 (void)
 			cpu_cycles = (*cpufunctbl[opcode])(opcode);
             M68000_AddCycles(cpu_cycles);
             cpu_cycles = nCyclesMainCounter - beforeCycles;
+            nCpuInstructions++;
 
             run_other_MPUs();
             
@@ -1452,8 +1474,10 @@ static void m68k_run_mmu040 (void)
             lastintr = intr;
                         
 			if (regs.spcflags & ~SPCFLAG_INT) {
-				if (do_specialties (cpu_cycles))
+				if (do_specialties (cpu_cycles)) {
+					STOPTRY;
 					return;
+				}
 			}
 		} // end of for(;;)
 	} CATCH (prb) {
@@ -37,6 +37,7 @@ const char CycInt_fileid[] = "Previous cycInt.c : " __DATE__ " " __TIME__;
 #include "kms.h"
 #include "configuration.h"
 #include "main.h"
+#include "memorySnapShot.h"
 #include "nd_sdl.hpp"
 
 void (*PendingInterruptFunction)(void);
@@ -69,6 +70,7 @@ static void (* const pIntHandlerFunctions[MAX_INTERRUPTS])(void) =
     Main_EventHandlerInterrupt,
     nd_vbl_handler,
     nd_video_vbl_handler,
+    Main_ThrottleInterrupt,
 };
 
 static INTERRUPTHANDLER InterruptHandlers[MAX_INTERRUPTS];
@@ -157,6 +159,23 @@ bool CycInt_SetNewInterruptUs(void) {
     return false;
 }
 
+/*-----------------------------------------------------------------------*/
+/**
+ * Return microseconds until the next microsecond interrupt is due or
+ * INT64_MAX if there is none.
+ */
+Sint64 CycInt_NextInterruptUs(void) {
+    Sint64 next = INT64_MAX;
+    for(int i = 0; i < MAX_INTERRUPTS; i++) {
+        if (InterruptHandlers[i].type == CYC_INT_US && InterruptHandlers[i].time < next)
+            next = InterruptHandlers[i].time;
+    }
+    if (next == INT64_MAX)
+        return next;
+    next -= (Sint64)host_time_us();
+    return next < 0 ? 0 : next;
+}
+
 /*-----------------------------------------------------------------------*/
 /**
  * Adjust all interrupt timings as 'ActiveInterrupt' has occured, and
@@ -171,6 +190,9 @@ void CycInt_AcknowledgeInterrupt(void) {
 
 	/* Set new */
 	CycInt_SetNewInterrupt();
+
+	/* Restart the Ethernet check if the host network received a frame */
+	ENET_RX_Check();
 }
 
 /*-----------------------------------------------------------------------*/
@@ -256,3 +278,38 @@ bool CycInt_InterruptActive(interrupt_id Handler)
 {
     return InterruptHandlers[Handler].type != CYC_INT_NONE;
 }
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Save/Restore snapshot of local variables ('MemorySnapShot_Store' handles type)
+ * Microsecond interrupts are stored relative to the current host time, which
+ * starts again from zero after the reset that precedes restoring.
+ */
+void CycInt_MemorySnapShot_Capture(bool bSave) {
+    Sint64 now = host_time_us();
+    Sint64 time;
+    int    type;
+
+    if (bSave) {
+        CycInt_UpdateInterrupt();
+        CycInt_SetNewInterrupt();
+    }
+    for (int i = 0; i < MAX_INTERRUPTS; i++) {
+        type = InterruptHandlers[i].type;
+        time = InterruptHandlers[i].time;
+        if (type == CYC_INT_US)
+            time -= now;
+        MemorySnapShot_Store(&type, sizeof(type));
+        MemorySnapShot_Store(&time, sizeof(time));
+        if (!bSave) {
+            InterruptHandlers[i].type = type;
+            InterruptHandlers[i].time = type == CYC_INT_US ? now + time : time;
+        }
+    }
+    MemorySnapShot_Store(&usCheckCycles, sizeof(usCheckCycles));
+
+    if (!bSave) {
+        nCyclesOver = 0;
+        CycInt_SetNewInterrupt();
+    }
+}
@@ -12,6 +12,11 @@
  * It can also dynamically output trace messages, based on the content
  * of LogTraceFlags. Multiple trace levels can be set at once, by setting
  * the corresponding bits in LogTraceFlags.
+ *
+ * Log messages are formatted on the calling thread and queued in a ring
+ * buffer. A writer thread moves them to the log file, so that heavy logging
+ * (e.g. per network packet) does not stall the emulation threads. Errors
+ * are flushed immediately. Trace output is still written directly.
  */
 const char Log_fileid[] = "Hatari log.c : " __DATE__ " " __TIME__;
 
@@ -27,6 +32,7 @@ const char Log_fileid[] = "Hatari log.c : " __DATE__ " " __TIME__;
 #include "log.h"
 #include "screen.h"
 #include "file.h"
+#include "host.h"
 
 
 static struct {
@@ -78,6 +84,124 @@ static FILE *hLogFile = NULL;
 static LOGTYPE TextLogLevel;
 static LOGTYPE AlertDlgLogLevel;
 
+#define LOG_LINE_SIZE 1024
+#define LOG_RING_SIZE 0x10000
+#define LOG_RING_MASK (LOG_RING_SIZE-1)
+
+static char LogRing[LOG_RING_SIZE];
+static Uint32 LogHead;			/* written by producers under LogLock */
+static Uint32 LogTail;			/* written by the writer under LogLock */
+static Uint32 LogDropped;		/* messages lost because the ring was full */
+static lock_t LogLock;
+static SDL_mutex *LogWriteMutex;
+static SDL_sem *LogSem;
+static thread_t *LogThread;
+static volatile bool bLogQuit;
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Write all queued messages to the log file.
+ */
+void Log_Flush(void)
+{
+	Uint32 head, tail, dropped;
+
+	if (!LogThread)
+		return;
+
+	SDL_LockMutex(LogWriteMutex);
+	host_lock(&LogLock);
+	head = LogHead;
+	tail = LogTail;
+	dropped = LogDropped;
+	LogDropped = 0;
+	host_unlock(&LogLock);
+
+	if (head != tail)
+	{
+		Uint32 start = tail & LOG_RING_MASK;
+		Uint32 len = head - tail;
+		if (start + len > LOG_RING_SIZE)
+		{
+			fwrite(&LogRing[start], 1, LOG_RING_SIZE - start, hLogFile);
+			len  -= LOG_RING_SIZE - start;
+			start = 0;
+		}
+		fwrite(&LogRing[start], 1, len, hLogFile);
+	}
+	if (dropped)
+		fprintf(hLogFile, "[Log] %u messages dropped\n", dropped);
+	fflush(hLogFile);
+
+	host_lock(&LogLock);
+	LogTail = head;
+	host_unlock(&LogLock);
+	SDL_UnlockMutex(LogWriteMutex);
+}
+
+static int Log_Writer(void *unused)
+{
+	while (!bLogQuit)
+	{
+		SDL_SemWaitTimeout(LogSem, 100);
+		Log_Flush();
+	}
+	return 0;
+}
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Queue one line of text for the writer thread.
+ */
+static void Log_Enqueue(const char *psText, Uint32 len)
+{
+	Uint32 start, first;
+
+	host_lock(&LogLock);
+	if (LOG_RING_SIZE - (LogHead - LogTail) < len)
+	{
+		LogDropped++;
+		host_unlock(&LogLock);
+		return;
+	}
+	start = LogHead & LOG_RING_MASK;
+	first = len < LOG_RING_SIZE - start ? len : LOG_RING_SIZE - start;
+	memcpy(&LogRing[start], psText, first);
+	memcpy(LogRing, psText + first, len - first);
+	LogHead += len;
+	host_unlock(&LogLock);
+
+	if (SDL_SemValue(LogSem) == 0)
+		SDL_SemPost(LogSem);
+}
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Format a message, add a new-line if necessary and pass it to the writer.
+ */
+static void Log_Write(LOGTYPE nType, const char *psFormat, va_list argptr)
+{
+	char sLine[LOG_LINE_SIZE];
+	int len;
+
+	len = vsnprintf(sLine, sizeof(sLine) - 1, psFormat, argptr);
+	if (len < 0)
+		return;
+	if (len > (int)sizeof(sLine) - 2)
+		len = sizeof(sLine) - 2;
+	if (len == 0 || sLine[len-1] != '\n')
+		sLine[len++] = '\n';
+
+	if (!LogThread)
+	{
+		fwrite(sLine, 1, len, hLogFile);
+		return;
+	}
+	Log_Enqueue(sLine, len);
+	if (nType <= LOG_ERROR)
+		Log_Flush();
+}
+
 /*-----------------------------------------------------------------------*/
 /**
  * Initialize the logging and tracing functionality (open the log files etc.).
@@ -91,7 +215,16 @@ int Log_Init(void)
 
 	hLogFile = File_Open(ConfigureParams.Log.sLogFileName, "w");
 	TraceFile = File_Open(ConfigureParams.Log.sTraceFileName, "w");
-   
+
+	/* Without the writer thread messages are written synchronously */
+	LogHead = LogTail = LogDropped = 0;
+	bLogQuit = false;
+	LogWriteMutex = SDL_CreateMutex();
+	LogSem = SDL_CreateSemaphore(0);
+	if (hLogFile && LogWriteMutex && LogSem)
+		LogThread = host_thread_create(Log_Writer, "[Previous] log writer", NULL);
+	atexit(Log_Flush);
+
 	return (hLogFile && TraceFile);
 }
 
@@ -108,12 +241,39 @@ int Log_SetAlertLevel(int level)
 }
 
 
+/*-----------------------------------------------------------------------*/
+/**
+ * Stop or restart the writer thread. While it is stopped, messages are
+ * written synchronously.
+ */
+void Log_Pause(bool pause)
+{
+	if (pause)
+	{
+		if (LogThread)
+		{
+			bLogQuit = true;
+			SDL_SemPost(LogSem);
+			host_thread_wait(LogThread);
+			Log_Flush();
+			LogThread = NULL;
+		}
+	}
+	else if (!LogThread && hLogFile && LogWriteMutex && LogSem)
+	{
+		bLogQuit = false;
+		LogThread = host_thread_create(Log_Writer, "[Previous] log writer", NULL);
+	}
+}
+
+
 /*-----------------------------------------------------------------------*/
 /**
  * Un-Initialize - close log files etc.
  */
 void Log_UnInit(void)
 {
+	Log_Pause(true);
 	hLogFile = File_Close(hLogFile);
 	TraceFile = File_Close(TraceFile);
 }
@@ -130,15 +290,50 @@ void _Log_Printf(LOGTYPE nType, const char *psFormat, ...)
 	if (hLogFile && nType && nType <= TextLogLevel)
 	{
 		va_start(argptr, psFormat);
-		vfprintf(hLogFile, psFormat, argptr);
+		Log_Write(nType, psFormat, argptr);
 		va_end(argptr);
-		/* Add a new-line if necessary: */
-		if (psFormat[strlen(psFormat)-1] != '\n')
-			fputs("\n", hLogFile);
 	}
 }
 
 
+/*-----------------------------------------------------------------------*/
+/**
+ * Output string to log file, rate limited per call site. The counters are
+ * not atomic, sites shared between threads may let a few extra lines pass.
+ */
+void _Log_PrintfSite(LOGSITE *pSite, LOGTYPE nType, const char *psFormat, ...)
+{
+	va_list argptr;
+	Uint32 now;
+
+	if (!(hLogFile && nType && nType <= TextLogLevel))
+		return;
+
+	now = SDL_GetTicks();
+	if (now - pSite->window >= LOG_SITE_WINDOW)
+	{
+		if (pSite->suppressed)
+		{
+			int len = strcspn(psFormat, "\n");
+			_Log_Printf(nType, "[Log] %d more messages like \"%.*s\" suppressed\n",
+			            pSite->suppressed, len, psFormat);
+		}
+		pSite->window = now;
+		pSite->count = 0;
+		pSite->suppressed = 0;
+	}
+	if (++pSite->count > LOG_SITE_BURST)
+	{
+		pSite->suppressed++;
+		return;
+	}
+
+	va_start(argptr, psFormat);
+	Log_Write(nType, psFormat, argptr);
+	va_end(argptr);
+}
+
+
 /*-----------------------------------------------------------------------*/
 /**
  * Show logging alert dialog box and output string to log file
@@ -151,11 +346,8 @@ void Log_AlertDlg(LOGTYPE nType, const char *psFormat, ...)
 	if (hLogFile && nType && nType <= TextLogLevel)
 	{
 		va_start(argptr, psFormat);
-		vfprintf(hLogFile, psFormat, argptr);
+		Log_Write(nType, psFormat, argptr);
 		va_end(argptr);
-		/* Add a new-line if necessary: */
-		if (psFormat[strlen(psFormat)-1] != '\n')
-			fputs("\n", hLogFile);
 	}
 
 	/* Show alert dialog box: */
@@ -33,6 +33,19 @@ typedef enum
 	LOG_DEBUG,	/* information about internal Hatari working */
 } LOGTYPE;
 
+/* Rate limiting state, one per Log_Printf call site. Each site prints at
+ * most LOG_SITE_BURST messages per LOG_SITE_WINDOW milliseconds, further
+ * messages are counted and summarized when the site prints again. */
+#define LOG_SITE_BURST  20
+#define LOG_SITE_WINDOW 1000
+
+typedef struct
+{
+	Uint32 window;		/* start of current window in ms */
+	int count;		/* messages printed in current window */
+	int suppressed;		/* messages dropped in current window */
+} LOGSITE;
+
 #ifndef __GNUC__
 /* assuming attributes work only for GCC */
 #define __attribute__(foo)
@@ -41,8 +54,12 @@ typedef enum
 extern int Log_Init(void);
 extern int Log_SetAlertLevel(int level);
 extern void Log_UnInit(void);
+extern void Log_Pause(bool pause);
 extern void _Log_Printf(LOGTYPE nType, const char *psFormat, ...)
 	__attribute__ ((format (printf, 2, 3)));
+extern void _Log_PrintfSite(LOGSITE *pSite, LOGTYPE nType, const char *psFormat, ...)
+	__attribute__ ((format (printf, 3, 4)));
+extern void Log_Flush(void);
 extern void Log_AlertDlg(LOGTYPE nType, const char *psFormat, ...)
 	__attribute__ ((format (printf, 2, 3)));
 extern LOGTYPE Log_ParseOptions(const char *OptionStr);
@@ -53,9 +70,12 @@ extern char *Log_MatchTrace(const char *text, int state);
 #undef __attribute__
 #endif
 
+#define _Log_SITE(nType, psFormat, ...) \
+	do { static LOGSITE _log_site; _Log_PrintfSite(&_log_site, nType, psFormat, ## __VA_ARGS__); } while (0)
+
 #define _Log_LOG_FATAL(nType, psFormat, ...) _Log_Printf(nType, psFormat, ## __VA_ARGS__)
-#define _Log_LOG_ERROR(nType, psFormat, ...) _Log_Printf(nType, psFormat, ## __VA_ARGS__)
-#define _Log_LOG_WARN(nType, psFormat, ...)  _Log_Printf(nType, psFormat, ## __VA_ARGS__)
+#define _Log_LOG_ERROR(nType, psFormat, ...) _Log_SITE(nType, psFormat, ## __VA_ARGS__)
+#define _Log_LOG_WARN(nType, psFormat, ...)  _Log_SITE(nType, psFormat, ## __VA_ARGS__)
 #define _Log_LOG_INFO(nType, psFormat, ...)
 #define _Log_LOG_TODO(nType, psFormat, ...)
 #define _Log_LOG_DEBUG(nType, psFormat, ...)
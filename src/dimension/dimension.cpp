@@ -1,4 +1,5 @@
 #include <stdlib.h>
+#include <string.h>
 
 #include "configuration.h"
 #include "m68000.h"
@@ -29,11 +30,12 @@
 NextDimension::NextDimension(int slot) :
     NextBusBoard(slot),
     mem_banks(new ND_Addrbank*[65536]),
-    ram(host_malloc_aligned(64*1024*1024)),
-    vram(host_malloc_aligned(4*1024*1024)),
+    ram(host_map_memory(64*1024*1024)),
+    vram(host_map_memory(4*1024*1024)),
     rom(host_malloc_aligned(128*1024)),
+    vram_dirty(new Uint8[ND_VRAM_DIRTY_BLOCKS]()),
     rom_last_addr(0),
-    sdl(slot, (Uint32*)vram),
+    sdl(slot, (Uint32*)vram, vram_dirty),
     i860(this),
     nbic(slot, ND_NBIC_ID),
     mc(this),
@@ -58,9 +60,10 @@ NextDimension::~NextDimension() {
     sdl.destroy();
     
     delete[] mem_banks;
-    free(ram);
-    free(vram);
+    host_unmap_memory(ram, 64*1024*1024);
+    host_unmap_memory(vram, 4*1024*1024);
     free(rom);
+    delete[] vram_dirty;
 
 }
 
@@ -176,29 +179,102 @@ void NextDimension::send_msg(int msg) {
 
 /* NeXTdimension board memory access (i860) */
 
+/* Aligned accesses to RAM and VRAM use the host pointer tables directly.
+ * Everything else goes through the bank objects. */
+static inline Uint8* nd_ram_ptr(const NextDimension* nd, Uint32 addr, Uint32 size) {
+    if (!ND_HOST_SPACE(addr)) return NULL;
+    Uint8* p = nd->ram_banks[(addr >> 16) & (ND_HOST_BANKS - 1)];
+    return (p && !(addr & (size - 1))) ? p + (addr & 0xFFFF) : NULL;
+}
+
+static inline Uint8* nd_vram_ptr(const NextDimension* nd, Uint32 addr, Uint32 size) {
+    if (!ND_HOST_SPACE(addr)) return NULL;
+    Uint8* p = nd->vram_banks[(addr >> 16) & (ND_HOST_BANKS - 1)];
+    return (p && !(addr & (size - 1))) ? p + (addr & 0xFFFF) : NULL;
+}
+
+/* VRAM is stored as ARGB, see ND_VRAM */
+static inline Uint32 nd_vram_lget(const Uint8* p) {
+    Uint32 v;
+    memcpy(&v, p, 4);
+    v = SDL_SwapLE32(v);
+    return (v << 8) | (v >> 24);
+}
+
+static inline void nd_vram_lput(const NextDimension* nd, Uint8* p, Uint32 l) {
+    Uint32 v = SDL_SwapLE32((l >> 8) | (l << 24));
+    memcpy(p, &v, 4);
+    nd->vram_dirty[(p - nd->vram) >> ND_VRAM_DIRTY_SHIFT] = 1;
+}
+
 Uint8  NextDimension::i860_cs8get(const NextDimension* nd, Uint32 addr) {
     return nd_cs8get(addr);
 }
 
 void   NextDimension::i860_rd8_be(const NextDimension* nd, Uint32 addr, Uint32* val) {
+    Uint8* p = nd_ram_ptr(nd, addr, 1);
+    if (p) {
+        *((Uint8*)val) = *p;
+        return;
+    }
     *((Uint8*)val) = nd_byteget(addr);
 }
 
 void   NextDimension::i860_rd16_be(const NextDimension* nd, Uint32 addr, Uint32* val) {
+    Uint8* p = nd_ram_ptr(nd, addr, 2);
+    if (p) {
+        *((Uint16*)val) = do_get_mem_word(p);
+        return;
+    }
     *((Uint16*)val) = nd_wordget(addr);
 }
 
 void   NextDimension::i860_rd32_be(const NextDimension* nd, Uint32 addr, Uint32* val) {
+    Uint8* p = nd_ram_ptr(nd, addr, 4);
+    if (p) {
+        val[0] = do_get_mem_long(p);
+        return;
+    }
+    if ((p = nd_vram_ptr(nd, addr, 4))) {
+        val[0] = nd_vram_lget(p);
+        return;
+    }
     val[0] = nd_longget(addr);
 }
 
 void   NextDimension::i860_rd64_be(const NextDimension* nd, Uint32 addr, Uint32* val) {
+    Uint8* p = nd_ram_ptr(nd, addr, 8);
+    if (p) {
+        val[0] = do_get_mem_long(p+4);
+        val[1] = do_get_mem_long(p+0);
+        return;
+    }
+    if ((p = nd_vram_ptr(nd, addr, 8))) {
+        val[0] = nd_vram_lget(p+4);
+        val[1] = nd_vram_lget(p+0);
+        return;
+    }
     const ND_Addrbank* ab = nd_get_mem_bank(addr);
     val[0] = ab->lget(addr+4);
     val[1] = ab->lget(addr+0);
 }
 
 void   NextDimension::i860_rd128_be(const NextDimension* nd, Uint32 addr, Uint32* val) {
+    Uint8* p = nd_ram_ptr(nd, addr, 16);
+    if (p) {
+        val[0]  = do_get_mem_long(p+4);
+        val[1]  = do_get_mem_long(p+0);
+        val[2]  = do_get_mem_long(p+12);
+        val[3]  = do_get_mem_long(p+8);
+        return;
+    }
+    if ((p = nd_vram_ptr(nd, addr, 16))) {
+        val[0]  = nd_vram_lget(p+4);
+        val[1]  = nd_vram_lget(p+0);
+        val[2]  = nd_vram_lget(p+12);
+        val[3]  = nd_vram_lget(p+8);
+        return;
+    }
     const ND_Addrbank* ab = nd_get_mem_bank(addr);
     val[0]  = ab->lget(addr+4);
     val[1]  = ab->lget(addr+0);
@@ -207,24 +283,69 @@ void   NextDimension::i860_rd128_be(const NextDimension* nd, Uint32 addr, Uint32
 }
 
 void   NextDimension::i860_wr8_be(const NextDimension* nd, Uint32 addr, const Uint32* val) {
+    Uint8* p = nd_ram_ptr(nd, addr, 1);
+    if (p) {
+        *p = *((const Uint8*)val);
+        return;
+    }
     nd_byteput(addr, *((const Uint8*)val));
 }
 
 void   NextDimension::i860_wr16_be(const NextDimension* nd, Uint32 addr, const Uint32* val) {
+    Uint8* p = nd_ram_ptr(nd, addr, 2);
+    if (p) {
+        do_put_mem_word(p, *((const Uint16*)val));
+        return;
+    }
     nd_wordput(addr, *((const Uint16*)val));
 }
 
 void   NextDimension::i860_wr32_be(const NextDimension* nd, Uint32 addr, const Uint32* val) {
+    Uint8* p = nd_ram_ptr(nd, addr, 4);
+    if (p) {
+        do_put_mem_long(p, val[0]);
+        return;
+    }
+    if ((p = nd_vram_ptr(nd, addr, 4))) {
+        nd_vram_lput(nd, p, val[0]);
+        return;
+    }
     nd_longput(addr, val[0]);
 }
 
 void   NextDimension::i860_wr64_be(const NextDimension* nd, Uint32 addr, const Uint32* val) {
+    Uint8* p = nd_ram_ptr(nd, addr, 8);
+    if (p) {
+        do_put_mem_long(p+4, val[0]);
+        do_put_mem_long(p+0, val[1]);
+        return;
+    }
+    if ((p = nd_vram_ptr(nd, addr, 8))) {
+        nd_vram_lput(nd, p+4, val[0]);
+        nd_vram_lput(nd, p+0, val[1]);
+        return;
+    }
     const ND_Addrbank* ab = nd_get_mem_bank(addr);
     ab->lput(addr+4, val[0]);
     ab->lput(addr+0, val[1]);
 }
 
 void   NextDimension::i860_wr128_be(const NextDimension* nd, Uint32 addr, const Uint32* val) {
+    Uint8* p = nd_ram_ptr(nd, addr, 16);
+    if (p) {
+        do_put_mem_long(p+4,  val[0]);
+        do_put_mem_long(p+0,  val[1]);
+        do_put_mem_long(p+12, val[2]);
+        do_put_mem_long(p+8,  val[3]);
+        return;
+    }
+    if ((p = nd_vram_ptr(nd, addr, 16))) {
+        nd_vram_lput(nd, p+4,  val[0]);
+        nd_vram_lput(nd, p+0,  val[1]);
+        nd_vram_lput(nd, p+12, val[2]);
+        nd_vram_lput(nd, p+8,  val[3]);
+        return;
+    }
     const ND_Addrbank* ab = nd_get_mem_bank(addr);
     ab->lput(addr+4,  val[0]);
     ab->lput(addr+0,  val[1]);
@@ -233,24 +354,50 @@ void   NextDimension::i860_wr128_be(const NextDimension* nd, Uint32 addr, const
 }
 
 void   NextDimension::i860_rd8_le(const NextDimension* nd, Uint32 addr, Uint32* val) {
-    *((Uint8*)val) = nd_byteget(addr^7);
+    i860_rd8_be(nd, addr^7, val);
 }
 
 void   NextDimension::i860_rd16_le(const NextDimension* nd, Uint32 addr, Uint32* val) {
-    *((Uint16*)val) = nd_wordget(addr^6);
+    i860_rd16_be(nd, addr^6, val);
 }
 
 void   NextDimension::i860_rd32_le(const NextDimension* nd, Uint32 addr, Uint32* val) {
-    val[0] = nd_longget(addr^4);
+    i860_rd32_be(nd, addr^4, val);
 }
 
 void   NextDimension::i860_rd64_le(const NextDimension* nd, Uint32 addr, Uint32* val) {
+    Uint8* p = nd_ram_ptr(nd, addr, 8);
+    if (p) {
+        val[0] = do_get_mem_long(p+0);
+        val[1] = do_get_mem_long(p+4);
+        return;
+    }
+    if ((p = nd_vram_ptr(nd, addr, 8))) {
+        val[0] = nd_vram_lget(p+0);
+        val[1] = nd_vram_lget(p+4);
+        return;
+    }
     const ND_Addrbank* ab = nd_get_mem_bank(addr);
     val[0] = ab->lget(addr+0);
     val[1] = ab->lget(addr+4);
 }
 
 void   NextDimension::i860_rd128_le(const NextDimension* nd, Uint32 addr, Uint32* val) {
+    Uint8* p = nd_ram_ptr(nd, addr, 16);
+    if (p) {
+        val[0]  = do_get_mem_long(p+0);
+        val[1]  = do_get_mem_long(p+4);
+        val[2]  = do_get_mem_long(p+8);
+        val[3]  = do_get_mem_long(p+12);
+        return;
+    }
+    if ((p = nd_vram_ptr(nd, addr, 16))) {
+        val[0]  = nd_vram_lget(p+0);
+        val[1]  = nd_vram_lget(p+4);
+        val[2]  = nd_vram_lget(p+8);
+        val[3]  = nd_vram_lget(p+12);
+        return;
+    }
     const ND_Addrbank* ab = nd_get_mem_bank(addr);
     val[0]  = ab->lget(addr+0);
     val[1]  = ab->lget(addr+4);
@@ -259,24 +406,50 @@ void   NextDimension::i860_rd128_le(const NextDimension* nd, Uint32 addr, Uint32
 }
 
 void   NextDimension::i860_wr8_le(const NextDimension* nd, Uint32 addr, const Uint32* val) {
-    nd_byteput(addr^7, *((const Uint8*)val));
+    i860_wr8_be(nd, addr^7, val);
 }
 
 void   NextDimension::i860_wr16_le(const NextDimension* nd, Uint32 addr, const Uint32* val) {
-    nd_wordput(addr^6, *((const Uint16*)val));
+    i860_wr16_be(nd, addr^6, val);
 }
 
 void   NextDimension::i860_wr32_le(const NextDimension* nd, Uint32 addr, const Uint32* val) {
-    nd_longput(addr^4, val[0]);
+    i860_wr32_be(nd, addr^4, val);
 }
 
 void   NextDimension::i860_wr64_le(const NextDimension* nd, Uint32 addr, const Uint32* val) {
+    Uint8* p = nd_ram_ptr(nd, addr, 8);
+    if (p) {
+        do_put_mem_long(p+0, val[0]);
+        do_put_mem_long(p+4, val[1]);
+        return;
+    }
+    if ((p = nd_vram_ptr(nd, addr, 8))) {
+        nd_vram_lput(nd, p+0, val[0]);
+        nd_vram_lput(nd, p+4, val[1]);
+        return;
+    }
     const ND_Addrbank* ab = nd_get_mem_bank(addr);
     ab->lput(addr+0, val[0]);
     ab->lput(addr+4, val[1]);
 }
 
 void   NextDimension::i860_wr128_le(const NextDimension* nd, Uint32 addr, const Uint32* val) {
+    Uint8* p = nd_ram_ptr(nd, addr, 16);
+    if (p) {
+        do_put_mem_long(p+0,  val[0]);
+        do_put_mem_long(p+4,  val[1]);
+        do_put_mem_long(p+8,  val[2]);
+        do_put_mem_long(p+12, val[3]);
+        return;
+    }
+    if ((p = nd_vram_ptr(nd, addr, 16))) {
+        nd_vram_lput(nd, p+0,  val[0]);
+        nd_vram_lput(nd, p+4,  val[1]);
+        nd_vram_lput(nd, p+8,  val[2]);
+        nd_vram_lput(nd, p+12, val[3]);
+        return;
+    }
     const ND_Addrbank* ab = nd_get_mem_bank(addr);
     ab->lput(addr+0,  val[0]);
     ab->lput(addr+4,  val[1]);
@@ -120,6 +120,11 @@ public:
     void write(Uint32 step, Uint8 data);
 };
 
+/* Number of 64 KB banks in i860 board space at 0xF0000000, which holds
+ * RAM and VRAM. The host pointer tables only cover this space. */
+#define ND_HOST_BANKS 0x1000
+#define ND_HOST_SPACE(addr) (((addr) >> 28) == 0xF)
+
 class NextDimension : public NextBusBoard {
     /* Message port for host->dimension communication */
     atomic_int      m_port;
@@ -128,6 +133,11 @@ public:
     Uint8*          ram;
     Uint8*          vram;
     Uint8*          rom;
+    volatile Uint8* vram_dirty;
+    
+    /* Host pointers for RAM and VRAM banks, NULL for other banks */
+    Uint8*          ram_banks[ND_HOST_BANKS];
+    Uint8*          vram_banks[ND_HOST_BANKS];
     
     Uint32          rom_last_addr;;
     Uint32          bankmask[4];
@@ -149,6 +159,7 @@ public:
     void mem_init(void);
     void init_mem_banks(void);
     void map_banks (ND_Addrbank *bank, int start, int size);
+    void map_host_banks(Uint8** banks, Uint8* base, Uint32 mask, Uint32 start, Uint32 size);
 
     virtual Uint32 board_lget(Uint32 addr);
     virtual Uint16 board_wget(Uint32 addr);
@@ -194,6 +205,7 @@ public:
     void   rom_load();
         
     bool   handle_msgs(void);  /* i860 thread message handler */
+    bool   has_msgs(void) {return host_atomic_peek(&m_port) != 0;}
     void   send_msg(int msg);
 
     void   set_blank_state(int src, bool state);
@@ -20,6 +20,9 @@
 #undef mkdir
 #endif
 #include <unistd.h>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
 
 #include "i860.hpp"
 #include "dimension.hpp"
@@ -58,6 +61,9 @@ extern "C" {
 i860_cpu_device::i860_cpu_device(NextDimension* nd) : nd(nd) {
     m_thread = NULL;
     m_halt   = true;
+    host_atomic_set(&i860cycles, 0);
+    m_spin_break = true;
+    m_spin_addr  = 0;
     
     sprintf(m_thread_name, "[ND] Slot %d: i860", nd->slot);
     
@@ -545,8 +551,33 @@ bool i860_cpu_device::handle_msgs(int msg) {
     return true;
 }
 
+/* Called from the m68k thread. Unused cycles of the last period are
+ * dropped, overrun of the last quantum is carried over. */
+void i860_cpu_device::add_cycles(int cycles) {
+    int budget;
+    do {
+        budget = host_atomic_get(&i860cycles);
+    } while(!host_atomic_cas(&i860cycles, budget, budget > 0 ? cycles : budget + cycles));
+}
+
+#define I860_QUANTUM_MIN    16
+#define I860_QUANTUM_MAX    1024
+#define I860_IDLE_QUANTA    8   /* Spinning quanta before releasing the host CPU */
+#define I860_IDLE_SLEEP_US  200
+
 void i860_cpu_device::run() {
-    while(nd->handle_msgs()) {
+    int    quantum = I860_QUANTUM_MIN;
+    int    idle    = 0;
+    UINT32 spin_pc = 0;
+    
+    for(;;) {
+        /* Only exchange the message port if there are messages */
+        if(nd->has_msgs()) {
+            if(!nd->handle_msgs())
+                break;
+            quantum = I860_QUANTUM_MIN;
+            idle    = 0;
+        }
         
         /* Sleep a bit if halted */
         if(is_halted()) {
@@ -554,12 +585,28 @@ void i860_cpu_device::run() {
             continue;
         }
         
-        if (i860cycles > 0) {
+        int budget = host_atomic_get(&i860cycles);
+        if (budget > 0) {
             /* Run some i860 cycles before re-checking messages */
-            for(int i = 16; --i >= 0;)
+            int cycles = quantum < budget ? quantum : budget;
+            m_spin_break = false;
+            for(int i = cycles; --i >= 0;)
                 run_cycle();
+            host_atomic_add(&i860cycles, -cycles);
+            
+            /* Grow the quantum while no messages arrive */
+            if(quantum < I860_QUANTUM_MAX)
+                quantum <<= 1;
             
-            i860cycles -= 16;
+            /* No stores and no loads from new addresses around the same pc:
+               the i860 is most likely polling a mailbox */
+            if(!m_spin_break && (m_pc - spin_pc + 64) < 128) {
+                if(++idle >= I860_IDLE_QUANTA)
+                    host_sleep_us(I860_IDLE_SLEEP_US);
+            } else {
+                idle = 0;
+            }
+            spin_pc = m_pc;
         } else {
             host_sleep_ms(1);
         }
@@ -440,8 +440,9 @@ public:
     void pause(bool state);
     inline bool is_halted(void) {return m_halt;};
 
-    /* i860 cycle counter */
-    int i860cycles;
+    /* i860 cycle budget, refilled from the m68k thread */
+    atomic_int i860cycles;
+    void add_cycles(int cycles);
     /* Run one i860 cycle */
     void    run_cycle(void);
     /* Run the i860 thread */
@@ -470,6 +471,10 @@ private:
     UINT64 m_tlb_miss;
     UINT64 m_tlb_inval;
     UINT64 m_intrs;
+    
+    /* Spin detection: set by stores and by loads from a new address */
+    bool   m_spin_break;
+    UINT32 m_spin_addr;
     UINT32 m_last_rt;
     UINT32 m_last_vt;
     char   m_report[1024];
@@ -729,5 +734,12 @@ private:
 
 /* disassembler */
 int i860_disassembler(UINT32 pc, UINT32 insn, char* buffer);
+
+/* Z-buffer check of [p]fzchk{s,l}, the scalar version and the SSE2 version
+   which is used if the host has it */
+UINT64 i860_fzchk_scalar (UINT64 src1, UINT64 src2, int is16, UINT32 *le);
+#if defined(__SSE2__)
+UINT64 i860_fzchk_sse2 (UINT64 src1, UINT64 src2, int is16, UINT32 *le);
+#endif
 
 #endif /* __I860_H__ */
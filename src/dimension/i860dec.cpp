@@ -376,6 +376,7 @@ inline void i860_cpu_device::writemem_emu (UINT32 addr, int size, UINT8 *data) {
 #endif
     
 	/* Now do the actual write.  */
+    m_spin_break = true;
     wrmem[size](nd, addr, (UINT32*)data);
 }
 
@@ -411,6 +412,10 @@ inline void i860_cpu_device::readmem_emu (UINT32 addr, int size, UINT8 *dest)
 		return;
 	}
 #endif
+    if (addr != m_spin_addr) {
+        m_spin_addr  = addr;
+        m_spin_break = true;
+    }
     rdmem[size](nd, addr, (UINT32*)dest);
 }
 
@@ -447,7 +452,8 @@ inline void i860_cpu_device::writemem_emu (UINT32 addr, int size, UINT8 *data, U
 		return;
 	}
 #endif
-        
+    
+    m_spin_break = true;
     if(size == 8 && wmask != 0xff) {
         if (wmask & 0x80) wrmem[1](nd, addr+0, (UINT32*)&data[0]);
         if (wmask & 0x40) wrmem[1](nd, addr+1, (UINT32*)&data[1]);
@@ -3381,6 +3387,72 @@ void i860_cpu_device::insn_fcmp (UINT32 insn) {
 }
 
 
+/* Z-buffer check on 16-bit (is16) or 32-bit unsigned fields. Returns the
+   smaller field of each pair and sets bit i of *le if field i of src2 is
+   less than or equal to field i of src1.  */
+UINT64 i860_fzchk_scalar (UINT64 src1, UINT64 src2, int is16, UINT32 *le)
+{
+	UINT64 r = 0;
+	int bits = is16 ? 16 : 32;
+	int n = 64 / bits;
+	UINT64 fmask = is16 ? 0xffff : 0xffffffff;
+
+	*le = 0;
+	for (int i = 0; i < n; i++)
+	{
+		UINT64 ps1 = (src1 >> (i * bits)) & fmask;
+		UINT64 ps2 = (src2 >> (i * bits)) & fmask;
+		if (ps2 <= ps1)
+		{
+			r |= ps2 << (i * bits);
+			*le |= 1 << i;
+		}
+		else
+			r |= ps1 << (i * bits);
+	}
+	return r;
+}
+
+#if defined(__SSE2__)
+UINT64 i860_fzchk_sse2 (UINT64 src1, UINT64 src2, int is16, UINT32 *le)
+{
+	__m128i a = _mm_set_epi64x (0, (long long)src1);
+	__m128i b = _mm_set_epi64x (0, (long long)src2);
+	__m128i gt;
+	UINT32 gtmask;
+
+	/* There is no unsigned compare, so flip the sign bits first.  */
+	if (is16)
+	{
+		__m128i bias = _mm_set1_epi16 ((short)0x8000);
+		gt = _mm_cmpgt_epi16 (_mm_xor_si128 (b, bias), _mm_xor_si128 (a, bias));
+		gtmask = _mm_movemask_epi8 (_mm_packs_epi16 (gt, gt)) & 0x0f;
+		*le = ~gtmask & 0x0f;
+	}
+	else
+	{
+		__m128i bias = _mm_set1_epi32 ((int)0x80000000);
+		gt = _mm_cmpgt_epi32 (_mm_xor_si128 (b, bias), _mm_xor_si128 (a, bias));
+		gtmask = _mm_movemask_ps (_mm_castsi128_ps (gt)) & 0x03;
+		*le = ~gtmask & 0x03;
+	}
+	__m128i r = _mm_or_si128 (_mm_and_si128 (gt, a), _mm_andnot_si128 (gt, b));
+	UINT64 result;
+	_mm_storel_epi64 ((__m128i *)&result, r);
+	return result;
+}
+#endif
+
+static inline UINT64 fzchk_kernel (UINT64 src1, UINT64 src2, int is16, UINT32 *le)
+{
+#if defined(__SSE2__)
+	return i860_fzchk_sse2 (src1, src2, is16, le);
+#else
+	return i860_fzchk_scalar (src1, src2, is16, le);
+#endif
+}
+
+
 /* Execute [p]fzchk{l,s} fsrc1,fsrc2,fdest.
    The fzchk instructions have S and R bits set.  */
 void i860_cpu_device::insn_fzchk (UINT32 insn)
@@ -3391,13 +3463,13 @@ void i860_cpu_device::insn_fzchk (UINT32 insn)
 	int piped = insn & 0x400;        /* 1 = pipelined, 0 = scalar.  */
 	int is_fzchks = insn & 8;        /* 1 = fzchks, 0 = fzchkl.  */
 	FLOAT64 dbl_tmp_dest = FLOAT64_ZERO;
-	int i;
 	FLOAT64 v1 = get_fregval_d (fsrc1);
 	FLOAT64 v2 = get_fregval_d (fsrc2);
 	UINT64 iv1 = *(UINT64 *)&v1;
 	UINT64 iv2 = *(UINT64 *)&v2;
 	UINT64 r = 0;
-	char pm = GET_PSR_PM ();
+	UINT32 le;
+	UINT32 pm = GET_PSR_PM ();
 
 #if TRACE_UNDEFINED_I860
 	/* Check for S and R bits set.  */
@@ -3413,41 +3485,13 @@ void i860_cpu_device::insn_fzchk (UINT32 insn)
 	   pixels (pixels are unsigned ordinals in this context).  */
 	if (is_fzchks)
 	{
-		pm = (pm >> 4) & 0x0f;
-		for (i = 3; i >= 0; i--)
-		{
-			UINT16 ps1 = (iv1 >> (i * 16)) & 0xffff;
-			UINT16 ps2 = (iv2 >> (i * 16)) & 0xffff;
-			if (ps2 <= ps1)
-			{
-				r |= ((UINT64)ps2 << (i * 16));
-				pm |= (1 << (7 - (3 - i)));
-			}
-			else
-			{
-				r |= ((UINT64)ps1 << (i * 16));
-				pm &= ~(1 << (7 - (3 - i)));
-			}
-		}
+		r = fzchk_kernel (iv1, iv2, 1, &le);
+		pm = ((pm >> 4) & 0x0f) | (le << 4);
 	}
 	else
 	{
-		pm = (pm >> 2) & 0x3f;
-		for (i = 1; i >= 0; i--)
-		{
-			UINT32 ps1 = (iv1 >> (i * 32)) & 0xffffffff;
-			UINT32 ps2 = (iv2 >> (i * 32)) & 0xffffffff;
-			if (ps2 <= ps1)
-			{
-				r |= ((UINT64)ps2 << (i * 32));
-				pm |= (1 << (7 - (1 - i)));
-			}
-			else
-			{
-				r |= ((UINT64)ps1 << (i * 32));
-				pm &= ~(1 << (7 - (1 - i)));
-			}
-		}
+		r = fzchk_kernel (iv1, iv2, 0, &le);
+		pm = ((pm >> 2) & 0x3f) | (le << 6);
 	}
 
 	dbl_tmp_dest = *(FLOAT64 *)&r;
@@ -135,6 +135,12 @@ public:
 
 class ND_VRAM : public ND_Addrbank {
     Uint8* base;
+    
+    /* Unaligned accesses touch bytes from addr-2 to addr+5 */
+    void set_dirty(Uint32 addr) const {
+        nd->vram_dirty[((addr-2) & ND_VRAM_MASK) >> ND_VRAM_DIRTY_SHIFT] = 1;
+        nd->vram_dirty[((addr+5) & ND_VRAM_MASK) >> ND_VRAM_DIRTY_SHIFT] = 1;
+    }
 public:
     ND_VRAM(NextDimension* nd) : ND_Addrbank(nd), base(nd->vram) {
         // sanity checks for ARGB mem access
@@ -177,6 +183,7 @@ public:
 
     void lput(Uint32 addr, Uint32 l) const {
         addr &= ND_VRAM_MASK;
+        set_dirty(addr);
         switch (addr&3) {
             case 0: base[addr+2] = l >> 24; base[addr+1] = l >> 16; base[addr+0] = l >> 8; base[addr+3] = l; break;
             case 1: base[addr+0] = l >> 24; base[addr-1] = l >> 16; base[addr+2] = l >> 8; base[addr+5] = l; break;
@@ -198,6 +205,7 @@ public:
 
     void wput(Uint32 addr, Uint32 w) const {
         addr &= ND_VRAM_MASK;
+        set_dirty(addr);
         switch (addr&3) {
             case 0: base[addr+2] = w >> 8; base[addr+1] = w; break;
             case 1: base[addr+0] = w >> 8; base[addr-1] = w; break;
@@ -219,6 +227,7 @@ public:
 
     void bput(Uint32 addr, Uint32 b) const {
         addr &= ND_VRAM_MASK;
+        set_dirty(addr);
         switch(addr&3) {
             case 0: base[addr+2] = b; break;
             case 1: base[addr+0] = b; break;
@@ -451,6 +460,17 @@ void NextDimension::init_mem_banks(void) {
     ND_Addrbank* nd_illegal_bank = new ND_Addrbank(this);
     for (int i = 0; i < 65536; i++)
         nd_put_mem_bank(i<<16, nd_illegal_bank);
+    for (int i = 0; i < ND_HOST_BANKS; i++) {
+        ram_banks[i]  = NULL;
+        vram_banks[i] = NULL;
+    }
+}
+
+/* Host pointers let the i860 bypass the bank objects for plain memory,
+ * start must lie in the space covered by the tables (see ND_HOST_SPACE) */
+void NextDimension::map_host_banks(Uint8** banks, Uint8* base, Uint32 mask, Uint32 start, Uint32 size) {
+    for (Uint32 addr = start; addr - start < size; addr += 0x10000)
+        banks[(addr >> 16) & (ND_HOST_BANKS - 1)] = base + (addr & mask);
 }
 
 #define write_log printf
@@ -471,6 +491,7 @@ void NextDimension::mem_init(void) {
         if (ConfigureParams.Dimension.board[ND_NUM(slot)].nMemoryBankSize[bank]) {
             bankmask[bank] = ND_RAM_BANKMASK|((ConfigureParams.Dimension.board[ND_NUM(slot)].nMemoryBankSize[bank]<<20)-1);
             map_banks(new ND_RAM(this, bank), (ND_RAM_START+(bank*ND_RAM_BANKSIZE))>>16, ND_RAM_BANKSIZE >> 16);
+            map_host_banks(ram_banks, ram, bankmask[bank], ND_RAM_START+(bank*ND_RAM_BANKSIZE), ND_RAM_BANKSIZE);
             write_log("[ND] Slot %i: Mapping main memory bank%d at $%08x: %iMB\n", slot, bank,
                       (ND_RAM_START+(bank*ND_RAM_BANKSIZE)), ConfigureParams.Dimension.board[ND_NUM(slot)].nMemoryBankSize[0]);
         } else {
@@ -484,6 +505,7 @@ void NextDimension::mem_init(void) {
     write_log("[ND] Slot %i: Mapping video memory at $%08x: %iMB\n", slot,
               ND_VRAM_START, ND_VRAM_SIZE/(1024*1024));
     map_banks(new ND_VRAM(this), ND_VRAM_START>>16, (4*ND_VRAM_SIZE)>>16);
+    map_host_banks(vram_banks, vram, ND_VRAM_MASK, ND_VRAM_START, 4*ND_VRAM_SIZE);
     
 	write_log("[ND] Slot %i: Mapping ROM at $%08x: %ikB\n", slot,
               ND_EEPROM_START, ND_EEPROM_SIZE/1024);
@@ -15,7 +15,34 @@ const int BLANK_MS       = 2;         // Give some blank time for both
 volatile bool NDSDL::ndVBLtoggle;
 volatile bool NDSDL::ndVideoVBLtoggle;
 
-NDSDL::NDSDL(int slot, Uint32* vram) : slot(slot), doRepaint(true), repaintThread(NULL), ndWindow(NULL), ndRenderer(NULL), vram(vram) {}
+NDSDL::NDSDL(int slot, Uint32* vram, volatile Uint8* vram_dirty) : slot(slot), doRepaint(true), repaintThread(NULL), ndWindow(NULL), ndRenderer(NULL), vram(vram), vram_dirty(vram_dirty) {}
+
+/* Upload only the lines of the visible area that were written since the
+   last frame. Flags are cleared before the copy, so concurrent writes are
+   picked up by the next frame. */
+void NDSDL::blit_dirty(SDL_Texture* tex) {
+    const int pitch = (1120+32)*4;
+    const int last  = (832*pitch-1) >> ND_VRAM_DIRTY_SHIFT;
+    
+    for (int blk = 0; blk <= last; blk++) {
+        if (!vram_dirty[blk]) continue;
+        
+        int first = blk;
+        while (blk <= last && vram_dirty[blk]) {
+            vram_dirty[blk] = 0;
+            blk++;
+        }
+        
+        SDL_Rect lines;
+        lines.x = 0;
+        lines.w = 1120;
+        lines.y = (first << ND_VRAM_DIRTY_SHIFT) / pitch;
+        lines.h = ((blk << ND_VRAM_DIRTY_SHIFT) - 1) / pitch;
+        if (lines.h > 831) lines.h = 831;
+        lines.h -= lines.y - 1;
+        blitDimension(vram, tex, &lines);
+    }
+}
 
 int NDSDL::repainter(void *_this) {
     return ((NDSDL*)_this)->repainter();
@@ -40,9 +67,13 @@ int NDSDL::repainter(void) {
     
     SDL_AtomicSet(&blitNDFB, 1);
     
+    /* The new texture needs a full upload */
+    for (int i = 0; i < ND_VRAM_DIRTY_BLOCKS; i++)
+        vram_dirty[i] = 1;
+    
     while(doRepaint) {
         if (SDL_AtomicGet(&blitNDFB)) {
-            blitDimension(vram, ndTexture);
+            blit_dirty(ndTexture);
             SDL_RenderCopy(ndRenderer, ndTexture, NULL, NULL);
             SDL_RenderPresent(ndRenderer);
         } else {
@@ -91,20 +122,30 @@ void NDSDL::start_interrupts() {
     CycInt_AddRelativeInterruptUs(1000, 0, INTERRUPT_ND_VIDEO_VBL);
 }
 
+#define ND_VBL_PERIOD ((1000*1000)/136)
+
+static Uint64 ndVBLTime;
+
 // called from m68k thread
 void nd_vbl_handler(void)       {
     CycInt_AcknowledgeInterrupt();
 
+    // i860 @ 33MHz for the emulated time since the last VBL
+    Uint64 now     = host_time_us();
+    Uint64 elapsed = now - ndVBLTime;
+    if (elapsed > 4 * ND_VBL_PERIOD) elapsed = ND_VBL_PERIOD;
+    ndVBLTime = now;
+
     FOR_EACH_SLOT(slot) {
         IF_NEXT_DIMENSION(slot, nd) {
             host_blank(nd->slot, ND_DISPLAY, NDSDL::ndVBLtoggle);
-            nd->i860.i860cycles = (1000*1000*33)/136;
+            nd->i860.add_cycles((int)(elapsed * 33));
         }
     }
     NDSDL::ndVBLtoggle = !NDSDL::ndVBLtoggle;
 
     // 136Hz with toggle gives 68Hz, blank time is 1/2 frame time
-    CycInt_AddRelativeInterruptUs((1000*1000)/136, 0, INTERRUPT_ND_VBL);
+    CycInt_AddRelativeInterruptUs(ND_VBL_PERIOD, 0, INTERRUPT_ND_VBL);
 }
 
 // called from m68k thread
@@ -7,6 +7,10 @@
 #include <SDL_thread.h>
 #include "cycInt.h"
 
+/* VRAM writes are tracked in 4 KB blocks */
+#define ND_VRAM_DIRTY_SHIFT  12
+#define ND_VRAM_DIRTY_BLOCKS ((4*1024*1024) >> ND_VRAM_DIRTY_SHIFT)
+
 #ifdef __cplusplus
 
 class NDSDL {
@@ -17,14 +21,16 @@ class NDSDL {
     SDL_Renderer* ndRenderer;
     SDL_atomic_t  blitNDFB;
     Uint32*       vram;
+    volatile Uint8* vram_dirty;
     
     static int    repainter(void *_this);
     int           repainter(void);
+    void          blit_dirty(SDL_Texture* tex);
 public:
     static volatile bool ndVBLtoggle;
     static volatile bool ndVideoVBLtoggle;
 
-    NDSDL(int slot, Uint32* vram);
+    NDSDL(int slot, Uint32* vram, volatile Uint8* vram_dirty);
     void    init(void);
     void    uninit(void);
     void    pause(bool pause);
@@ -25,6 +25,7 @@
 #include "mmu_common.h"
 #include "kms.h"
 #include "audio.h"
+#include "memorySnapShot.h"
 
 #define LOG_DMA_LEVEL LOG_DEBUG
 
@@ -51,6 +52,9 @@ struct {
     Uint8 direction;
 } dma[12];
 
+/* Completed buffers per channel for batch reports */
+Uint64 nDMACompleted[12];
+
 
 /* DMA internal buffers */
 #define DMA_BURST_SIZE  16
@@ -227,6 +231,9 @@ void DMA_CSR_Write(void) {
             }
             dma_m2m();
         }
+        if (channel == CHANNEL_EN_TX || channel == CHANNEL_EN_RX) {
+            enet_wakeup();
+        }
     }
     if (writecsr&DMA_CLRCOMPLETE) {
         dma[channel].csr &= ~DMA_COMPLETE;
@@ -374,6 +381,7 @@ void dma_interrupt(int channel) {
     if (dma[channel].next==dma[channel].limit) {
         
         dma[channel].csr |= DMA_COMPLETE;
+        nDMACompleted[channel]++;
         
         if (dma[channel].csr & DMA_SUPDATE) { /* if we are in chaining mode */
             dma[channel].next = dma[channel].start;
@@ -881,6 +889,10 @@ bool dma_enet_read_memory(void) {
     return false;
 }
 
+bool dma_enet_tx_enabled(void) {
+    return (dma[CHANNEL_EN_TX].csr&DMA_ENABLE) ? true : false;
+}
+
 
 /* Memory to Memory */
 
@@ -1143,6 +1155,9 @@ void TDMA_CSR_Write(void) {
 	}
 	if (writecsr&TDMA_SETENABLE) {
 		dma[channel].csr |= DMA_ENABLE;
+		if (channel == CHANNEL_EN_TX || channel == CHANNEL_EN_RX) {
+			enet_wakeup();
+		}
 	}
 	if (writecsr&TDMA_CLRCOMPLETE) {
 		dma[channel].csr &= ~DMA_COMPLETE;
@@ -1191,3 +1206,18 @@ void tdma_flush_buffer(int channel) {
 	
 	dma_interrupt(CHANNEL_SCSI);
 }
+
+
+/* Save/restore channel registers and the internal burst buffers */
+void DMA_MemorySnapShot_Capture(bool bSave) {
+	MemorySnapShot_Store(dma, sizeof(dma));
+	MemorySnapShot_Store(&espdma_buf_size, sizeof(espdma_buf_size));
+	MemorySnapShot_Store(&espdma_buf_limit, sizeof(espdma_buf_limit));
+	MemorySnapShot_Store(espdma_buf, sizeof(espdma_buf));
+	MemorySnapShot_Store(&modma_buf_size, sizeof(modma_buf_size));
+	MemorySnapShot_Store(&modma_buf_limit, sizeof(modma_buf_limit));
+	MemorySnapShot_Store(modma_buf, sizeof(modma_buf));
+	MemorySnapShot_Store(&saved_next_turbo, sizeof(saved_next_turbo));
+	MemorySnapShot_Store(m2m_buffer, sizeof(m2m_buffer));
+	MemorySnapShot_Store(&m2m_buffer_size, sizeof(m2m_buffer_size));
+}
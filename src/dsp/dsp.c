@@ -33,6 +33,8 @@
 #include "m68000.h"
 #include "sysReg.h"
 #include "dma.h"
+#include "host.h"
+#include "memorySnapShot.h"
 
 #if ENABLE_DSP_EMU
 #include "dsp_cpu.h"
@@ -62,6 +64,17 @@ static const char* x_ext_memory_addr_name[] = {
 };
 
 static Sint32 save_cycles;
+
+/* Optional DSP thread (ConfigureParams.System.bDSPThread) */
+#define DSP_THREAD_QUANTUM	256	/* DSP cycles handed over to the thread at once */
+#define DSP_THREAD_MAX_SKEW	8192	/* DSP cycles the thread may lag behind the host CPU */
+
+static thread_t*  dsp_thread;
+static atomic_int dsp_thread_run;
+static atomic_int dsp_thread_cycles;	/* DSP cycles not yet executed by the thread */
+static atomic_int dsp_thread_hreq;	/* Pending HREQ change: 0 none, else state+1 */
+static lock_t     dsp_thread_lock;	/* Protects dsp_core while the thread is running */
+static Sint32     dsp_thread_pending;	/* DSP cycles not yet handed over to the thread */
 #endif
 
 static bool bDspDebugging;
@@ -87,6 +100,49 @@ void DSP_HandleTXD(int set) {
 #endif
 
 
+/**
+ * DSP thread synchronization. When the DSP runs on its own thread, all
+ * accesses to dsp_core from the host CPU thread must hold the lock.
+ */
+#if ENABLE_DSP_EMU
+static inline void DSP_Lock(void)
+{
+	if (dsp_thread) {
+		host_lock(&dsp_thread_lock);
+	}
+}
+
+static inline void DSP_Unlock(void)
+{
+	if (dsp_thread) {
+		host_unlock(&dsp_thread_lock);
+	}
+}
+
+/**
+ * Set or release the DSP interrupt at the host CPU. The DSP thread can not
+ * touch host CPU state, so changes are passed on by DSP_CheckHREQ().
+ */
+static void DSP_SetHostInterrupt(Uint8 state)
+{
+	if (dsp_thread) {
+		host_atomic_set(&dsp_thread_hreq, state+1);
+	} else {
+		set_dsp_interrupt(state);
+	}
+}
+
+static inline void DSP_CheckHREQ(void)
+{
+	int hreq = host_atomic_set(&dsp_thread_hreq, 0);
+
+	if (hreq) {
+		set_dsp_interrupt(hreq-1);
+	}
+}
+#endif
+
+
 /**
  * Handle HREQ at the host CPU.
  */
@@ -94,7 +150,7 @@ void DSP_HandleTXD(int set) {
 static void DSP_HandleHREQ(int set)
 {
     if (dsp_core.dma_mode) {
-		set_dsp_interrupt(RELEASE_INT);
+		DSP_SetHostInterrupt(RELEASE_INT);
         if (set) {
 			dsp_core.dma_request = 1;
         } else {
@@ -104,16 +160,45 @@ static void DSP_HandleHREQ(int set)
 		dsp_core.dma_request = 0;
         if (set) {
             Log_Printf(LOG_DSP_LEVEL, "[DSP] Set HREQ interrupt");
-			set_dsp_interrupt(SET_INT);
+			DSP_SetHostInterrupt(SET_INT);
         } else {
             Log_Printf(LOG_DSP_LEVEL, "[DSP] Release HREQ interrupt");
-			set_dsp_interrupt(RELEASE_INT);
+			DSP_SetHostInterrupt(RELEASE_INT);
         }
     }
 }
 #endif
 
 
+/**
+ * Host port access from the host CPU thread.
+ */
+#if ENABLE_DSP_EMU
+static Uint8 DSP_ReadHost(int addr)
+{
+	Uint8 value;
+
+	DSP_Lock();
+	value = dsp_core_read_host(addr);
+	DSP_Unlock();
+	if (dsp_thread) {
+		DSP_CheckHREQ();
+	}
+	return value;
+}
+
+static void DSP_WriteHost(int addr, Uint8 value)
+{
+	DSP_Lock();
+	dsp_core_write_host(addr, value);
+	DSP_Unlock();
+	if (dsp_thread) {
+		DSP_CheckHREQ();
+	}
+}
+#endif
+
+
 /**
  * Host DSP DMA interface
  */
@@ -125,7 +210,9 @@ void DSP_SetIRQB(void)
 {
 #if ENABLE_DSP_EMU
     if (dsp_intr_at_block_end) {
+		DSP_Lock();
 		dsp_set_interrupt(DSP_INTER_IRQB, 1);
+		DSP_Unlock();
     }
 #endif
 }
@@ -190,6 +277,104 @@ bool	DSP_ProcessIRQ(void)
 #endif
 
 
+/**
+ * DSP thread: execute the cycles handed over by the host CPU in small
+ * quanta, releasing the lock in between for host port accesses.
+ */
+#if ENABLE_DSP_EMU
+static int DSP_Thread(void *data)
+{
+	Sint32 cycles, done;
+
+	while (host_atomic_get(&dsp_thread_run)) {
+		cycles = host_atomic_get(&dsp_thread_cycles);
+		if (cycles <= 0) {
+			host_sleep_us(10);
+			continue;
+		}
+
+		done = 0;
+		host_lock(&dsp_thread_lock);
+		while (dsp_core.running && done < cycles && done < DSP_THREAD_QUANTUM) {
+			dsp56k_execute_instruction();
+			done += dsp_core.instr_cycle;
+		}
+		host_unlock(&dsp_thread_lock);
+
+		/* Drop cycles if the DSP has been stopped meanwhile */
+		host_atomic_add(&dsp_thread_cycles, -(done ? done : cycles));
+	}
+	return 0;
+}
+
+static void DSP_StartThread(void)
+{
+	if (dsp_thread || !ConfigureParams.System.bDSPThread) {
+		return;
+	}
+	Log_Printf(LOG_WARN, "[DSP] Using separate thread for DSP");
+	dsp_thread_pending = 0;
+	host_atomic_set(&dsp_thread_cycles, 0);
+	host_atomic_set(&dsp_thread_hreq, 0);
+	host_atomic_set(&dsp_thread_run, 1);
+	dsp_thread = host_thread_create(DSP_Thread, "[Previous] DSP", NULL);
+}
+
+/**
+ * Wait until the DSP thread has executed all cycles handed over to it.
+ * It does not touch dsp_core afterwards until the host CPU thread hands
+ * over more cycles, so the debugger can access the core without the lock.
+ */
+static void DSP_WaitThread(void)
+{
+	if (dsp_thread) {
+		while (host_atomic_get(&dsp_thread_cycles) > 0) {
+			host_sleep_ms(0);
+		}
+	}
+}
+
+static void DSP_StopThread(void)
+{
+	if (!dsp_thread) {
+		return;
+	}
+	host_atomic_set(&dsp_thread_run, 0);
+	host_thread_wait(dsp_thread);
+	dsp_thread = NULL;
+	DSP_CheckHREQ();
+}
+
+/**
+ * Hand over DSP cycles to the DSP thread. The host CPU waits if the thread
+ * falls behind by more than DSP_THREAD_MAX_SKEW cycles.
+ */
+static void DSP_RunThread(int nHostCycles)
+{
+	dsp_thread_pending += nHostCycles * 2;
+
+	if (dsp_thread_pending >= DSP_THREAD_QUANTUM) {
+		host_atomic_add(&dsp_thread_cycles, dsp_thread_pending);
+		dsp_thread_pending = 0;
+
+		/* Wait for the DSP thread, giving up the time slice in case
+		 * it has to share a core with the host CPU thread */
+		while (host_atomic_get(&dsp_thread_cycles) > DSP_THREAD_MAX_SKEW) {
+			host_sleep_ms(0);
+		}
+	}
+
+	DSP_CheckHREQ();
+
+	if (dsp_core.dma_request) {
+		host_lock(&dsp_thread_lock);
+		DSP_HandleDMA();
+		host_unlock(&dsp_thread_lock);
+	}
+}
+#endif
+
+
 /**
  * Initialize the DSP emulation
  */
@@ -214,6 +399,7 @@ void DSP_UnInit(void)
 #if ENABLE_DSP_EMU
 	if (!bDspEnabled)
 		return;
+	DSP_StopThread();
 	dsp_core_shutdown();
 	bDspEnabled = false;
 #endif
@@ -239,8 +425,51 @@ void DSP_Reset(void)
 	}
 	Statusbar_SetDspLed(false);
 
+	DSP_StopThread();
 	dsp_core_reset();
 	save_cycles = 0;
+	if (bDspEmulated) {
+		DSP_StartThread();
+	}
+#endif
+}
+
+
+/**
+ * Stop or restart the DSP thread. While it is stopped, the DSP
+ * is run by the CPU thread.
+ */
+void DSP_Pause(bool pause)
+{
+#if ENABLE_DSP_EMU
+	if (pause) {
+		DSP_StopThread();
+	} else if (bDspEmulated) {
+		DSP_StartThread();
+	}
+#endif
+}
+
+
+/**
+ * Save/Restore snapshot of DSP state. The DSP thread is stopped
+ * while the core is accessed.
+ */
+void DSP_MemorySnapShot_Capture(bool bSave)
+{
+#if ENABLE_DSP_EMU
+	bool bThread = (dsp_thread != NULL);
+
+	DSP_StopThread();
+	MemorySnapShot_Store(&dsp_core, sizeof(dsp_core));
+	MemorySnapShot_Store(&save_cycles, sizeof(save_cycles));
+	MemorySnapShot_Store(&bDspHostInterruptPending, sizeof(bDspHostInterruptPending));
+	if (!bSave) {
+		dsp56k_flush_decode_cache();
+	}
+	if (bThread) {
+		DSP_StartThread();
+	}
 #endif
 }
 
@@ -254,7 +483,9 @@ void DSP_Start(Uint8 mode)
 		return;
 	}
 #if ENABLE_DSP_EMU
+	DSP_Lock();
     dsp_core_start(mode);
+	DSP_Unlock();
     save_cycles = 0;
 #endif
 }
@@ -265,6 +496,11 @@ void DSP_Start(Uint8 mode)
 void DSP_Run(int nHostCycles)
 {
 #if ENABLE_DSP_EMU
+	if (dsp_thread) {
+		DSP_RunThread(nHostCycles);
+		return;
+	}
+
 	save_cycles += nHostCycles * 2;
 	
 	while (save_cycles > 0)
@@ -291,9 +527,14 @@ void DSP_SetDebugging(bool enabled)
 Uint16 DSP_GetPC(void)
 {
 #if ENABLE_DSP_EMU
-	if (bDspEnabled)
-		return dsp_core.pc;
-	else
+	Uint16 pc;
+
+	if (bDspEnabled) {
+		DSP_Lock();
+		pc = dsp_core.pc;
+		DSP_Unlock();
+		return pc;
+	}
 #endif
 	return 0;
 }
@@ -311,6 +552,8 @@ Uint16 DSP_GetNextPC(Uint16 pc)
 	if (!bDspEnabled)
 		return 0;
 
+	DSP_WaitThread();
+
 	/* Save DSP context */
 	memcpy(&dsp_core_save, &dsp_core, sizeof(dsp_core));
 
@@ -336,9 +579,14 @@ Uint16 DSP_GetNextPC(Uint16 pc)
 Uint16 DSP_GetInstrCycles(void)
 {
 #if ENABLE_DSP_EMU
-	if (bDspEnabled)
-		return dsp_core.instr_cycle;
-	else
+	Uint16 cycles;
+
+	if (bDspEnabled) {
+		DSP_Lock();
+		cycles = dsp_core.instr_cycle;
+		DSP_Unlock();
+		return cycles;
+	}
 #endif
 	return 0;
 }
@@ -352,6 +600,7 @@ Uint16 DSP_DisasmAddress(FILE *out, Uint16 lowerAdr, Uint16 UpperAdr)
 #if ENABLE_DSP_EMU
 	Uint16 dsp_pc;
 
+	DSP_WaitThread();
 	for (dsp_pc=lowerAdr; dsp_pc<=UpperAdr; dsp_pc++) {
 		dsp_pc += dsp56k_execute_one_disasm_instruction(out, dsp_pc);
 	}
@@ -381,6 +630,8 @@ Uint32 DSP_ReadMemory(Uint16 address, char space_id, const char **mem_str)
 	};
 	int idx, space;
 
+	DSP_WaitThread();
+
 	switch (space_id) {
 	case 'X':
 		space = DSP_SPACE_X;
@@ -458,6 +709,7 @@ Uint16 DSP_DisasmMemory(Uint16 dsp_memdump_addr, Uint16 dsp_memdump_upper, char
 	Uint32 mem, mem2, value;
 	const char *mem_str;
 
+	DSP_WaitThread();
 	for (mem = dsp_memdump_addr; mem <= dsp_memdump_upper; mem++) {
 		/* special printing of host communication/transmit registers */
 		if (space == 'X' && mem >= 0xffc0) {
@@ -503,6 +755,7 @@ void DSP_Info(Uint32 dummy)
 	int i, j;
 	const char *stackname[] = { "SSH", "SSL" };
 
+	DSP_WaitThread();
 	fputs("DSP core information:\n", stderr);
 
 	for (i = 0; i < ARRAYSIZE(stackname); i++) {
@@ -546,6 +799,7 @@ void DSP_DisasmRegisters(void)
 #if ENABLE_DSP_EMU
 	Uint32 i;
 
+	DSP_WaitThread();
 	fprintf(stderr,"A: A2: %02x  A1: %06x  A0: %06x\n",
 		dsp_core.registers[DSP_REG_A2], dsp_core.registers[DSP_REG_A1], dsp_core.registers[DSP_REG_A0]);
 	fprintf(stderr,"B: B2: %02x  B1: %06x  B0: %06x\n",
@@ -663,6 +917,9 @@ int DSP_GetRegisterAddress(const char *regname, Uint32 **addr, Uint32 *mask)
 		return 0;
 	}
 
+	/* The register is accessed through the returned address */
+	DSP_WaitThread();
+
 	for (i = 0; i < sizeof(reg) && regname[i]; i++) {
 		reg[i] = toupper((unsigned char)regname[i]);
 	}
@@ -709,6 +966,8 @@ bool DSP_Disasm_SetRegister(const char *arg, Uint32 value)
 	Uint32 *addr, mask, sp_value;
 	int bits;
 
+	DSP_WaitThread();
+
 	/* first check registers needing special handling... */
 	if (arg[0]=='S' || arg[0]=='s') {
 		if (arg[1]=='P' || arg[1]=='p') {
@@ -763,7 +1022,12 @@ bool DSP_Disasm_SetRegister(const char *arg, Uint32 value)
 Uint32 DSP_SsiReadTxValue(void)
 {
 #if ENABLE_DSP_EMU
-	return dsp_core.ssi.transmit_value;
+	Uint32 value;
+
+	DSP_Lock();
+	value = dsp_core.ssi.transmit_value;
+	DSP_Unlock();
+	return value;
 #else
 	return 0;
 #endif
@@ -775,7 +1039,9 @@ Uint32 DSP_SsiReadTxValue(void)
 void DSP_SsiWriteRxValue(Uint32 value)
 {
 #if ENABLE_DSP_EMU
+	DSP_Lock();
 	dsp_core.ssi.received_value = value & 0xffffff;
+	DSP_Unlock();
 #endif
 }
 
@@ -786,7 +1052,9 @@ void DSP_SsiWriteRxValue(Uint32 value)
 void DSP_SsiReceive_SC0(void)
 {
 #if ENABLE_DSP_EMU
+	DSP_Lock();
 	dsp_core_ssi_Receive_SC0();
+	DSP_Unlock();
 #endif
 }
 
@@ -799,7 +1067,9 @@ void DSP_SsiTransmit_SC0(void)
 void DSP_SsiReceive_SC1(Uint32 FrameCounter)
 {
 #if ENABLE_DSP_EMU
+	DSP_Lock();
 	dsp_core_ssi_Receive_SC1(FrameCounter);
+	DSP_Unlock();
 #endif
 }
 
@@ -813,7 +1083,9 @@ void DSP_SsiTransmit_SC1(void)
 void DSP_SsiReceive_SC2(Uint32 FrameCounter)
 {
 #if ENABLE_DSP_EMU
+	DSP_Lock();
 	dsp_core_ssi_Receive_SC2(FrameCounter);
+	DSP_Unlock();
 #endif
 }
 
@@ -827,7 +1099,9 @@ void DSP_SsiTransmit_SC2(Uint32 frame)
 void DSP_SsiReceive_SCK(void)
 {
 #if ENABLE_DSP_EMU
+	DSP_Lock();
 	dsp_core_ssi_Receive_SCK();
+	DSP_Unlock();
 #endif
 }
 
@@ -851,7 +1125,7 @@ void DSP_HandleReadAccess(void)
 	for (addr = IoAccessBaseAddress; addr < IoAccessBaseAddress+nIoMemAccessSize; addr++)
 	{
 #if ENABLE_DSP_EMU
-		value = dsp_core_read_host(addr-DSP_HW_OFFSET);
+		value = DSP_ReadHost(addr-DSP_HW_OFFSET);
 #else
 		/* this value prevents TOS from hanging in the DSP init code */
 		value = 0xff;
@@ -880,7 +1154,7 @@ void DSP_HandleWriteAccess(void)
 #if ENABLE_DSP_EMU
 		Uint8 value = IoMem_ReadByte(addr);
 		Dprintf(("HWput_b(0x%08x,0x%02x) at 0x%08x\n", addr, value, m68k_getpc()));
-		dsp_core_write_host(addr-DSP_HW_OFFSET, value);
+		DSP_WriteHost(addr-DSP_HW_OFFSET, value);
 #endif
 		if (multi_access == true)
 			M68000_AddCycles(4);
@@ -920,7 +1194,7 @@ void DSP_HandleWriteAccess(void)
 void DSP_ICR_Read(void) { // 0x02008000
 #if ENABLE_DSP_EMU
 	if (bDspEmulated)
-		IoMem[IoAccessCurrentAddress & IO_SEG_MASK] = dsp_core_read_host(CPU_HOST_ICR);
+		IoMem[IoAccessCurrentAddress & IO_SEG_MASK] = DSP_ReadHost(CPU_HOST_ICR);
 	else
 		IoMem[IoAccessCurrentAddress & IO_SEG_MASK] = 0x7F;
 #else
@@ -932,7 +1206,7 @@ void DSP_ICR_Read(void) { // 0x02008000
 void DSP_ICR_Write(void) {
 #if ENABLE_DSP_EMU
 	if (bDspEmulated)
-		dsp_core_write_host(CPU_HOST_ICR, IoMem[IoAccessCurrentAddress & IO_SEG_MASK]);
+		DSP_WriteHost(CPU_HOST_ICR, IoMem[IoAccessCurrentAddress & IO_SEG_MASK]);
 #endif
     Log_Printf(LOG_DSP_REG_LEVEL,"[DSP] ICR write at $%08x val=$%02x PC=$%08x\n", IoAccessCurrentAddress, IoMem[IoAccessCurrentAddress & IO_SEG_MASK], m68k_getpc());
 }
@@ -940,7 +1214,7 @@ void DSP_ICR_Write(void) {
 void DSP_CVR_Read(void) { // 0x02008001
 #if ENABLE_DSP_EMU
 	if (bDspEmulated)
-		IoMem[IoAccessCurrentAddress & IO_SEG_MASK] = dsp_core_read_host(CPU_HOST_CVR);
+		IoMem[IoAccessCurrentAddress & IO_SEG_MASK] = DSP_ReadHost(CPU_HOST_CVR);
 	else
 		IoMem[IoAccessCurrentAddress & IO_SEG_MASK] = 0xFF;
 #else
@@ -952,7 +1226,7 @@ void DSP_CVR_Read(void) { // 0x02008001
 void DSP_CVR_Write(void) {
 #if ENABLE_DSP_EMU
 	if (bDspEmulated)
-		dsp_core_write_host(CPU_HOST_CVR, IoMem[IoAccessCurrentAddress & IO_SEG_MASK]);
+		DSP_WriteHost(CPU_HOST_CVR, IoMem[IoAccessCurrentAddress & IO_SEG_MASK]);
 #endif
     Log_Printf(LOG_DSP_REG_LEVEL,"[DSP] CVR write at $%08x val=$%02x PC=$%08x\n", IoAccessCurrentAddress, IoMem[IoAccessCurrentAddress & IO_SEG_MASK], m68k_getpc());
 }
@@ -960,7 +1234,7 @@ void DSP_CVR_Write(void) {
 void DSP_ISR_Read(void) { // 0x02008002
 #if ENABLE_DSP_EMU
 	if (bDspEmulated)
-		IoMem[IoAccessCurrentAddress & IO_SEG_MASK] = dsp_core_read_host(CPU_HOST_ISR);
+		IoMem[IoAccessCurrentAddress & IO_SEG_MASK] = DSP_ReadHost(CPU_HOST_ISR);
 	else
 		IoMem[IoAccessCurrentAddress & IO_SEG_MASK] = 0xFF;
 #else
@@ -972,7 +1246,7 @@ void DSP_ISR_Read(void) { // 0x02008002
 void DSP_ISR_Write(void) {
 #if ENABLE_DSP_EMU
 	if (bDspEmulated)
-		dsp_core_write_host(CPU_HOST_ISR, IoMem[IoAccessCurrentAddress & IO_SEG_MASK]);
+		DSP_WriteHost(CPU_HOST_ISR, IoMem[IoAccessCurrentAddress & IO_SEG_MASK]);
 #endif
     Log_Printf(LOG_DSP_REG_LEVEL,"[DSP] ISR write at $%08x val=$%02x PC=$%08x\n", IoAccessCurrentAddress, IoMem[IoAccessCurrentAddress & IO_SEG_MASK], m68k_getpc());
 }
@@ -980,7 +1254,7 @@ void DSP_ISR_Write(void) {
 void DSP_IVR_Read(void) { // 0x02008003
 #if ENABLE_DSP_EMU
 	if (bDspEmulated)
-		IoMem[IoAccessCurrentAddress & IO_SEG_MASK] = dsp_core_read_host(CPU_HOST_IVR);
+		IoMem[IoAccessCurrentAddress & IO_SEG_MASK] = DSP_ReadHost(CPU_HOST_IVR);
 	else
 		IoMem[IoAccessCurrentAddress & IO_SEG_MASK] = 0xFF;
 #else
@@ -992,7 +1266,7 @@ void DSP_IVR_Read(void) { // 0x02008003
 void DSP_IVR_Write(void) {
 #if ENABLE_DSP_EMU
 	if (bDspEmulated)
-		dsp_core_write_host(CPU_HOST_IVR, IoMem[IoAccessCurrentAddress & IO_SEG_MASK]);
+		DSP_WriteHost(CPU_HOST_IVR, IoMem[IoAccessCurrentAddress & IO_SEG_MASK]);
 #endif
     Log_Printf(LOG_DSP_REG_LEVEL,"[DSP] IVR write at $%08x val=$%02x PC=$%08x\n", IoAccessCurrentAddress, IoMem[IoAccessCurrentAddress & IO_SEG_MASK], m68k_getpc());
 }
@@ -1000,7 +1274,7 @@ void DSP_IVR_Write(void) {
 void DSP_Data0_Read(void) { // 0x02008004
 #if ENABLE_DSP_EMU
 	if (bDspEmulated)
-		IoMem[IoAccessCurrentAddress & IO_SEG_MASK] = dsp_core_read_host(CPU_HOST_TRX0);
+		IoMem[IoAccessCurrentAddress & IO_SEG_MASK] = DSP_ReadHost(CPU_HOST_TRX0);
 	else
 		IoMem[IoAccessCurrentAddress & IO_SEG_MASK] = 0x00;
 #else
@@ -1012,7 +1286,7 @@ void DSP_Data0_Read(void) { // 0x02008004
 void DSP_Data0_Write(void) {
 #if ENABLE_DSP_EMU
 	if (bDspEmulated)
-		dsp_core_write_host(CPU_HOST_TRX0, IoMem[IoAccessCurrentAddress & IO_SEG_MASK]);
+		DSP_WriteHost(CPU_HOST_TRX0, IoMem[IoAccessCurrentAddress & IO_SEG_MASK]);
 #endif
     Log_Printf(LOG_DSP_REG_LEVEL,"[DSP] Data0 write at $%08x val=$%02x PC=$%08x\n", IoAccessCurrentAddress, IoMem[IoAccessCurrentAddress & IO_SEG_MASK], m68k_getpc());
 }
@@ -1020,7 +1294,7 @@ void DSP_Data0_Write(void) {
 void DSP_Data1_Read(void) { // 0x02008005
 #if ENABLE_DSP_EMU
 	if (bDspEmulated)
-		IoMem[IoAccessCurrentAddress & IO_SEG_MASK] = dsp_core_read_host(CPU_HOST_TRXH);
+		IoMem[IoAccessCurrentAddress & IO_SEG_MASK] = DSP_ReadHost(CPU_HOST_TRXH);
 	else
 		IoMem[IoAccessCurrentAddress & IO_SEG_MASK] = 0x00;
 #else
@@ -1032,7 +1306,7 @@ void DSP_Data1_Read(void) { // 0x02008005
 void DSP_Data1_Write(void) {
 #if ENABLE_DSP_EMU
 	if (bDspEmulated)
-		dsp_core_write_host(CPU_HOST_TRXH, IoMem[IoAccessCurrentAddress & IO_SEG_MASK]);
+		DSP_WriteHost(CPU_HOST_TRXH, IoMem[IoAccessCurrentAddress & IO_SEG_MASK]);
 #endif
     Log_Printf(LOG_DSP_REG_LEVEL,"[DSP] Data1 write at $%08x val=$%02x PC=$%08x\n", IoAccessCurrentAddress, IoMem[IoAccessCurrentAddress & IO_SEG_MASK], m68k_getpc());
 }
@@ -1040,7 +1314,7 @@ void DSP_Data1_Write(void) {
 void DSP_Data2_Read(void) { // 0x02008006
 #if ENABLE_DSP_EMU
 	if (bDspEmulated)
-		IoMem[IoAccessCurrentAddress & IO_SEG_MASK] = dsp_core_read_host(CPU_HOST_TRXM);
+		IoMem[IoAccessCurrentAddress & IO_SEG_MASK] = DSP_ReadHost(CPU_HOST_TRXM);
 	else
 		IoMem[IoAccessCurrentAddress & IO_SEG_MASK] = 0x00;
 #else
@@ -1052,7 +1326,7 @@ void DSP_Data2_Read(void) { // 0x02008006
 void DSP_Data2_Write(void) {
 #if ENABLE_DSP_EMU
 	if (bDspEmulated)
-		dsp_core_write_host(CPU_HOST_TRXM, IoMem[IoAccessCurrentAddress & IO_SEG_MASK]);
+		DSP_WriteHost(CPU_HOST_TRXM, IoMem[IoAccessCurrentAddress & IO_SEG_MASK]);
 #endif
     Log_Printf(LOG_DSP_REG_LEVEL,"[DSP] Data2 write at $%08x val=$%02x PC=$%08x\n", IoAccessCurrentAddress, IoMem[IoAccessCurrentAddress & IO_SEG_MASK], m68k_getpc());
 }
@@ -1060,7 +1334,7 @@ void DSP_Data2_Write(void) {
 void DSP_Data3_Read(void) { // 0x02008007
 #if ENABLE_DSP_EMU
 	if (bDspEmulated)
-		IoMem[IoAccessCurrentAddress & IO_SEG_MASK] = dsp_core_read_host(CPU_HOST_TRXL);
+		IoMem[IoAccessCurrentAddress & IO_SEG_MASK] = DSP_ReadHost(CPU_HOST_TRXL);
 	else
 		IoMem[IoAccessCurrentAddress & IO_SEG_MASK] = 0x00;
 #else
@@ -1072,7 +1346,7 @@ void DSP_Data3_Read(void) { // 0x02008007
 void DSP_Data3_Write(void) {
 #if ENABLE_DSP_EMU
 	if (bDspEmulated)
-		dsp_core_write_host(CPU_HOST_TRXL, IoMem[IoAccessCurrentAddress & IO_SEG_MASK]);
+		DSP_WriteHost(CPU_HOST_TRXL, IoMem[IoAccessCurrentAddress & IO_SEG_MASK]);
 #endif
     Log_Printf(LOG_DSP_REG_LEVEL,"[DSP] Data3 write at $%08x val=$%02x PC=$%08x\n", IoAccessCurrentAddress, IoMem[IoAccessCurrentAddress & IO_SEG_MASK], m68k_getpc());
 }
@@ -41,6 +41,7 @@ extern void DSP_UnInit(void);
 extern void DSP_Reset(void);
 extern void DSP_Start(Uint8 mode);
 extern void DSP_Run(int nHostCycles);
+extern void DSP_Pause(bool pause);
 
 /* Save Dsp state to snapshot */
 extern void DSP_MemorySnapShot_Capture(bool bSave);
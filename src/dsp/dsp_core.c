@@ -1179,6 +1179,7 @@ void dsp_core_write_host(int addr, Uint8 value)
 
 				if (++dsp_core.bootstrap_pos == 0x200) {
 					LOG_TRACE(TRACE_DSP_STATE, "Dsp: wait bootstrap done\n");
+					dsp56k_flush_decode_cache();
 					Statusbar_SetDspLed(true);
 					dsp_core.registers[DSP_REG_R0] = dsp_core.bootstrap_pos;
 					dsp_core.registers[DSP_REG_OMR] = 0x02;
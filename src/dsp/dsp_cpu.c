@@ -102,6 +102,11 @@
 #define SIGN_PLUS  0
 #define SIGN_MINUS 1
 
+/* 56 bits accumulator values */
+#define DSP_ACC56_MASK	0x00ffffffffffffffULL	/* bits 55:0 */
+#define DSP_ACC56_EXT	0x00ff000000000000ULL	/* extension bits 55:48 */
+#define DSP_ACC56_MIN	0x0080000000000000ULL	/* sign bit, most negative value */
+
 /* Defines some bits values for access to external memory (X, Y, P) */
 /* These values will set/unset the corresponding bits in the variable access_to_ext_memory */
 /* to detect how many access to the external memory were done for a single instruction */
@@ -140,12 +145,23 @@ static Uint16 disasm_memory_ptr;		/* Pointer for memory change in disasm mode */
 
 typedef void (*dsp_emul_t)(void);
 
+/* Decoded instruction cache over P memory */
+/* Entries follow the physical memory layout, so aliased addresses share one */
+/* entry. Any write to internal P or external RAM clears the matching entry. */
+typedef struct {
+	dsp_emul_t	func;	/* NULL: not decoded */
+	Uint32		inst;
+} dsp_decoded_t;
+
+static dsp_decoded_t decode_int[0x200];
+static dsp_decoded_t decode_ext[DSP_RAMSIZE_MAX];
+
 static void dsp_postexecute_update_pc(void);
 static void dsp_postexecute_interrupts(void);
 
 static void dsp_setInterruptIPL(Uint32 value);
 
-static void dsp_ccr_update_e_u_n_z(Uint32 reg0, Uint32 reg1, Uint32 reg2);
+static void dsp_ccr_update_e_u_n_z(Uint64 value);
 
 static Uint32 read_memory(int space, Uint16 address);
 static inline Uint32 read_memory_p(Uint16 address);
@@ -259,13 +275,16 @@ static void dsp_pm_5(void);
 static void dsp_pm_8(void);
 
 /* 56bits arithmetic */
-static Uint16 dsp_abs56(Uint32 *dest);
-static Uint16 dsp_asl56(Uint32 *dest);
-static Uint16 dsp_asr56(Uint32 *dest);
-static Uint16 dsp_add56(Uint32 *source, Uint32 *dest);
-static Uint16 dsp_sub56(Uint32 *source, Uint32 *dest);
-static void dsp_mul56(Uint32 source1, Uint32 source2, Uint32 *dest, Uint8 signe);
-static void dsp_rnd56(Uint32 *dest);
+static inline Uint64 dsp_read_acc56(int numreg);
+static inline void dsp_write_acc56(int numreg, Uint64 value);
+static inline Uint64 dsp_sext56(Uint32 hi, Uint32 lo);
+static Uint16 dsp_abs56(Uint64 *dest);
+static Uint16 dsp_asl56(Uint64 *dest);
+static Uint16 dsp_asr56(Uint64 *dest);
+static Uint16 dsp_add56(Uint64 source, Uint64 *dest);
+static Uint16 dsp_sub56(Uint64 source, Uint64 *dest);
+static Uint64 dsp_mul56(Uint32 source1, Uint32 source2, Uint8 signe);
+static void dsp_rnd56(Uint64 *dest);
 
 /* Instructions with parallel moves */
 static void dsp_abs_a(void);
@@ -723,12 +742,55 @@ const char *dsp_interrupt_name[32] = {
 
 void dsp56k_init_cpu(void)
 {
+	dsp56k_flush_decode_cache();
 	dsp56k_disasm_init();
 	isDsp_in_disasm_mode = false;
 	start_time = SDL_GetTicks();
 	num_inst = 0;
 }
 
+/**
+ * Forget all decoded instructions. Must be called when P memory is
+ * modified from outside the DSP core.
+ */
+void dsp56k_flush_decode_cache(void)
+{
+	memset(decode_int, 0, sizeof(decode_int));
+	memset(decode_ext, 0, sizeof(decode_ext));
+}
+
+/**
+ * Decode instruction at current PC, using the decoded instruction cache.
+ */
+static inline dsp_emul_t dsp_fetch_decode(void)
+{
+	dsp_decoded_t *decoded;
+	Uint32 value;
+
+	if (dsp_core.pc < 0x200) {
+		decoded = &decode_int[dsp_core.pc];
+	} else {
+		/* Access to the external P memory */
+		access_to_ext_memory |= 1 << EXT_P_MEMORY;
+		decoded = &decode_ext[dsp_core.pc & (DSP_RAMSIZE-1)];
+	}
+
+	if (unlikely(decoded->func == NULL)) {
+		decoded->inst = read_memory_p(dsp_core.pc);
+		if (decoded->inst < 0x100000) {
+			value = (decoded->inst >> 11) & (BITMASK(6) << 3);
+			value += (decoded->inst >> 5) & BITMASK(3);
+			decoded->func = opcodes8h[value];
+		} else {
+			/* Parallel move read */
+			decoded->func = opcodes_parmove[(decoded->inst>>20) & BITMASK(4)];
+		}
+	}
+
+	cur_inst = decoded->inst;
+	return decoded->func;
+}
+
 /**
  * Execute one instruction in trace mode at a given PC address.
  * */
@@ -769,6 +831,7 @@ Uint16 dsp56k_execute_one_disasm_instruction(FILE *out, Uint16 pc)
 
 void dsp56k_execute_instruction(void)
 {
+	dsp_emul_t func;
 	Uint32 value;
 	Uint32 disasm_return = 0;
 	disasm_memory_ptr = 0;
@@ -782,7 +845,7 @@ void dsp56k_execute_instruction(void)
 	}
 	
 	/* Decode and execute current instruction */
-	cur_inst = read_memory_p(dsp_core.pc);
+	func = dsp_fetch_decode();
 	
 	/* Initialize instruction size and cycle counter */
 	cur_inst_len = 1;
@@ -801,14 +864,7 @@ void dsp56k_execute_instruction(void)
 		}
 	}
 			
-	if (cur_inst < 0x100000) {
-		value = (cur_inst >> 11) & (BITMASK(6) << 3);
-		value += (cur_inst >> 5) & BITMASK(3);
-		opcodes8h[value]();
-	} else {
-		/* Do parallel move read */
-		opcodes_parmove[(cur_inst>>20) & BITMASK(4)]();
-	}
+	func();
 
 	/* Add the waitstate due to external memory access */
 	/* (2 extra cycles per extra access to the external memory after the first one */
@@ -822,26 +878,22 @@ void dsp56k_execute_instruction(void)
 	}
 
 	/* Disasm current instruction ? (trace mode only) */
-	if (LOG_TRACE_LEVEL(TRACE_DSP_DISASM)) {
-		/* Display only when DSP is called in trace mode */
-		if (isDsp_in_disasm_mode == false) {
-			if (disasm_return != 0) {
-				fprintf(stderr, "%s", dsp56k_getInstructionText());
-				
-				/* DSP regs trace enabled only if DSP DISASM is enabled */
-				if (LOG_TRACE_LEVEL(TRACE_DSP_DISASM_REG))
-					dsp56k_disasm_reg_compare();
-
-				if (LOG_TRACE_LEVEL(TRACE_DSP_DISASM_MEM)) {
-					/* 1 memory change to display ? */
-					if (disasm_memory_ptr == 1)
-						fprintf(stderr, "\t%s\n", str_disasm_memory[0]);
-					/* 2 memory changes to display ? */
-					else if (disasm_memory_ptr == 2) {
-						fprintf(stderr, "\t%s\n", str_disasm_memory[0]);
-						fprintf(stderr, "\t%s\n", str_disasm_memory[1]);
-					}
-				}
+	/* disasm_return is only set when DSP is called in trace mode */
+	if (unlikely(disasm_return != 0)) {
+		fprintf(stderr, "%s", dsp56k_getInstructionText());
+		
+		/* DSP regs trace enabled only if DSP DISASM is enabled */
+		if (LOG_TRACE_LEVEL(TRACE_DSP_DISASM_REG))
+			dsp56k_disasm_reg_compare();
+
+		if (LOG_TRACE_LEVEL(TRACE_DSP_DISASM_MEM)) {
+			/* 1 memory change to display ? */
+			if (disasm_memory_ptr == 1)
+				fprintf(stderr, "\t%s\n", str_disasm_memory[0]);
+			/* 2 memory changes to display ? */
+			else if (disasm_memory_ptr == 2) {
+				fprintf(stderr, "\t%s\n", str_disasm_memory[0]);
+				fprintf(stderr, "\t%s\n", str_disasm_memory[1]);
 			}
 		}
 	}
@@ -1139,11 +1191,9 @@ static void dsp_postexecute_interrupts(void)
  *	Set/clear ccr bits
  **********************************/
 
-/* reg0 has bits 55..48 */
-/* reg1 has bits 47..24 */
-/* reg2 has bits 23..0 */
+/* value has bits 55..0 */
 
-static void dsp_ccr_update_e_u_n_z(Uint32 reg0, Uint32 reg1, Uint32 reg2) 
+static void dsp_ccr_update_e_u_n_z(Uint64 value) 
 {
 	Uint32 scaling, value_e, value_u;
 
@@ -1154,32 +1204,35 @@ static void dsp_ccr_update_e_u_n_z(Uint32 reg0, Uint32 reg1, Uint32 reg2)
 	switch(scaling) {
 		case 0:
 			/* Extension Bit (E) */
-			value_e = (reg0<<1) + (reg1>>23);
+			value_e = (value>>47) & BITMASK(9);
 			if ((value_e != 0) && (value_e != BITMASK(9)))
 				dsp_core.registers[DSP_REG_SR] |= 1 << DSP_SR_E;
 
 			/* Unnormalized bit (U) */
-			if ((reg1 & 0xc00000) == 0 || (reg1 & 0xc00000) == 0xc00000) 
+			value_u = (value>>46) & 3;
+			if (value_u == 0 || value_u == 3) 
 				dsp_core.registers[DSP_REG_SR] |= 1 << DSP_SR_U;
 			break;
 		case 1:
 			/* Extension Bit (E) */
-			if ((reg0 != 0) && (reg0 != BITMASK(8)))
+			value_e = (value>>48) & BITMASK(8);
+			if ((value_e != 0) && (value_e != BITMASK(8)))
 				dsp_core.registers[DSP_REG_SR] |= 1 << DSP_SR_E;
 
 			/* Unnormalized bit (U) */
-			value_u = ((reg0<<1) + (reg1>>23)) & 3;
+			value_u = (value>>47) & 3;
 			if (value_u == 0 || value_u == 3) 
 				dsp_core.registers[DSP_REG_SR] |= 1 << DSP_SR_U;
 			break;
 		case 2:
 			/* Extension Bit (E) */
-			value_e = (reg0<<2) + (reg1>>22);
+			value_e = (value>>46) & BITMASK(10);
 			if ((value_e != 0) && (value_e != BITMASK(10)))
 				dsp_core.registers[DSP_REG_SR] |= 1 << DSP_SR_E;
 
 			/* Unnormalized bit (U) */
-			if ((reg1 & 0x600000) == 0 || (reg1 & 0x600000) == 0x600000) 
+			value_u = (value>>45) & 3;
+			if (value_u == 0 || value_u == 3) 
 				dsp_core.registers[DSP_REG_SR] |= 1 << DSP_SR_U;
 			break;
 		default:
@@ -1188,11 +1241,11 @@ static void dsp_ccr_update_e_u_n_z(Uint32 reg0, Uint32 reg1, Uint32 reg2)
 	}
 
 	/* Zero Flag (Z) */
-	if ((reg1 == 0) && (reg2 == 0) && (reg0 == 0))
+	if (value == 0)
 		dsp_core.registers[DSP_REG_SR] |= 1 << DSP_SR_Z;
 
 	/* Negative Flag (N) */
-	dsp_core.registers[DSP_REG_SR] |= (reg0>>4) & 0x8;
+	dsp_core.registers[DSP_REG_SR] |= (value>>52) & 0x8;
 }
 
 /**********************************
@@ -1352,11 +1405,19 @@ static inline void write_memory(int space, Uint16 address, Uint32 value)
 		write_memory_raw(space, address, value);
 }
 
+/* External RAM is shared by P, X and Y spaces */
+static inline void write_memory_ext(Uint32 index, Uint32 value)
+{
+	dsp_core.ramext[index] = value;
+	decode_ext[index].func = NULL;
+}
+
 static void write_memory_p(Uint16 address, Uint32 value)
 {
 	/* Internal P RAM ? */
 	if (address < 0x200) {
 		dsp_core.ramint[DSP_SPACE_P][address] = value;
+		decode_int[address].func = NULL;
 		return;
 	}
 	
@@ -1364,7 +1425,7 @@ static void write_memory_p(Uint16 address, Uint32 value)
 	access_to_ext_memory |= 1 << EXT_P_MEMORY;
 	
 	/* Mask address to available ram size */
-	dsp_core.ramext[address & (DSP_RAMSIZE-1)] = value;
+	write_memory_ext(address & (DSP_RAMSIZE-1), value);
 }
 
 static void write_memory_x(Uint16 address, Uint32 value)
@@ -1446,10 +1507,10 @@ static void write_memory_x(Uint16 address, Uint32 value)
 		/* Map X to upper half of available ram size */
 		address &= (DSP_RAMSIZE>>1)-1;
 		address += DSP_RAMSIZE>>1;
-		dsp_core.ramext[address & (DSP_RAMSIZE-1)] = value;
+		write_memory_ext(address & (DSP_RAMSIZE-1), value);
 	} else {
 		/* Mask address to available ram size */
-		dsp_core.ramext[address & (DSP_RAMSIZE-1)] = value;
+		write_memory_ext(address & (DSP_RAMSIZE-1), value);
 	}
 }
 
@@ -1473,10 +1534,10 @@ static void write_memory_y(Uint16 address, Uint32 value)
 	/* Access to contiguous or separated space ? */
 	if (address&0x8000) {
 		/* Map Y to lower half of available ram size */
-		dsp_core.ramext[address & ((DSP_RAMSIZE>>1)-1)] = value;
+		write_memory_ext(address & ((DSP_RAMSIZE>>1)-1), value);
 	} else {
 		/* Mask address to available ram size */
-		dsp_core.ramext[address & (DSP_RAMSIZE-1)] = value;
+		write_memory_ext(address & (DSP_RAMSIZE-1), value);
 	}
 }
 
@@ -2339,7 +2400,8 @@ static void dsp_btst_reg(void)
 
 static void dsp_div(void)
 {
-	Uint32 srcreg, destreg, source[3], dest[3];
+	Uint32 srcreg, destreg;
+	Uint64 source, dest;
 	Uint16 newsr;
 
 	srcreg = DSP_REG_NULL;
@@ -2349,47 +2411,27 @@ static void dsp_div(void)
 		case 2:	srcreg = DSP_REG_X1;	break;
 		case 3:	srcreg = DSP_REG_Y1;	break;
 	}
-	source[2] = 0;
-	source[1] = dsp_core.registers[srcreg];
-	source[0] = source[1] & (1<<23) ? 0xff : 0x0;
+	source = dsp_sext56(dsp_core.registers[srcreg], 0);
 
 	destreg = DSP_REG_A + ((cur_inst>>3) & 1);
-	if (destreg == DSP_REG_A) {
-		dest[0] = dsp_core.registers[DSP_REG_A2];
-		dest[1] = dsp_core.registers[DSP_REG_A1];
-		dest[2] = dsp_core.registers[DSP_REG_A0];
-	}
-	else {
-		dest[0] = dsp_core.registers[DSP_REG_B2];
-		dest[1] = dsp_core.registers[DSP_REG_B1];
-		dest[2] = dsp_core.registers[DSP_REG_B0];
-	}
+	dest = dsp_read_acc56(destreg);
 
-	if (((dest[0]>>7) & 1) ^ ((source[1]>>23) & 1)) {
+	if (((dest>>55) & 1) ^ ((source>>55) & 1)) {
 		/* D += S */
-		newsr = dsp_asl56(dest);
-		dsp_add56(source, dest);
+		newsr = dsp_asl56(&dest);
+		dsp_add56(source, &dest);
 	} else {
 		/* D -= S */
-		newsr = dsp_asl56(dest);
-		dsp_sub56(source, dest);
+		newsr = dsp_asl56(&dest);
+		dsp_sub56(source, &dest);
 	}
 
-	dest[2] |= (dsp_core.registers[DSP_REG_SR]>>DSP_SR_C) & 1;
+	dest |= (dsp_core.registers[DSP_REG_SR]>>DSP_SR_C) & 1;
 
-	if (destreg == DSP_REG_A) {
-		dsp_core.registers[DSP_REG_A2] = dest[0];
-		dsp_core.registers[DSP_REG_A1] = dest[1];
-		dsp_core.registers[DSP_REG_A0] = dest[2];
-	}
-	else {
-		dsp_core.registers[DSP_REG_B2] = dest[0];
-		dsp_core.registers[DSP_REG_B1] = dest[1];
-		dsp_core.registers[DSP_REG_B0] = dest[2];
-	}
+	dsp_write_acc56(destreg, dest);
 	
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-((1<<DSP_SR_C)|(1<<DSP_SR_V));
-	dsp_core.registers[DSP_REG_SR] |= (1-((dest[0]>>7) & 1))<<DSP_SR_C;
+	dsp_core.registers[DSP_REG_SR] |= (1-((dest>>55) & 1))<<DSP_SR_C;
 	dsp_core.registers[DSP_REG_SR] |= newsr & (1<<DSP_SR_L);
 	dsp_core.registers[DSP_REG_SR] |= newsr & (1<<DSP_SR_V);
 }
@@ -3296,7 +3338,8 @@ static void dsp_movep_23(void)
 
 static void dsp_norm(void)
 {
-	Uint32 cursr,cur_e, cur_euz, dest[3], numreg, rreg;
+	Uint32 cursr,cur_e, cur_euz, numreg, rreg;
+	Uint64 dest;
 	Uint16 newsr;
 
 	cursr = dsp_core.registers[DSP_REG_SR];
@@ -3307,28 +3350,24 @@ static void dsp_norm(void)
 	cur_euz &= 1;
 
 	numreg = (cur_inst>>3) & 1;
-	dest[0] = dsp_core.registers[DSP_REG_A2+numreg];
-	dest[1] = dsp_core.registers[DSP_REG_A1+numreg];
-	dest[2] = dsp_core.registers[DSP_REG_A0+numreg];
+	dest = dsp_read_acc56(DSP_REG_A+numreg);
 	rreg = DSP_REG_R0+((cur_inst>>8) & BITMASK(3));
 
 	if (cur_euz) {
-		newsr = dsp_asl56(dest);
+		newsr = dsp_asl56(&dest);
 		--dsp_core.registers[rreg];
 		dsp_core.registers[rreg] &= BITMASK(16);
 	} else if (cur_e) {
-		newsr = dsp_asr56(dest);
+		newsr = dsp_asr56(&dest);
 		++dsp_core.registers[rreg];
 		dsp_core.registers[rreg] &= BITMASK(16);
 	} else {
 		newsr = 0;
 	}
 
-	dsp_core.registers[DSP_REG_A2+numreg] = dest[0];
-	dsp_core.registers[DSP_REG_A1+numreg] = dest[1];
-	dsp_core.registers[DSP_REG_A0+numreg] = dest[2];
+	dsp_write_acc56(DSP_REG_A+numreg, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-((1<<DSP_SR_V)|(1<<DSP_SR_C));
 	dsp_core.registers[DSP_REG_SR] |= newsr;
@@ -4168,25 +4207,51 @@ static void dsp_pm_8(void)
  *	56bit arithmetic
  **********************************/
 
-/* source,dest[0] is 55:48 */
-/* source,dest[1] is 47:24 */
-/* source,dest[2] is 23:00 */
+/* Accumulators are handled as 56 bits values in bits 55:0 of an Uint64 */
+/* A2/B2 hold bits 55:48, A1/B1 bits 47:24 and A0/B0 bits 23:0 */
+
+static inline Uint64 dsp_read_acc56(int numreg)
+{
+	int i = numreg & 1;
+
+	return ((Uint64)dsp_core.registers[DSP_REG_A2+i]<<48)
+		| ((Uint64)dsp_core.registers[DSP_REG_A1+i]<<24)
+		| dsp_core.registers[DSP_REG_A0+i];
+}
+
+static inline void dsp_write_acc56(int numreg, Uint64 value)
+{
+	int i = numreg & 1;
+
+	dsp_core.registers[DSP_REG_A2+i] = (value>>48) & BITMASK(8);
+	dsp_core.registers[DSP_REG_A1+i] = (value>>24) & BITMASK(24);
+	dsp_core.registers[DSP_REG_A0+i] = value & BITMASK(24);
+}
+
+/* Sign extend a 48 bits value made of two 24 bits registers to 56 bits */
+static inline Uint64 dsp_sext56(Uint32 hi, Uint32 lo)
+{
+	Uint64 value = ((Uint64)hi<<24) | lo;
+
+	if (hi & (1<<23)) {
+		value |= DSP_ACC56_EXT;
+	}
+	return value;
+}
 
-static Uint16 dsp_abs56(Uint32 *dest)
+static Uint16 dsp_abs56(Uint64 *dest)
 {
-	Uint32 zerodest[3];
+	Uint64 zerodest;
 	Uint16 newsr;
 
 	/* D=|D| */
 
-	if (dest[0] & (1<<7)) {
-		zerodest[0] = zerodest[1] = zerodest[2] = 0;
+	if (*dest & DSP_ACC56_MIN) {
+		zerodest = 0;
 
-		newsr = dsp_sub56(dest, zerodest);
+		newsr = dsp_sub56(*dest, &zerodest);
 
-		dest[0] = zerodest[0];
-		dest[1] = zerodest[1];
-		dest[2] = zerodest[2];
+		*dest = zerodest;
 	} else {
 		newsr = 0;
 	}
@@ -4194,204 +4259,117 @@ static Uint16 dsp_abs56(Uint32 *dest)
 	return newsr;
 }
 
-static Uint16 dsp_asl56(Uint32 *dest)
+static Uint16 dsp_asl56(Uint64 *dest)
 {
 	Uint16 overflow, carry;
 
 	/* Shift left dest 1 bit: D<<=1 */
 
-	carry = (dest[0]>>7) & 1;
-
-	dest[0] <<= 1;
-	dest[0] |= (dest[1]>>23) & 1;
-	dest[0] &= BITMASK(8);
+	carry = (*dest>>55) & 1;
 
-	dest[1] <<= 1;
-	dest[1] |= (dest[2]>>23) & 1;
-	dest[1] &= BITMASK(24);
-	
-	dest[2] <<= 1;
-	dest[2] &= BITMASK(24);
+	*dest = (*dest<<1) & DSP_ACC56_MASK;
 
-	overflow = (carry != ((dest[0]>>7) & 1));
+	overflow = (carry != ((*dest>>55) & 1));
 
 	return (overflow<<DSP_SR_L)|(overflow<<DSP_SR_V)|(carry<<DSP_SR_C);
 }
 
-static Uint16 dsp_asr56(Uint32 *dest)
+static Uint16 dsp_asr56(Uint64 *dest)
 {
 	Uint16 carry;
 
 	/* Shift right dest 1 bit: D>>=1 */
 
-	carry = dest[2] & 1;
-
-	dest[2] >>= 1;
-	dest[2] |= (dest[1] & 1)<<23;
-
-	dest[1] >>= 1;
-	dest[1] |= (dest[0] & 1)<<23;
+	carry = *dest & 1;
 
-	dest[0] >>= 1;
-	dest[0] |= (dest[0] & (1<<6))<<1;
+	*dest = (*dest>>1) | (*dest & DSP_ACC56_MIN);
 
 	return (carry<<DSP_SR_C);
 }
 
-static Uint16 dsp_add56(Uint32 *source, Uint32 *dest)
+static Uint16 dsp_add56(Uint64 source, Uint64 *dest)
 {
-	Uint16 overflow, carry, flg_s, flg_d, flg_r;
-
-	flg_s = (source[0]>>7) & 1;
-	flg_d = (dest[0]>>7) & 1;
+	Uint16 overflow, carry;
+	Uint64 result;
 
 	/* Add source to dest: D = D+S */
-	dest[2] += source[2];
-	dest[1] += source[1]+((dest[2]>>24) & 1);
-	dest[0] += source[0]+((dest[1]>>24) & 1);
-
-	carry = (dest[0]>>8) & 1;
+	result = *dest + source;
 
-	dest[2] &= BITMASK(24);
-	dest[1] &= BITMASK(24);
-	dest[0] &= BITMASK(8);
-
-	flg_r = (dest[0]>>7) & 1;
+	carry = (result>>56) & 1;
+	result &= DSP_ACC56_MASK;
 
 	/*set overflow*/
-	overflow = (flg_s ^ flg_r) & (flg_d ^ flg_r);
+	overflow = (((source ^ result) & (*dest ^ result))>>55) & 1;
+
+	*dest = result;
 
 	return (overflow<<DSP_SR_L)|(overflow<<DSP_SR_V)|(carry<<DSP_SR_C);
 }
 
-static Uint16 dsp_sub56(Uint32 *source, Uint32 *dest)
+static Uint16 dsp_sub56(Uint64 source, Uint64 *dest)
 {
-	Uint16 overflow, carry, flg_s, flg_d, flg_r, dest_save;
-
-	dest_save = dest[0];
+	Uint16 overflow, carry;
+	Uint64 result;
 
 	/* Subtract source from dest: D = D-S */
-	dest[2] -= source[2];
-	dest[1] -= source[1]+((dest[2]>>24) & 1);
-	dest[0] -= source[0]+((dest[1]>>24) & 1);
-
-	carry = (dest[0]>>8) & 1;
+	result = *dest - source;
 
-	dest[2] &= BITMASK(24);
-	dest[1] &= BITMASK(24);
-	dest[0] &= BITMASK(8);
-
-	flg_s = (source[0]>>7) & 1;
-	flg_d = (dest_save>>7) & 1;
-	flg_r = (dest[0]>>7) & 1;
+	carry = (result>>56) & 1;
+	result &= DSP_ACC56_MASK;
 
 	/* set overflow */
-	overflow = (flg_s ^ flg_d) & (flg_r ^ flg_d);
+	overflow = (((source ^ *dest) & (result ^ *dest))>>55) & 1;
+
+	*dest = result;
 
 	return (overflow<<DSP_SR_L)|(overflow<<DSP_SR_V)|(carry<<DSP_SR_C);
 }
 
-static void dsp_mul56(Uint32 source1, Uint32 source2, Uint32 *dest, Uint8 signe)
+static Uint64 dsp_mul56(Uint32 source1, Uint32 source2, Uint8 signe)
 {
-	Uint32 part[4], zerodest[3], value;
+	Sint64 value;
 
 	/* Multiply: D = S1*S2 */
-	if (source1 & (1<<23)) {
-		signe ^= 1;
-		source1 = (1<<24) - source1;
-	}
-	if (source2 & (1<<23)) {
-		signe ^= 1;
-		source2 = (1<<24) - source2;
-	}
-
-	/* bits 0-11 * bits 0-11 */
-	part[0]=(source1 & BITMASK(12))*(source2 & BITMASK(12));
-	/* bits 12-23 * bits 0-11 */
-	part[1]=((source1>>12) & BITMASK(12))*(source2 & BITMASK(12));
-	/* bits 0-11 * bits 12-23 */
-	part[2]=(source1 & BITMASK(12))*((source2>>12)  & BITMASK(12));
-	/* bits 12-23 * bits 12-23 */
-	part[3]=((source1>>12) & BITMASK(12))*((source2>>12) & BITMASK(12));
-
-	/* Calc dest 2 */
-	dest[2] = part[0];
-	dest[2] += (part[1] & BITMASK(12)) << 12;
-	dest[2] += (part[2] & BITMASK(12)) << 12;
-
-	/* Calc dest 1 */
-	dest[1] = (part[1]>>12) & BITMASK(12);
-	dest[1] += (part[2]>>12) & BITMASK(12);
-	dest[1] += part[3];
-
-	/* Calc dest 0 */
-	dest[0] = 0;
-
-	/* Add carries */
-	value = (dest[2]>>24) & BITMASK(8);
-	if (value) {
-		dest[1] += value;
-		dest[2] &= BITMASK(24);
-	}
-	value = (dest[1]>>24) & BITMASK(8);
-	if (value) {
-		dest[0] += value;
-		dest[1] &= BITMASK(24);
-	}
+	value = (Sint64)(((Sint32)(source1<<8))>>8) * (((Sint32)(source2<<8))>>8);
 
 	/* Get rid of extra sign bit */
-	dsp_asl56(dest);
+	value *= 2;
 
 	if (signe) {
-		zerodest[0] = zerodest[1] = zerodest[2] = 0;
-
-		dsp_sub56(dest, zerodest);
-
-		dest[0] = zerodest[0];
-		dest[1] = zerodest[1];
-		dest[2] = zerodest[2];
+		value = -value;
 	}
+
+	return (Uint64)value & DSP_ACC56_MASK;
 }
 
-static void dsp_rnd56(Uint32 *dest)
+static void dsp_rnd56(Uint64 *dest)
 {
-	Uint32 rnd_const[3];
-
-	rnd_const[0] = 0;
-
 	/* Scaling mode S0 */
 	if (dsp_core.registers[DSP_REG_SR] & (1<<DSP_SR_S0)) {
-		rnd_const[1] = 1;
-		rnd_const[2] = 0;
-		dsp_add56(rnd_const, dest);
+		dsp_add56(1ULL<<24, dest);
 
-		if ((dest[2]==0) && ((dest[1] & 1) == 0)) {
-			dest[1] &= (0xffffff - 0x3);
+		if ((*dest & BITMASK(25)) == 0) {
+			*dest &= ~(1ULL<<25);
 		}
-		dest[1] &= 0xfffffe;
-		dest[2]=0;
+		*dest &= ~(Uint64)BITMASK(25);
 	}
 	/* Scaling mode S1 */
 	else if (dsp_core.registers[DSP_REG_SR] & (1<<DSP_SR_S1)) {
-		rnd_const[1] = 0;
-		rnd_const[2] = (1<<22);
-		dsp_add56(rnd_const, dest);
-   
-		if ((dest[2] & 0x7fffff) == 0){
-			dest[2] = 0;
+		dsp_add56(1<<22, dest);
+
+		if ((*dest & BITMASK(23)) == 0) {
+			*dest &= ~(Uint64)BITMASK(24);
 		}
-		dest[2] &= 0x800000;
+		*dest &= ~(Uint64)BITMASK(23);
 	}
 	/* No Scaling */
 	else {
-		rnd_const[1] = 0;
-		rnd_const[2] = (1<<23);
-		dsp_add56(rnd_const, dest);
+		dsp_add56(1<<23, dest);
 
-		if (dest[2] == 0) {
-			dest[1] &= 0xfffffe;
+		if ((*dest & BITMASK(24)) == 0) {
+			*dest &= ~(1ULL<<24);
 		}
-		dest[2]=0;
+		*dest &= ~(Uint64)BITMASK(24);
 	}
 }
 
@@ -4401,75 +4379,64 @@ static void dsp_rnd56(Uint32 *dest)
 
 static void dsp_abs_a(void)
 {
-	Uint32 dest[3], overflowed;
+	Uint64 dest;
+	Uint32 overflowed;
 
-	dest[0] = dsp_core.registers[DSP_REG_A2];
-	dest[1] = dsp_core.registers[DSP_REG_A1];
-	dest[2] = dsp_core.registers[DSP_REG_A0];
+	dest = dsp_read_acc56(DSP_REG_A);
 
-	overflowed = ((dest[2]==0) && (dest[1]==0) && (dest[0]==0x80));
+	overflowed = (dest == DSP_ACC56_MIN);
 
-	dsp_abs56(dest);
+	dsp_abs56(&dest);
 
-	dsp_core.registers[DSP_REG_A2] = dest[0];
-	dsp_core.registers[DSP_REG_A1] = dest[1];
-	dsp_core.registers[DSP_REG_A0] = dest[2];
+	dsp_write_acc56(DSP_REG_A, dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 	dsp_core.registers[DSP_REG_SR] |= (overflowed<<DSP_SR_L)|(overflowed<<DSP_SR_V);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 }
 
 static void dsp_abs_b(void)
 {
-	Uint32 dest[3], overflowed;
+	Uint64 dest;
+	Uint32 overflowed;
 
-	dest[0] = dsp_core.registers[DSP_REG_B2];
-	dest[1] = dsp_core.registers[DSP_REG_B1];
-	dest[2] = dsp_core.registers[DSP_REG_B0];
+	dest = dsp_read_acc56(DSP_REG_B);
 
-	overflowed = ((dest[2]==0) && (dest[1]==0) && (dest[0]==0x80));
+	overflowed = (dest == DSP_ACC56_MIN);
 
-	dsp_abs56(dest);
+	dsp_abs56(&dest);
 
-	dsp_core.registers[DSP_REG_B2] = dest[0];
-	dsp_core.registers[DSP_REG_B1] = dest[1];
-	dsp_core.registers[DSP_REG_B0] = dest[2];
+	dsp_write_acc56(DSP_REG_B, dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 	dsp_core.registers[DSP_REG_SR] |= (overflowed<<DSP_SR_L)|(overflowed<<DSP_SR_V);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 }
 
 static void dsp_adc_x_a(void)
 {
-	Uint32 source[3], dest[3], curcarry;
+	Uint64 source, dest;
+	Uint32 curcarry;
 	Uint16 newsr;
 
 	curcarry = (dsp_core.registers[DSP_REG_SR]>>DSP_SR_C) & 1;
 
-	dest[0] = dsp_core.registers[DSP_REG_A2];
-	dest[1] = dsp_core.registers[DSP_REG_A1];
-	dest[2] = dsp_core.registers[DSP_REG_A0];
+	dest = dsp_read_acc56(DSP_REG_A);
 
-	source[2] = dsp_core.registers[DSP_REG_X0];
-	source[1] = dsp_core.registers[DSP_REG_X1];
-	source[0] = source[1] & (1<<23) ? 0xff : 0x0;
+	source = dsp_sext56(dsp_core.registers[DSP_REG_X1], dsp_core.registers[DSP_REG_X0]);
 
-	newsr = dsp_add56(source, dest);
+	newsr = dsp_add56(source, &dest);
 	
 	if (curcarry) {
-		source[0]=0; source[1]=0; source[2]=1;
-		newsr |= dsp_add56(source, dest);
+		source = 1;
+		newsr |= dsp_add56(source, &dest);
 	}
 
-	dsp_core.registers[DSP_REG_A2] = dest[0];
-	dsp_core.registers[DSP_REG_A1] = dest[1];
-	dsp_core.registers[DSP_REG_A0] = dest[2];
+	dsp_write_acc56(DSP_REG_A, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-((1<<DSP_SR_V)|(1<<DSP_SR_C));
 	dsp_core.registers[DSP_REG_SR] |= newsr;
@@ -4477,31 +4444,26 @@ static void dsp_adc_x_a(void)
 
 static void dsp_adc_x_b(void)
 {
-	Uint32 source[3], dest[3], curcarry;
+	Uint64 source, dest;
+	Uint32 curcarry;
 	Uint16 newsr;
 
 	curcarry = (dsp_core.registers[DSP_REG_SR]>>DSP_SR_C) & 1;
 
-	dest[0] = dsp_core.registers[DSP_REG_B2];
-	dest[1] = dsp_core.registers[DSP_REG_B1];
-	dest[2] = dsp_core.registers[DSP_REG_B0];
+	dest = dsp_read_acc56(DSP_REG_B);
 
-	source[2] = dsp_core.registers[DSP_REG_X0];
-	source[1] = dsp_core.registers[DSP_REG_X1];
-	source[0] = source[1] & (1<<23) ? 0xff : 0x0;
+	source = dsp_sext56(dsp_core.registers[DSP_REG_X1], dsp_core.registers[DSP_REG_X0]);
 
-	newsr = dsp_add56(source, dest);
+	newsr = dsp_add56(source, &dest);
 	
 	if (curcarry) {
-		source[0]=0; source[1]=0; source[2]=1;
-		newsr |= dsp_add56(source, dest);
+		source = 1;
+		newsr |= dsp_add56(source, &dest);
 	}
 
-	dsp_core.registers[DSP_REG_B2] = dest[0];
-	dsp_core.registers[DSP_REG_B1] = dest[1];
-	dsp_core.registers[DSP_REG_B0] = dest[2];
+	dsp_write_acc56(DSP_REG_B, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-((1<<DSP_SR_V)|(1<<DSP_SR_C));
 	dsp_core.registers[DSP_REG_SR] |= newsr;
@@ -4509,31 +4471,26 @@ static void dsp_adc_x_b(void)
 
 static void dsp_adc_y_a(void)
 {
-	Uint32 source[3], dest[3], curcarry;
+	Uint64 source, dest;
+	Uint32 curcarry;
 	Uint16 newsr;
 
 	curcarry = (dsp_core.registers[DSP_REG_SR]>>DSP_SR_C) & 1;
 
-	dest[0] = dsp_core.registers[DSP_REG_A2];
-	dest[1] = dsp_core.registers[DSP_REG_A1];
-	dest[2] = dsp_core.registers[DSP_REG_A0];
+	dest = dsp_read_acc56(DSP_REG_A);
 
-	source[2] = dsp_core.registers[DSP_REG_Y0];
-	source[1] = dsp_core.registers[DSP_REG_Y1];
-	source[0] = source[1] & (1<<23) ? 0xff : 0x0;
+	source = dsp_sext56(dsp_core.registers[DSP_REG_Y1], dsp_core.registers[DSP_REG_Y0]);
 
-	newsr = dsp_add56(source, dest);
+	newsr = dsp_add56(source, &dest);
 	
 	if (curcarry) {
-		source[0]=0; source[1]=0; source[2]=1;
-		newsr |= dsp_add56(source, dest);
+		source = 1;
+		newsr |= dsp_add56(source, &dest);
 	}
 
-	dsp_core.registers[DSP_REG_A2] = dest[0];
-	dsp_core.registers[DSP_REG_A1] = dest[1];
-	dsp_core.registers[DSP_REG_A0] = dest[2];
+	dsp_write_acc56(DSP_REG_A, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-((1<<DSP_SR_V)|(1<<DSP_SR_C));
 	dsp_core.registers[DSP_REG_SR] |= newsr;
@@ -4541,31 +4498,26 @@ static void dsp_adc_y_a(void)
 
 static void dsp_adc_y_b(void)
 {
-	Uint32 source[3], dest[3], curcarry;
+	Uint64 source, dest;
+	Uint32 curcarry;
 	Uint16 newsr;
 
 	curcarry = (dsp_core.registers[DSP_REG_SR]>>DSP_SR_C) & 1;
 
-	dest[0] = dsp_core.registers[DSP_REG_B2];
-	dest[1] = dsp_core.registers[DSP_REG_B1];
-	dest[2] = dsp_core.registers[DSP_REG_B0];
+	dest = dsp_read_acc56(DSP_REG_B);
 
-	source[2] = dsp_core.registers[DSP_REG_Y0];
-	source[1] = dsp_core.registers[DSP_REG_Y1];
-	source[0] = source[1] & (1<<23) ? 0xff : 0x0;
+	source = dsp_sext56(dsp_core.registers[DSP_REG_Y1], dsp_core.registers[DSP_REG_Y0]);
 
-	newsr = dsp_add56(source, dest);
+	newsr = dsp_add56(source, &dest);
 	
 	if (curcarry) {
-		source[0]=0; source[1]=0; source[2]=1;
-		newsr |= dsp_add56(source, dest);
+		source = 1;
+		newsr |= dsp_add56(source, &dest);
 	}
 
-	dsp_core.registers[DSP_REG_B2] = dest[0];
-	dsp_core.registers[DSP_REG_B1] = dest[1];
-	dsp_core.registers[DSP_REG_B0] = dest[2];
+	dsp_write_acc56(DSP_REG_B, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-((1<<DSP_SR_V)|(1<<DSP_SR_C));
 	dsp_core.registers[DSP_REG_SR] |= newsr;
@@ -4573,24 +4525,18 @@ static void dsp_adc_y_b(void)
 
 static void dsp_add_b_a(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dest[0] = dsp_core.registers[DSP_REG_A2];
-	dest[1] = dsp_core.registers[DSP_REG_A1];
-	dest[2] = dsp_core.registers[DSP_REG_A0];
+	dest = dsp_read_acc56(DSP_REG_A);
 
-	source[0] = dsp_core.registers[DSP_REG_B2];
-	source[1] = dsp_core.registers[DSP_REG_B1];
-	source[2] = dsp_core.registers[DSP_REG_B0];
+	source = dsp_read_acc56(DSP_REG_B);
 
-	newsr = dsp_add56(source, dest);
+	newsr = dsp_add56(source, &dest);
 
-	dsp_core.registers[DSP_REG_A2] = dest[0];
-	dsp_core.registers[DSP_REG_A1] = dest[1];
-	dsp_core.registers[DSP_REG_A0] = dest[2];
+	dsp_write_acc56(DSP_REG_A, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-((1<<DSP_SR_V)|(1<<DSP_SR_C));
 	dsp_core.registers[DSP_REG_SR] |= newsr;
@@ -4598,24 +4544,18 @@ static void dsp_add_b_a(void)
 
 static void dsp_add_a_b(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dest[0] = dsp_core.registers[DSP_REG_B2];
-	dest[1] = dsp_core.registers[DSP_REG_B1];
-	dest[2] = dsp_core.registers[DSP_REG_B0];
+	dest = dsp_read_acc56(DSP_REG_B);
 
-	source[0] = dsp_core.registers[DSP_REG_A2];
-	source[1] = dsp_core.registers[DSP_REG_A1];
-	source[2] = dsp_core.registers[DSP_REG_A0];
+	source = dsp_read_acc56(DSP_REG_A);
 
-	newsr = dsp_add56(source, dest);
+	newsr = dsp_add56(source, &dest);
 
-	dsp_core.registers[DSP_REG_B2] = dest[0];
-	dsp_core.registers[DSP_REG_B1] = dest[1];
-	dsp_core.registers[DSP_REG_B0] = dest[2];
+	dsp_write_acc56(DSP_REG_B, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-((1<<DSP_SR_V)|(1<<DSP_SR_C));
 	dsp_core.registers[DSP_REG_SR] |= newsr;
@@ -4623,24 +4563,18 @@ static void dsp_add_a_b(void)
 
 static void dsp_add_x_a(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dest[0] = dsp_core.registers[DSP_REG_A2];
-	dest[1] = dsp_core.registers[DSP_REG_A1];
-	dest[2] = dsp_core.registers[DSP_REG_A0];
+	dest = dsp_read_acc56(DSP_REG_A);
 
-	source[1] = dsp_core.registers[DSP_REG_X1];
-	source[2] = dsp_core.registers[DSP_REG_X0];
-	source[0] = source[1] & (1<<23) ? 0xff : 0x0;
+	source = dsp_sext56(dsp_core.registers[DSP_REG_X1], dsp_core.registers[DSP_REG_X0]);
 
-	newsr = dsp_add56(source, dest);
+	newsr = dsp_add56(source, &dest);
 
-	dsp_core.registers[DSP_REG_A2] = dest[0];
-	dsp_core.registers[DSP_REG_A1] = dest[1];
-	dsp_core.registers[DSP_REG_A0] = dest[2];
+	dsp_write_acc56(DSP_REG_A, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-((1<<DSP_SR_V)|(1<<DSP_SR_C));
 	dsp_core.registers[DSP_REG_SR] |= newsr;
@@ -4648,24 +4582,18 @@ static void dsp_add_x_a(void)
 
 static void dsp_add_x_b(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dest[0] = dsp_core.registers[DSP_REG_B2];
-	dest[1] = dsp_core.registers[DSP_REG_B1];
-	dest[2] = dsp_core.registers[DSP_REG_B0];
+	dest = dsp_read_acc56(DSP_REG_B);
 
-	source[1] = dsp_core.registers[DSP_REG_X1];
-	source[2] = dsp_core.registers[DSP_REG_X0];
-	source[0] = source[1] & (1<<23) ? 0xff : 0x0;
+	source = dsp_sext56(dsp_core.registers[DSP_REG_X1], dsp_core.registers[DSP_REG_X0]);
 
-	newsr = dsp_add56(source, dest);
+	newsr = dsp_add56(source, &dest);
 
-	dsp_core.registers[DSP_REG_B2] = dest[0];
-	dsp_core.registers[DSP_REG_B1] = dest[1];
-	dsp_core.registers[DSP_REG_B0] = dest[2];
+	dsp_write_acc56(DSP_REG_B, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-((1<<DSP_SR_V)|(1<<DSP_SR_C));
 	dsp_core.registers[DSP_REG_SR] |= newsr;
@@ -4673,24 +4601,18 @@ static void dsp_add_x_b(void)
 
 static void dsp_add_y_a(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dest[0] = dsp_core.registers[DSP_REG_A2];
-	dest[1] = dsp_core.registers[DSP_REG_A1];
-	dest[2] = dsp_core.registers[DSP_REG_A0];
+	dest = dsp_read_acc56(DSP_REG_A);
 
-	source[1] = dsp_core.registers[DSP_REG_Y1];
-	source[2] = dsp_core.registers[DSP_REG_Y0];
-	source[0] = source[1] & (1<<23) ? 0xff : 0x0;
+	source = dsp_sext56(dsp_core.registers[DSP_REG_Y1], dsp_core.registers[DSP_REG_Y0]);
 
-	newsr = dsp_add56(source, dest);
+	newsr = dsp_add56(source, &dest);
 
-	dsp_core.registers[DSP_REG_A2] = dest[0];
-	dsp_core.registers[DSP_REG_A1] = dest[1];
-	dsp_core.registers[DSP_REG_A0] = dest[2];
+	dsp_write_acc56(DSP_REG_A, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-((1<<DSP_SR_V)|(1<<DSP_SR_C));
 	dsp_core.registers[DSP_REG_SR] |= newsr;
@@ -4698,24 +4620,18 @@ static void dsp_add_y_a(void)
 
 static void dsp_add_y_b(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dest[0] = dsp_core.registers[DSP_REG_B2];
-	dest[1] = dsp_core.registers[DSP_REG_B1];
-	dest[2] = dsp_core.registers[DSP_REG_B0];
+	dest = dsp_read_acc56(DSP_REG_B);
 
-	source[1] = dsp_core.registers[DSP_REG_Y1];
-	source[2] = dsp_core.registers[DSP_REG_Y0];
-	source[0] = source[1] & (1<<23) ? 0xff : 0x0;
+	source = dsp_sext56(dsp_core.registers[DSP_REG_Y1], dsp_core.registers[DSP_REG_Y0]);
 
-	newsr = dsp_add56(source, dest);
+	newsr = dsp_add56(source, &dest);
 
-	dsp_core.registers[DSP_REG_B2] = dest[0];
-	dsp_core.registers[DSP_REG_B1] = dest[1];
-	dsp_core.registers[DSP_REG_B0] = dest[2];
+	dsp_write_acc56(DSP_REG_B, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-((1<<DSP_SR_V)|(1<<DSP_SR_C));
 	dsp_core.registers[DSP_REG_SR] |= newsr;
@@ -4723,24 +4639,18 @@ static void dsp_add_y_b(void)
 
 static void dsp_add_x0_a(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dest[0] = dsp_core.registers[DSP_REG_A2];
-	dest[1] = dsp_core.registers[DSP_REG_A1];
-	dest[2] = dsp_core.registers[DSP_REG_A0];
+	dest = dsp_read_acc56(DSP_REG_A);
 
-	source[2] = 0;
-	source[1] = dsp_core.registers[DSP_REG_X0];
-	source[0] = source[1] & (1<<23) ? 0xff : 0x0;
+	source = dsp_sext56(dsp_core.registers[DSP_REG_X0], 0);
 
-	newsr = dsp_add56(source, dest);
+	newsr = dsp_add56(source, &dest);
 
-	dsp_core.registers[DSP_REG_A2] = dest[0];
-	dsp_core.registers[DSP_REG_A1] = dest[1];
-	dsp_core.registers[DSP_REG_A0] = dest[2];
+	dsp_write_acc56(DSP_REG_A, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-((1<<DSP_SR_V)|(1<<DSP_SR_C));
 	dsp_core.registers[DSP_REG_SR] |= newsr;
@@ -4748,24 +4658,18 @@ static void dsp_add_x0_a(void)
 
 static void dsp_add_x0_b(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dest[0] = dsp_core.registers[DSP_REG_B2];
-	dest[1] = dsp_core.registers[DSP_REG_B1];
-	dest[2] = dsp_core.registers[DSP_REG_B0];
+	dest = dsp_read_acc56(DSP_REG_B);
 
-	source[2] = 0;
-	source[1] = dsp_core.registers[DSP_REG_X0];
-	source[0] = source[1] & (1<<23) ? 0xff : 0x0;
+	source = dsp_sext56(dsp_core.registers[DSP_REG_X0], 0);
 
-	newsr = dsp_add56(source, dest);
+	newsr = dsp_add56(source, &dest);
 
-	dsp_core.registers[DSP_REG_B2] = dest[0];
-	dsp_core.registers[DSP_REG_B1] = dest[1];
-	dsp_core.registers[DSP_REG_B0] = dest[2];
+	dsp_write_acc56(DSP_REG_B, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-((1<<DSP_SR_V)|(1<<DSP_SR_C));
 	dsp_core.registers[DSP_REG_SR] |= newsr;
@@ -4773,24 +4677,18 @@ static void dsp_add_x0_b(void)
 
 static void dsp_add_y0_a(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dest[0] = dsp_core.registers[DSP_REG_A2];
-	dest[1] = dsp_core.registers[DSP_REG_A1];
-	dest[2] = dsp_core.registers[DSP_REG_A0];
+	dest = dsp_read_acc56(DSP_REG_A);
 
-	source[2] = 0;
-	source[1] = dsp_core.registers[DSP_REG_Y0];
-	source[0] = source[1] & (1<<23) ? 0xff : 0x0;
+	source = dsp_sext56(dsp_core.registers[DSP_REG_Y0], 0);
 
-	newsr = dsp_add56(source, dest);
+	newsr = dsp_add56(source, &dest);
 
-	dsp_core.registers[DSP_REG_A2] = dest[0];
-	dsp_core.registers[DSP_REG_A1] = dest[1];
-	dsp_core.registers[DSP_REG_A0] = dest[2];
+	dsp_write_acc56(DSP_REG_A, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-((1<<DSP_SR_V)|(1<<DSP_SR_C));
 	dsp_core.registers[DSP_REG_SR] |= newsr;
@@ -4798,24 +4696,18 @@ static void dsp_add_y0_a(void)
 
 static void dsp_add_y0_b(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dest[0] = dsp_core.registers[DSP_REG_B2];
-	dest[1] = dsp_core.registers[DSP_REG_B1];
-	dest[2] = dsp_core.registers[DSP_REG_B0];
+	dest = dsp_read_acc56(DSP_REG_B);
 
-	source[2] = 0;
-	source[1] = dsp_core.registers[DSP_REG_Y0];
-	source[0] = source[1] & (1<<23) ? 0xff : 0x0;
+	source = dsp_sext56(dsp_core.registers[DSP_REG_Y0], 0);
 
-	newsr = dsp_add56(source, dest);
+	newsr = dsp_add56(source, &dest);
 
-	dsp_core.registers[DSP_REG_B2] = dest[0];
-	dsp_core.registers[DSP_REG_B1] = dest[1];
-	dsp_core.registers[DSP_REG_B0] = dest[2];
+	dsp_write_acc56(DSP_REG_B, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-((1<<DSP_SR_V)|(1<<DSP_SR_C));
 	dsp_core.registers[DSP_REG_SR] |= newsr;
@@ -4823,24 +4715,18 @@ static void dsp_add_y0_b(void)
 
 static void dsp_add_x1_a(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dest[0] = dsp_core.registers[DSP_REG_A2];
-	dest[1] = dsp_core.registers[DSP_REG_A1];
-	dest[2] = dsp_core.registers[DSP_REG_A0];
+	dest = dsp_read_acc56(DSP_REG_A);
 
-	source[2] = 0;
-	source[1] = dsp_core.registers[DSP_REG_X1];
-	source[0] = source[1] & (1<<23) ? 0xff : 0x0;
+	source = dsp_sext56(dsp_core.registers[DSP_REG_X1], 0);
 
-	newsr = dsp_add56(source, dest);
+	newsr = dsp_add56(source, &dest);
 
-	dsp_core.registers[DSP_REG_A2] = dest[0];
-	dsp_core.registers[DSP_REG_A1] = dest[1];
-	dsp_core.registers[DSP_REG_A0] = dest[2];
+	dsp_write_acc56(DSP_REG_A, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-((1<<DSP_SR_V)|(1<<DSP_SR_C));
 	dsp_core.registers[DSP_REG_SR] |= newsr;
@@ -4848,24 +4734,18 @@ static void dsp_add_x1_a(void)
 
 static void dsp_add_x1_b(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dest[0] = dsp_core.registers[DSP_REG_B2];
-	dest[1] = dsp_core.registers[DSP_REG_B1];
-	dest[2] = dsp_core.registers[DSP_REG_B0];
+	dest = dsp_read_acc56(DSP_REG_B);
 
-	source[2] = 0;
-	source[1] = dsp_core.registers[DSP_REG_X1];
-	source[0] = source[1] & (1<<23) ? 0xff : 0x0;
+	source = dsp_sext56(dsp_core.registers[DSP_REG_X1], 0);
 
-	newsr = dsp_add56(source, dest);
+	newsr = dsp_add56(source, &dest);
 
-	dsp_core.registers[DSP_REG_B2] = dest[0];
-	dsp_core.registers[DSP_REG_B1] = dest[1];
-	dsp_core.registers[DSP_REG_B0] = dest[2];
+	dsp_write_acc56(DSP_REG_B, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-((1<<DSP_SR_V)|(1<<DSP_SR_C));
 	dsp_core.registers[DSP_REG_SR] |= newsr;
@@ -4873,24 +4753,18 @@ static void dsp_add_x1_b(void)
 
 static void dsp_add_y1_a(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dest[0] = dsp_core.registers[DSP_REG_A2];
-	dest[1] = dsp_core.registers[DSP_REG_A1];
-	dest[2] = dsp_core.registers[DSP_REG_A0];
+	dest = dsp_read_acc56(DSP_REG_A);
 
-	source[2] = 0;
-	source[1] = dsp_core.registers[DSP_REG_Y1];
-	source[0] = source[1] & (1<<23) ? 0xff : 0x0;
+	source = dsp_sext56(dsp_core.registers[DSP_REG_Y1], 0);
 
-	newsr = dsp_add56(source, dest);
+	newsr = dsp_add56(source, &dest);
 
-	dsp_core.registers[DSP_REG_A2] = dest[0];
-	dsp_core.registers[DSP_REG_A1] = dest[1];
-	dsp_core.registers[DSP_REG_A0] = dest[2];
+	dsp_write_acc56(DSP_REG_A, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-((1<<DSP_SR_V)|(1<<DSP_SR_C));
 	dsp_core.registers[DSP_REG_SR] |= newsr;
@@ -4898,24 +4772,18 @@ static void dsp_add_y1_a(void)
 
 static void dsp_add_y1_b(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dest[0] = dsp_core.registers[DSP_REG_B2];
-	dest[1] = dsp_core.registers[DSP_REG_B1];
-	dest[2] = dsp_core.registers[DSP_REG_B0];
+	dest = dsp_read_acc56(DSP_REG_B);
 
-	source[2] = 0;
-	source[1] = dsp_core.registers[DSP_REG_Y1];
-	source[0] = source[1] & (1<<23) ? 0xff : 0x0;
+	source = dsp_sext56(dsp_core.registers[DSP_REG_Y1], 0);
 
-	newsr = dsp_add56(source, dest);
+	newsr = dsp_add56(source, &dest);
 
-	dsp_core.registers[DSP_REG_B2] = dest[0];
-	dsp_core.registers[DSP_REG_B1] = dest[1];
-	dsp_core.registers[DSP_REG_B0] = dest[2];
+	dsp_write_acc56(DSP_REG_B, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-((1<<DSP_SR_V)|(1<<DSP_SR_C));
 	dsp_core.registers[DSP_REG_SR] |= newsr;
@@ -4923,24 +4791,18 @@ static void dsp_add_y1_b(void)
 
 static void dsp_addl_b_a(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dest[0] = dsp_core.registers[DSP_REG_A2];
-	dest[1] = dsp_core.registers[DSP_REG_A1];
-	dest[2] = dsp_core.registers[DSP_REG_A0];
-	newsr = dsp_asl56(dest);
+	dest = dsp_read_acc56(DSP_REG_A);
+	newsr = dsp_asl56(&dest);
 
-	source[0] = dsp_core.registers[DSP_REG_B2];
-	source[1] = dsp_core.registers[DSP_REG_B1];
-	source[2] = dsp_core.registers[DSP_REG_B0];
-	newsr |= dsp_add56(source, dest);
+	source = dsp_read_acc56(DSP_REG_B);
+	newsr |= dsp_add56(source, &dest);
 
-	dsp_core.registers[DSP_REG_A2] = dest[0];
-	dsp_core.registers[DSP_REG_A1] = dest[1];
-	dsp_core.registers[DSP_REG_A0] = dest[2];
+	dsp_write_acc56(DSP_REG_A, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-((1<<DSP_SR_V)|(1<<DSP_SR_C));
 	dsp_core.registers[DSP_REG_SR] |= newsr;
@@ -4948,24 +4810,18 @@ static void dsp_addl_b_a(void)
 
 static void dsp_addl_a_b(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dest[0] = dsp_core.registers[DSP_REG_B2];
-	dest[1] = dsp_core.registers[DSP_REG_B1];
-	dest[2] = dsp_core.registers[DSP_REG_B0];
-	newsr = dsp_asl56(dest);
+	dest = dsp_read_acc56(DSP_REG_B);
+	newsr = dsp_asl56(&dest);
 
-	source[0] = dsp_core.registers[DSP_REG_A2];
-	source[1] = dsp_core.registers[DSP_REG_A1];
-	source[2] = dsp_core.registers[DSP_REG_A0];
-	newsr |= dsp_add56(source, dest);
+	source = dsp_read_acc56(DSP_REG_A);
+	newsr |= dsp_add56(source, &dest);
 
-	dsp_core.registers[DSP_REG_B2] = dest[0];
-	dsp_core.registers[DSP_REG_B1] = dest[1];
-	dsp_core.registers[DSP_REG_B0] = dest[2];
+	dsp_write_acc56(DSP_REG_B, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-((1<<DSP_SR_V)|(1<<DSP_SR_C));
 	dsp_core.registers[DSP_REG_SR] |= newsr;
@@ -4973,24 +4829,18 @@ static void dsp_addl_a_b(void)
 
 static void dsp_addr_b_a(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dest[0] = dsp_core.registers[DSP_REG_A2];
-	dest[1] = dsp_core.registers[DSP_REG_A1];
-	dest[2] = dsp_core.registers[DSP_REG_A0];
-	newsr = dsp_asr56(dest);
+	dest = dsp_read_acc56(DSP_REG_A);
+	newsr = dsp_asr56(&dest);
 
-	source[0] = dsp_core.registers[DSP_REG_B2];
-	source[1] = dsp_core.registers[DSP_REG_B1];
-	source[2] = dsp_core.registers[DSP_REG_B0];
-	newsr |= dsp_add56(source, dest);
+	source = dsp_read_acc56(DSP_REG_B);
+	newsr |= dsp_add56(source, &dest);
 
-	dsp_core.registers[DSP_REG_A2] = dest[0];
-	dsp_core.registers[DSP_REG_A1] = dest[1];
-	dsp_core.registers[DSP_REG_A0] = dest[2];
+	dsp_write_acc56(DSP_REG_A, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-((1<<DSP_SR_V)|(1<<DSP_SR_C));
 	dsp_core.registers[DSP_REG_SR] |= newsr;
@@ -4998,24 +4848,18 @@ static void dsp_addr_b_a(void)
 
 static void dsp_addr_a_b(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dest[0] = dsp_core.registers[DSP_REG_B2];
-	dest[1] = dsp_core.registers[DSP_REG_B1];
-	dest[2] = dsp_core.registers[DSP_REG_B0];
-	newsr = dsp_asr56(dest);
+	dest = dsp_read_acc56(DSP_REG_B);
+	newsr = dsp_asr56(&dest);
 
-	source[0] = dsp_core.registers[DSP_REG_A2];
-	source[1] = dsp_core.registers[DSP_REG_A1];
-	source[2] = dsp_core.registers[DSP_REG_A0];
-	newsr |= dsp_add56(source, dest);
+	source = dsp_read_acc56(DSP_REG_A);
+	newsr |= dsp_add56(source, &dest);
 
-	dsp_core.registers[DSP_REG_B2] = dest[0];
-	dsp_core.registers[DSP_REG_B1] = dest[1];
-	dsp_core.registers[DSP_REG_B0] = dest[2];
+	dsp_write_acc56(DSP_REG_B, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-((1<<DSP_SR_V)|(1<<DSP_SR_C));
 	dsp_core.registers[DSP_REG_SR] |= newsr;
@@ -5095,86 +4939,70 @@ static void dsp_and_y1_b(void)
 
 static void dsp_asl_a(void)
 {
-	Uint32 dest[3];
+	Uint64 dest;
 	Uint16 newsr;
 
-	dest[0] = dsp_core.registers[DSP_REG_A2];
-	dest[1] = dsp_core.registers[DSP_REG_A1];
-	dest[2] = dsp_core.registers[DSP_REG_A0];
+	dest = dsp_read_acc56(DSP_REG_A);
 
-	newsr = dsp_asl56(dest);
+	newsr = dsp_asl56(&dest);
 
-	dsp_core.registers[DSP_REG_A2] = dest[0];
-	dsp_core.registers[DSP_REG_A1] = dest[1];
-	dsp_core.registers[DSP_REG_A0] = dest[2];
+	dsp_write_acc56(DSP_REG_A, dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-((1<<DSP_SR_C)|(1<<DSP_SR_V));
 	dsp_core.registers[DSP_REG_SR] |= newsr;
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 }
 
 static void dsp_asl_b(void)
 {
-	Uint32 dest[3];
+	Uint64 dest;
 	Uint16 newsr;
 
-	dest[0] = dsp_core.registers[DSP_REG_B2];
-	dest[1] = dsp_core.registers[DSP_REG_B1];
-	dest[2] = dsp_core.registers[DSP_REG_B0];
+	dest = dsp_read_acc56(DSP_REG_B);
 
-	newsr = dsp_asl56(dest);
+	newsr = dsp_asl56(&dest);
 
-	dsp_core.registers[DSP_REG_B2] = dest[0];
-	dsp_core.registers[DSP_REG_B1] = dest[1];
-	dsp_core.registers[DSP_REG_B0] = dest[2];
+	dsp_write_acc56(DSP_REG_B, dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-((1<<DSP_SR_C)|(1<<DSP_SR_V));
 	dsp_core.registers[DSP_REG_SR] |= newsr;
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 }
 
 static void dsp_asr_a(void)
 {
-	Uint32 dest[3];
+	Uint64 dest;
 	Uint16 newsr;
 
-	dest[0] = dsp_core.registers[DSP_REG_A2];
-	dest[1] = dsp_core.registers[DSP_REG_A1];
-	dest[2] = dsp_core.registers[DSP_REG_A0];
+	dest = dsp_read_acc56(DSP_REG_A);
 
-	newsr = dsp_asr56(dest);
+	newsr = dsp_asr56(&dest);
 
-	dsp_core.registers[DSP_REG_A2] = dest[0];
-	dsp_core.registers[DSP_REG_A1] = dest[1];
-	dsp_core.registers[DSP_REG_A0] = dest[2];
+	dsp_write_acc56(DSP_REG_A, dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-((1<<DSP_SR_C)|(1<<DSP_SR_V));
 	dsp_core.registers[DSP_REG_SR] |= newsr;
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 }
 
 static void dsp_asr_b(void)
 {
-	Uint32 dest[3];
+	Uint64 dest;
 	Uint16 newsr;
 
-	dest[0] = dsp_core.registers[DSP_REG_B2];
-	dest[1] = dsp_core.registers[DSP_REG_B1];
-	dest[2] = dsp_core.registers[DSP_REG_B0];
+	dest = dsp_read_acc56(DSP_REG_B);
 
-	newsr = dsp_asr56(dest);
+	newsr = dsp_asr56(&dest);
 
-	dsp_core.registers[DSP_REG_B2] = dest[0];
-	dsp_core.registers[DSP_REG_B1] = dest[1];
-	dsp_core.registers[DSP_REG_B0] = dest[2];
+	dsp_write_acc56(DSP_REG_B, dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-((1<<DSP_SR_C)|(1<<DSP_SR_V));
 	dsp_core.registers[DSP_REG_SR] |= newsr;
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 }
 
 static void dsp_clr_a(void)
@@ -5199,20 +5027,16 @@ static void dsp_clr_b(void)
 
 static void dsp_cmp_b_a(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dest[0] = dsp_core.registers[DSP_REG_A2];
-	dest[1] = dsp_core.registers[DSP_REG_A1];
-	dest[2] = dsp_core.registers[DSP_REG_A0];
+	dest = dsp_read_acc56(DSP_REG_A);
 
-	source[0] = dsp_core.registers[DSP_REG_B2];
-	source[1] = dsp_core.registers[DSP_REG_B1];
-	source[2] = dsp_core.registers[DSP_REG_B0];
+	source = dsp_read_acc56(DSP_REG_B);
 
-	newsr = dsp_sub56(source, dest);
+	newsr = dsp_sub56(source, &dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-((1<<DSP_SR_V)|(1<<DSP_SR_C));
 	dsp_core.registers[DSP_REG_SR] |= newsr;
@@ -5220,20 +5044,16 @@ static void dsp_cmp_b_a(void)
 
 static void dsp_cmp_a_b(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dest[0] = dsp_core.registers[DSP_REG_B2];
-	dest[1] = dsp_core.registers[DSP_REG_B1];
-	dest[2] = dsp_core.registers[DSP_REG_B0];
+	dest = dsp_read_acc56(DSP_REG_B);
 
-	source[0] = dsp_core.registers[DSP_REG_A2];
-	source[1] = dsp_core.registers[DSP_REG_A1];
-	source[2] = dsp_core.registers[DSP_REG_A0];
+	source = dsp_read_acc56(DSP_REG_A);
 
-	newsr = dsp_sub56(source, dest);
+	newsr = dsp_sub56(source, &dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-((1<<DSP_SR_V)|(1<<DSP_SR_C));
 	dsp_core.registers[DSP_REG_SR] |= newsr;
@@ -5241,20 +5061,16 @@ static void dsp_cmp_a_b(void)
 
 static void dsp_cmp_x0_a(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dest[2] = dsp_core.registers[DSP_REG_A0];
-	dest[1] = dsp_core.registers[DSP_REG_A1];
-	dest[0] = dsp_core.registers[DSP_REG_A2];
+	dest = dsp_read_acc56(DSP_REG_A);
 
-	source[2] = 0;
-	source[1] = dsp_core.registers[DSP_REG_X0];
-	source[0] = source[1] & (1<<23) ? 0xff : 0x0;
+	source = dsp_sext56(dsp_core.registers[DSP_REG_X0], 0);
 
-	newsr = dsp_sub56(source, dest);
+	newsr = dsp_sub56(source, &dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-((1<<DSP_SR_V)|(1<<DSP_SR_C));
 	dsp_core.registers[DSP_REG_SR] |= newsr;
@@ -5262,20 +5078,16 @@ static void dsp_cmp_x0_a(void)
 
 static void dsp_cmp_x0_b(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dest[0] = dsp_core.registers[DSP_REG_B2];
-	dest[1] = dsp_core.registers[DSP_REG_B1];
-	dest[2] = dsp_core.registers[DSP_REG_B0];
+	dest = dsp_read_acc56(DSP_REG_B);
 
-	source[2] = 0;
-	source[1] = dsp_core.registers[DSP_REG_X0];
-	source[0] = source[1] & (1<<23) ? 0xff : 0x0;
+	source = dsp_sext56(dsp_core.registers[DSP_REG_X0], 0);
 
-	newsr = dsp_sub56(source, dest);
+	newsr = dsp_sub56(source, &dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-((1<<DSP_SR_V)|(1<<DSP_SR_C));
 	dsp_core.registers[DSP_REG_SR] |= newsr;
@@ -5283,20 +5095,16 @@ static void dsp_cmp_x0_b(void)
 
 static void dsp_cmp_y0_a(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dest[2] = dsp_core.registers[DSP_REG_A0];
-	dest[1] = dsp_core.registers[DSP_REG_A1];
-	dest[0] = dsp_core.registers[DSP_REG_A2];
+	dest = dsp_read_acc56(DSP_REG_A);
 
-	source[2] = 0;
-	source[1] = dsp_core.registers[DSP_REG_Y0];
-	source[0] = source[1] & (1<<23) ? 0xff : 0x0;
+	source = dsp_sext56(dsp_core.registers[DSP_REG_Y0], 0);
 
-	newsr = dsp_sub56(source, dest);
+	newsr = dsp_sub56(source, &dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-((1<<DSP_SR_V)|(1<<DSP_SR_C));
 	dsp_core.registers[DSP_REG_SR] |= newsr;
@@ -5304,40 +5112,32 @@ static void dsp_cmp_y0_a(void)
 
 static void dsp_cmp_y0_b(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dest[0] = dsp_core.registers[DSP_REG_B2];
-	dest[1] = dsp_core.registers[DSP_REG_B1];
-	dest[2] = dsp_core.registers[DSP_REG_B0];
+	dest = dsp_read_acc56(DSP_REG_B);
 
-	source[2] = 0;
-	source[1] = dsp_core.registers[DSP_REG_Y0];
-	source[0] = source[1] & (1<<23) ? 0xff : 0x0;
+	source = dsp_sext56(dsp_core.registers[DSP_REG_Y0], 0);
 
-	newsr = dsp_sub56(source, dest);
+	newsr = dsp_sub56(source, &dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-((1<<DSP_SR_V)|(1<<DSP_SR_C));
 	dsp_core.registers[DSP_REG_SR] |= newsr;
 }
 static void dsp_cmp_x1_a(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dest[2] = dsp_core.registers[DSP_REG_A0];
-	dest[1] = dsp_core.registers[DSP_REG_A1];
-	dest[0] = dsp_core.registers[DSP_REG_A2];
+	dest = dsp_read_acc56(DSP_REG_A);
 
-	source[2] = 0;
-	source[1] = dsp_core.registers[DSP_REG_X1];
-	source[0] = source[1] & (1<<23) ? 0xff : 0x0;
+	source = dsp_sext56(dsp_core.registers[DSP_REG_X1], 0);
 
-	newsr = dsp_sub56(source, dest);
+	newsr = dsp_sub56(source, &dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-((1<<DSP_SR_V)|(1<<DSP_SR_C));
 	dsp_core.registers[DSP_REG_SR] |= newsr;
@@ -5345,20 +5145,16 @@ static void dsp_cmp_x1_a(void)
 
 static void dsp_cmp_x1_b(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dest[0] = dsp_core.registers[DSP_REG_B2];
-	dest[1] = dsp_core.registers[DSP_REG_B1];
-	dest[2] = dsp_core.registers[DSP_REG_B0];
+	dest = dsp_read_acc56(DSP_REG_B);
 
-	source[2] = 0;
-	source[1] = dsp_core.registers[DSP_REG_X1];
-	source[0] = source[1] & (1<<23) ? 0xff : 0x0;
+	source = dsp_sext56(dsp_core.registers[DSP_REG_X1], 0);
 
-	newsr = dsp_sub56(source, dest);
+	newsr = dsp_sub56(source, &dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-((1<<DSP_SR_V)|(1<<DSP_SR_C));
 	dsp_core.registers[DSP_REG_SR] |= newsr;
@@ -5366,20 +5162,16 @@ static void dsp_cmp_x1_b(void)
 
 static void dsp_cmp_y1_a(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dest[2] = dsp_core.registers[DSP_REG_A0];
-	dest[1] = dsp_core.registers[DSP_REG_A1];
-	dest[0] = dsp_core.registers[DSP_REG_A2];
+	dest = dsp_read_acc56(DSP_REG_A);
 
-	source[2] = 0;
-	source[1] = dsp_core.registers[DSP_REG_Y1];
-	source[0] = source[1] & (1<<23) ? 0xff : 0x0;
+	source = dsp_sext56(dsp_core.registers[DSP_REG_Y1], 0);
 
-	newsr = dsp_sub56(source, dest);
+	newsr = dsp_sub56(source, &dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-((1<<DSP_SR_V)|(1<<DSP_SR_C));
 	dsp_core.registers[DSP_REG_SR] |= newsr;
@@ -5387,20 +5179,16 @@ static void dsp_cmp_y1_a(void)
 
 static void dsp_cmp_y1_b(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dest[0] = dsp_core.registers[DSP_REG_B2];
-	dest[1] = dsp_core.registers[DSP_REG_B1];
-	dest[2] = dsp_core.registers[DSP_REG_B0];
+	dest = dsp_read_acc56(DSP_REG_B);
 
-	source[2] = 0;
-	source[1] = dsp_core.registers[DSP_REG_Y1];
-	source[0] = source[1] & (1<<23) ? 0xff : 0x0;
+	source = dsp_sext56(dsp_core.registers[DSP_REG_Y1], 0);
 
-	newsr = dsp_sub56(source, dest);
+	newsr = dsp_sub56(source, &dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-((1<<DSP_SR_V)|(1<<DSP_SR_C));
 	dsp_core.registers[DSP_REG_SR] |= newsr;
@@ -5408,22 +5196,18 @@ static void dsp_cmp_y1_b(void)
 
 static void dsp_cmpm_b_a(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dest[0] = dsp_core.registers[DSP_REG_A2];
-	dest[1] = dsp_core.registers[DSP_REG_A1];
-	dest[2] = dsp_core.registers[DSP_REG_A0];
-	dsp_abs56(dest);
+	dest = dsp_read_acc56(DSP_REG_A);
+	dsp_abs56(&dest);
 
-	source[0] = dsp_core.registers[DSP_REG_B2];
-	source[1] = dsp_core.registers[DSP_REG_B1];
-	source[2] = dsp_core.registers[DSP_REG_B0];
-	dsp_abs56(source);
+	source = dsp_read_acc56(DSP_REG_B);
+	dsp_abs56(&source);
 
-	newsr = dsp_sub56(source, dest);
+	newsr = dsp_sub56(source, &dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-((1<<DSP_SR_V)|(1<<DSP_SR_C));
 	dsp_core.registers[DSP_REG_SR] |= newsr;
@@ -5431,22 +5215,18 @@ static void dsp_cmpm_b_a(void)
 
 static void dsp_cmpm_a_b(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dest[0] = dsp_core.registers[DSP_REG_B2];
-	dest[1] = dsp_core.registers[DSP_REG_B1];
-	dest[2] = dsp_core.registers[DSP_REG_B0];
-	dsp_abs56(dest);
+	dest = dsp_read_acc56(DSP_REG_B);
+	dsp_abs56(&dest);
 
-	source[0] = dsp_core.registers[DSP_REG_A2];
-	source[1] = dsp_core.registers[DSP_REG_A1];
-	source[2] = dsp_core.registers[DSP_REG_A0];
-	dsp_abs56(source);
+	source = dsp_read_acc56(DSP_REG_A);
+	dsp_abs56(&source);
 
-	newsr = dsp_sub56(source, dest);
+	newsr = dsp_sub56(source, &dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-((1<<DSP_SR_V)|(1<<DSP_SR_C));
 	dsp_core.registers[DSP_REG_SR] |= newsr;
@@ -5454,22 +5234,18 @@ static void dsp_cmpm_a_b(void)
 
 static void dsp_cmpm_x0_a(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dest[2] = dsp_core.registers[DSP_REG_A0];
-	dest[1] = dsp_core.registers[DSP_REG_A1];
-	dest[0] = dsp_core.registers[DSP_REG_A2];
-	dsp_abs56(dest);
+	dest = dsp_read_acc56(DSP_REG_A);
+	dsp_abs56(&dest);
 
-	source[2] = 0;
-	source[1] = dsp_core.registers[DSP_REG_X0];
-	source[0] = source[1] & (1<<23) ? 0xff : 0x0;
-	dsp_abs56(source);
+	source = dsp_sext56(dsp_core.registers[DSP_REG_X0], 0);
+	dsp_abs56(&source);
 
-	newsr = dsp_sub56(source, dest);
+	newsr = dsp_sub56(source, &dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-((1<<DSP_SR_V)|(1<<DSP_SR_C));
 	dsp_core.registers[DSP_REG_SR] |= newsr;
@@ -5477,22 +5253,18 @@ static void dsp_cmpm_x0_a(void)
 
 static void dsp_cmpm_x0_b(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dest[0] = dsp_core.registers[DSP_REG_B2];
-	dest[1] = dsp_core.registers[DSP_REG_B1];
-	dest[2] = dsp_core.registers[DSP_REG_B0];
-	dsp_abs56(dest);
+	dest = dsp_read_acc56(DSP_REG_B);
+	dsp_abs56(&dest);
 
-	source[2] = 0;
-	source[1] = dsp_core.registers[DSP_REG_X0];
-	source[0] = source[1] & (1<<23) ? 0xff : 0x0;
-	dsp_abs56(source);
+	source = dsp_sext56(dsp_core.registers[DSP_REG_X0], 0);
+	dsp_abs56(&source);
 
-	newsr = dsp_sub56(source, dest);
+	newsr = dsp_sub56(source, &dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-((1<<DSP_SR_V)|(1<<DSP_SR_C));
 	dsp_core.registers[DSP_REG_SR] |= newsr;
@@ -5500,22 +5272,18 @@ static void dsp_cmpm_x0_b(void)
 
 static void dsp_cmpm_y0_a(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dest[2] = dsp_core.registers[DSP_REG_A0];
-	dest[1] = dsp_core.registers[DSP_REG_A1];
-	dest[0] = dsp_core.registers[DSP_REG_A2];
-	dsp_abs56(dest);
+	dest = dsp_read_acc56(DSP_REG_A);
+	dsp_abs56(&dest);
 
-	source[2] = 0;
-	source[1] = dsp_core.registers[DSP_REG_Y0];
-	source[0] = source[1] & (1<<23) ? 0xff : 0x0;
-	dsp_abs56(source);
+	source = dsp_sext56(dsp_core.registers[DSP_REG_Y0], 0);
+	dsp_abs56(&source);
 
-	newsr = dsp_sub56(source, dest);
+	newsr = dsp_sub56(source, &dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-((1<<DSP_SR_V)|(1<<DSP_SR_C));
 	dsp_core.registers[DSP_REG_SR] |= newsr;
@@ -5523,22 +5291,18 @@ static void dsp_cmpm_y0_a(void)
 
 static void dsp_cmpm_y0_b(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dest[0] = dsp_core.registers[DSP_REG_B2];
-	dest[1] = dsp_core.registers[DSP_REG_B1];
-	dest[2] = dsp_core.registers[DSP_REG_B0];
-	dsp_abs56(dest);
+	dest = dsp_read_acc56(DSP_REG_B);
+	dsp_abs56(&dest);
 
-	source[2] = 0;
-	source[1] = dsp_core.registers[DSP_REG_Y0];
-	source[0] = source[1] & (1<<23) ? 0xff : 0x0;
-	dsp_abs56(source);
+	source = dsp_sext56(dsp_core.registers[DSP_REG_Y0], 0);
+	dsp_abs56(&source);
 
-	newsr = dsp_sub56(source, dest);
+	newsr = dsp_sub56(source, &dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-((1<<DSP_SR_V)|(1<<DSP_SR_C));
 	dsp_core.registers[DSP_REG_SR] |= newsr;
@@ -5546,22 +5310,18 @@ static void dsp_cmpm_y0_b(void)
 
 static void dsp_cmpm_x1_a(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dest[2] = dsp_core.registers[DSP_REG_A0];
-	dest[1] = dsp_core.registers[DSP_REG_A1];
-	dest[0] = dsp_core.registers[DSP_REG_A2];
-	dsp_abs56(dest);
+	dest = dsp_read_acc56(DSP_REG_A);
+	dsp_abs56(&dest);
 
-	source[2] = 0;
-	source[1] = dsp_core.registers[DSP_REG_X1];
-	source[0] = source[1] & (1<<23) ? 0xff : 0x0;
-	dsp_abs56(source);
+	source = dsp_sext56(dsp_core.registers[DSP_REG_X1], 0);
+	dsp_abs56(&source);
 
-	newsr = dsp_sub56(source, dest);
+	newsr = dsp_sub56(source, &dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-((1<<DSP_SR_V)|(1<<DSP_SR_C));
 	dsp_core.registers[DSP_REG_SR] |= newsr;
@@ -5569,22 +5329,18 @@ static void dsp_cmpm_x1_a(void)
 
 static void dsp_cmpm_x1_b(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dest[0] = dsp_core.registers[DSP_REG_B2];
-	dest[1] = dsp_core.registers[DSP_REG_B1];
-	dest[2] = dsp_core.registers[DSP_REG_B0];
-	dsp_abs56(dest);
+	dest = dsp_read_acc56(DSP_REG_B);
+	dsp_abs56(&dest);
 
-	source[2] = 0;
-	source[1] = dsp_core.registers[DSP_REG_X1];
-	source[0] = source[1] & (1<<23) ? 0xff : 0x0;
-	dsp_abs56(source);
+	source = dsp_sext56(dsp_core.registers[DSP_REG_X1], 0);
+	dsp_abs56(&source);
 
-	newsr = dsp_sub56(source, dest);
+	newsr = dsp_sub56(source, &dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-((1<<DSP_SR_V)|(1<<DSP_SR_C));
 	dsp_core.registers[DSP_REG_SR] |= newsr;
@@ -5592,22 +5348,18 @@ static void dsp_cmpm_x1_b(void)
 
 static void dsp_cmpm_y1_a(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dest[2] = dsp_core.registers[DSP_REG_A0];
-	dest[1] = dsp_core.registers[DSP_REG_A1];
-	dest[0] = dsp_core.registers[DSP_REG_A2];
-	dsp_abs56(dest);
+	dest = dsp_read_acc56(DSP_REG_A);
+	dsp_abs56(&dest);
 
-	source[2] = 0;
-	source[1] = dsp_core.registers[DSP_REG_Y1];
-	source[0] = source[1] & (1<<23) ? 0xff : 0x0;
-	dsp_abs56(source);
+	source = dsp_sext56(dsp_core.registers[DSP_REG_Y1], 0);
+	dsp_abs56(&source);
 
-	newsr = dsp_sub56(source, dest);
+	newsr = dsp_sub56(source, &dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-((1<<DSP_SR_V)|(1<<DSP_SR_C));
 	dsp_core.registers[DSP_REG_SR] |= newsr;
@@ -5615,22 +5367,18 @@ static void dsp_cmpm_y1_a(void)
 
 static void dsp_cmpm_y1_b(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dest[0] = dsp_core.registers[DSP_REG_B2];
-	dest[1] = dsp_core.registers[DSP_REG_B1];
-	dest[2] = dsp_core.registers[DSP_REG_B0];
-	dsp_abs56(dest);
+	dest = dsp_read_acc56(DSP_REG_B);
+	dsp_abs56(&dest);
 
-	source[2] = 0;
-	source[1] = dsp_core.registers[DSP_REG_Y1];
-	source[0] = source[1] & (1<<23) ? 0xff : 0x0;
-	dsp_abs56(source);
+	source = dsp_sext56(dsp_core.registers[DSP_REG_Y1], 0);
+	dsp_abs56(&source);
 
-	newsr = dsp_sub56(source, dest);
+	newsr = dsp_sub56(source, &dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-((1<<DSP_SR_V)|(1<<DSP_SR_C));
 	dsp_core.registers[DSP_REG_SR] |= newsr;
@@ -5764,21 +5512,17 @@ static void dsp_lsr_b(void)
 
 static void dsp_mac_p_x0_x0_a(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_X0], dsp_core.registers[DSP_REG_X0], source, SIGN_PLUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_X0], dsp_core.registers[DSP_REG_X0], SIGN_PLUS);
 
-	dest[0] = dsp_core.registers[DSP_REG_A2];
-	dest[1] = dsp_core.registers[DSP_REG_A1];
-	dest[2] = dsp_core.registers[DSP_REG_A0];
-	newsr = dsp_add56(source, dest);
+	dest = dsp_read_acc56(DSP_REG_A);
+	newsr = dsp_add56(source, &dest);
 
-	dsp_core.registers[DSP_REG_A2] = dest[0];
-	dsp_core.registers[DSP_REG_A1] = dest[1];
-	dsp_core.registers[DSP_REG_A0] = dest[2];
+	dsp_write_acc56(DSP_REG_A, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 	dsp_core.registers[DSP_REG_SR] |= newsr & 0xfe;
@@ -5786,42 +5530,34 @@ static void dsp_mac_p_x0_x0_a(void)
 
 static void dsp_mac_m_x0_x0_a(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_X0], dsp_core.registers[DSP_REG_X0], source, SIGN_MINUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_X0], dsp_core.registers[DSP_REG_X0], SIGN_MINUS);
 
-	dest[0] = dsp_core.registers[DSP_REG_A2];
-	dest[1] = dsp_core.registers[DSP_REG_A1];
-	dest[2] = dsp_core.registers[DSP_REG_A0];
-	newsr = dsp_add56(source, dest);
+	dest = dsp_read_acc56(DSP_REG_A);
+	newsr = dsp_add56(source, &dest);
 
-	dsp_core.registers[DSP_REG_A2] = dest[0];
-	dsp_core.registers[DSP_REG_A1] = dest[1];
-	dsp_core.registers[DSP_REG_A0] = dest[2];
+	dsp_write_acc56(DSP_REG_A, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 	dsp_core.registers[DSP_REG_SR] |= newsr & 0xfe;
 }
 static void dsp_mac_p_x0_x0_b(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_X0], dsp_core.registers[DSP_REG_X0], source, SIGN_PLUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_X0], dsp_core.registers[DSP_REG_X0], SIGN_PLUS);
 
-	dest[0] = dsp_core.registers[DSP_REG_B2];
-	dest[1] = dsp_core.registers[DSP_REG_B1];
-	dest[2] = dsp_core.registers[DSP_REG_B0];
-	newsr = dsp_add56(source, dest);
+	dest = dsp_read_acc56(DSP_REG_B);
+	newsr = dsp_add56(source, &dest);
 
-	dsp_core.registers[DSP_REG_B2] = dest[0];
-	dsp_core.registers[DSP_REG_B1] = dest[1];
-	dsp_core.registers[DSP_REG_B0] = dest[2];
+	dsp_write_acc56(DSP_REG_B, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 	dsp_core.registers[DSP_REG_SR] |= newsr & 0xfe;
@@ -5829,21 +5565,17 @@ static void dsp_mac_p_x0_x0_b(void)
 
 static void dsp_mac_m_x0_x0_b(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_X0], dsp_core.registers[DSP_REG_X0], source, SIGN_MINUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_X0], dsp_core.registers[DSP_REG_X0], SIGN_MINUS);
 
-	dest[0] = dsp_core.registers[DSP_REG_B2];
-	dest[1] = dsp_core.registers[DSP_REG_B1];
-	dest[2] = dsp_core.registers[DSP_REG_B0];
-	newsr = dsp_add56(source, dest);
+	dest = dsp_read_acc56(DSP_REG_B);
+	newsr = dsp_add56(source, &dest);
 
-	dsp_core.registers[DSP_REG_B2] = dest[0];
-	dsp_core.registers[DSP_REG_B1] = dest[1];
-	dsp_core.registers[DSP_REG_B0] = dest[2];
+	dsp_write_acc56(DSP_REG_B, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 	dsp_core.registers[DSP_REG_SR] |= newsr & 0xfe;
@@ -5851,21 +5583,17 @@ static void dsp_mac_m_x0_x0_b(void)
 
 static void dsp_mac_p_y0_y0_a(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_Y0], dsp_core.registers[DSP_REG_Y0], source, SIGN_PLUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_Y0], dsp_core.registers[DSP_REG_Y0], SIGN_PLUS);
 
-	dest[0] = dsp_core.registers[DSP_REG_A2];
-	dest[1] = dsp_core.registers[DSP_REG_A1];
-	dest[2] = dsp_core.registers[DSP_REG_A0];
-	newsr = dsp_add56(source, dest);
+	dest = dsp_read_acc56(DSP_REG_A);
+	newsr = dsp_add56(source, &dest);
 
-	dsp_core.registers[DSP_REG_A2] = dest[0];
-	dsp_core.registers[DSP_REG_A1] = dest[1];
-	dsp_core.registers[DSP_REG_A0] = dest[2];
+	dsp_write_acc56(DSP_REG_A, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 	dsp_core.registers[DSP_REG_SR] |= newsr & 0xfe;
@@ -5873,42 +5601,34 @@ static void dsp_mac_p_y0_y0_a(void)
 
 static void dsp_mac_m_y0_y0_a(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_Y0], dsp_core.registers[DSP_REG_Y0], source, SIGN_MINUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_Y0], dsp_core.registers[DSP_REG_Y0], SIGN_MINUS);
 
-	dest[0] = dsp_core.registers[DSP_REG_A2];
-	dest[1] = dsp_core.registers[DSP_REG_A1];
-	dest[2] = dsp_core.registers[DSP_REG_A0];
-	newsr = dsp_add56(source, dest);
+	dest = dsp_read_acc56(DSP_REG_A);
+	newsr = dsp_add56(source, &dest);
 
-	dsp_core.registers[DSP_REG_A2] = dest[0];
-	dsp_core.registers[DSP_REG_A1] = dest[1];
-	dsp_core.registers[DSP_REG_A0] = dest[2];
+	dsp_write_acc56(DSP_REG_A, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 	dsp_core.registers[DSP_REG_SR] |= newsr & 0xfe;
 }
 static void dsp_mac_p_y0_y0_b(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_Y0], dsp_core.registers[DSP_REG_Y0], source, SIGN_PLUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_Y0], dsp_core.registers[DSP_REG_Y0], SIGN_PLUS);
 
-	dest[0] = dsp_core.registers[DSP_REG_B2];
-	dest[1] = dsp_core.registers[DSP_REG_B1];
-	dest[2] = dsp_core.registers[DSP_REG_B0];
-	newsr = dsp_add56(source, dest);
+	dest = dsp_read_acc56(DSP_REG_B);
+	newsr = dsp_add56(source, &dest);
 
-	dsp_core.registers[DSP_REG_B2] = dest[0];
-	dsp_core.registers[DSP_REG_B1] = dest[1];
-	dsp_core.registers[DSP_REG_B0] = dest[2];
+	dsp_write_acc56(DSP_REG_B, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 	dsp_core.registers[DSP_REG_SR] |= newsr & 0xfe;
@@ -5916,21 +5636,17 @@ static void dsp_mac_p_y0_y0_b(void)
 
 static void dsp_mac_m_y0_y0_b(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_Y0], dsp_core.registers[DSP_REG_Y0], source, SIGN_MINUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_Y0], dsp_core.registers[DSP_REG_Y0], SIGN_MINUS);
 
-	dest[0] = dsp_core.registers[DSP_REG_B2];
-	dest[1] = dsp_core.registers[DSP_REG_B1];
-	dest[2] = dsp_core.registers[DSP_REG_B0];
-	newsr = dsp_add56(source, dest);
+	dest = dsp_read_acc56(DSP_REG_B);
+	newsr = dsp_add56(source, &dest);
 
-	dsp_core.registers[DSP_REG_B2] = dest[0];
-	dsp_core.registers[DSP_REG_B1] = dest[1];
-	dsp_core.registers[DSP_REG_B0] = dest[2];
+	dsp_write_acc56(DSP_REG_B, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 	dsp_core.registers[DSP_REG_SR] |= newsr & 0xfe;
@@ -5938,21 +5654,17 @@ static void dsp_mac_m_y0_y0_b(void)
 
 static void dsp_mac_p_x1_x0_a(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_X1], dsp_core.registers[DSP_REG_X0], source, SIGN_PLUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_X1], dsp_core.registers[DSP_REG_X0], SIGN_PLUS);
 
-	dest[0] = dsp_core.registers[DSP_REG_A2];
-	dest[1] = dsp_core.registers[DSP_REG_A1];
-	dest[2] = dsp_core.registers[DSP_REG_A0];
-	newsr = dsp_add56(source, dest);
+	dest = dsp_read_acc56(DSP_REG_A);
+	newsr = dsp_add56(source, &dest);
 
-	dsp_core.registers[DSP_REG_A2] = dest[0];
-	dsp_core.registers[DSP_REG_A1] = dest[1];
-	dsp_core.registers[DSP_REG_A0] = dest[2];
+	dsp_write_acc56(DSP_REG_A, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 	dsp_core.registers[DSP_REG_SR] |= newsr & 0xfe;
@@ -5960,21 +5672,17 @@ static void dsp_mac_p_x1_x0_a(void)
 
 static void dsp_mac_m_x1_x0_a(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_X1], dsp_core.registers[DSP_REG_X0], source, SIGN_MINUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_X1], dsp_core.registers[DSP_REG_X0], SIGN_MINUS);
 
-	dest[0] = dsp_core.registers[DSP_REG_A2];
-	dest[1] = dsp_core.registers[DSP_REG_A1];
-	dest[2] = dsp_core.registers[DSP_REG_A0];
-	newsr = dsp_add56(source, dest);
+	dest = dsp_read_acc56(DSP_REG_A);
+	newsr = dsp_add56(source, &dest);
 
-	dsp_core.registers[DSP_REG_A2] = dest[0];
-	dsp_core.registers[DSP_REG_A1] = dest[1];
-	dsp_core.registers[DSP_REG_A0] = dest[2];
+	dsp_write_acc56(DSP_REG_A, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 	dsp_core.registers[DSP_REG_SR] |= newsr & 0xfe;
@@ -5982,21 +5690,17 @@ static void dsp_mac_m_x1_x0_a(void)
 
 static void dsp_mac_p_x1_x0_b(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_X1], dsp_core.registers[DSP_REG_X0], source, SIGN_PLUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_X1], dsp_core.registers[DSP_REG_X0], SIGN_PLUS);
 
-	dest[0] = dsp_core.registers[DSP_REG_B2];
-	dest[1] = dsp_core.registers[DSP_REG_B1];
-	dest[2] = dsp_core.registers[DSP_REG_B0];
-	newsr = dsp_add56(source, dest);
+	dest = dsp_read_acc56(DSP_REG_B);
+	newsr = dsp_add56(source, &dest);
 
-	dsp_core.registers[DSP_REG_B2] = dest[0];
-	dsp_core.registers[DSP_REG_B1] = dest[1];
-	dsp_core.registers[DSP_REG_B0] = dest[2];
+	dsp_write_acc56(DSP_REG_B, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 	dsp_core.registers[DSP_REG_SR] |= newsr & 0xfe;
@@ -6004,21 +5708,17 @@ static void dsp_mac_p_x1_x0_b(void)
 
 static void dsp_mac_m_x1_x0_b(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_X1], dsp_core.registers[DSP_REG_X0], source, SIGN_MINUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_X1], dsp_core.registers[DSP_REG_X0], SIGN_MINUS);
 
-	dest[0] = dsp_core.registers[DSP_REG_B2];
-	dest[1] = dsp_core.registers[DSP_REG_B1];
-	dest[2] = dsp_core.registers[DSP_REG_B0];
-	newsr = dsp_add56(source, dest);
+	dest = dsp_read_acc56(DSP_REG_B);
+	newsr = dsp_add56(source, &dest);
 
-	dsp_core.registers[DSP_REG_B2] = dest[0];
-	dsp_core.registers[DSP_REG_B1] = dest[1];
-	dsp_core.registers[DSP_REG_B0] = dest[2];
+	dsp_write_acc56(DSP_REG_B, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 	dsp_core.registers[DSP_REG_SR] |= newsr & 0xfe;
@@ -6026,21 +5726,17 @@ static void dsp_mac_m_x1_x0_b(void)
 
 static void dsp_mac_p_y1_y0_a(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_Y1], dsp_core.registers[DSP_REG_Y0], source, SIGN_PLUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_Y1], dsp_core.registers[DSP_REG_Y0], SIGN_PLUS);
 
-	dest[0] = dsp_core.registers[DSP_REG_A2];
-	dest[1] = dsp_core.registers[DSP_REG_A1];
-	dest[2] = dsp_core.registers[DSP_REG_A0];
-	newsr = dsp_add56(source, dest);
+	dest = dsp_read_acc56(DSP_REG_A);
+	newsr = dsp_add56(source, &dest);
 
-	dsp_core.registers[DSP_REG_A2] = dest[0];
-	dsp_core.registers[DSP_REG_A1] = dest[1];
-	dsp_core.registers[DSP_REG_A0] = dest[2];
+	dsp_write_acc56(DSP_REG_A, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 	dsp_core.registers[DSP_REG_SR] |= newsr & 0xfe;
@@ -6048,21 +5744,17 @@ static void dsp_mac_p_y1_y0_a(void)
 
 static void dsp_mac_m_y1_y0_a(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_Y1], dsp_core.registers[DSP_REG_Y0], source, SIGN_MINUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_Y1], dsp_core.registers[DSP_REG_Y0], SIGN_MINUS);
 
-	dest[0] = dsp_core.registers[DSP_REG_A2];
-	dest[1] = dsp_core.registers[DSP_REG_A1];
-	dest[2] = dsp_core.registers[DSP_REG_A0];
-	newsr = dsp_add56(source, dest);
+	dest = dsp_read_acc56(DSP_REG_A);
+	newsr = dsp_add56(source, &dest);
 
-	dsp_core.registers[DSP_REG_A2] = dest[0];
-	dsp_core.registers[DSP_REG_A1] = dest[1];
-	dsp_core.registers[DSP_REG_A0] = dest[2];
+	dsp_write_acc56(DSP_REG_A, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 	dsp_core.registers[DSP_REG_SR] |= newsr & 0xfe;
@@ -6070,21 +5762,17 @@ static void dsp_mac_m_y1_y0_a(void)
 
 static void dsp_mac_p_y1_y0_b(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_Y1], dsp_core.registers[DSP_REG_Y0], source, SIGN_PLUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_Y1], dsp_core.registers[DSP_REG_Y0], SIGN_PLUS);
 
-	dest[0] = dsp_core.registers[DSP_REG_B2];
-	dest[1] = dsp_core.registers[DSP_REG_B1];
-	dest[2] = dsp_core.registers[DSP_REG_B0];
-	newsr = dsp_add56(source, dest);
+	dest = dsp_read_acc56(DSP_REG_B);
+	newsr = dsp_add56(source, &dest);
 
-	dsp_core.registers[DSP_REG_B2] = dest[0];
-	dsp_core.registers[DSP_REG_B1] = dest[1];
-	dsp_core.registers[DSP_REG_B0] = dest[2];
+	dsp_write_acc56(DSP_REG_B, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 	dsp_core.registers[DSP_REG_SR] |= newsr & 0xfe;
@@ -6092,21 +5780,17 @@ static void dsp_mac_p_y1_y0_b(void)
 
 static void dsp_mac_m_y1_y0_b(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_Y1], dsp_core.registers[DSP_REG_Y0], source, SIGN_MINUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_Y1], dsp_core.registers[DSP_REG_Y0], SIGN_MINUS);
 
-	dest[0] = dsp_core.registers[DSP_REG_B2];
-	dest[1] = dsp_core.registers[DSP_REG_B1];
-	dest[2] = dsp_core.registers[DSP_REG_B0];
-	newsr = dsp_add56(source, dest);
+	dest = dsp_read_acc56(DSP_REG_B);
+	newsr = dsp_add56(source, &dest);
 
-	dsp_core.registers[DSP_REG_B2] = dest[0];
-	dsp_core.registers[DSP_REG_B1] = dest[1];
-	dsp_core.registers[DSP_REG_B0] = dest[2];
+	dsp_write_acc56(DSP_REG_B, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 	dsp_core.registers[DSP_REG_SR] |= newsr & 0xfe;
@@ -6114,21 +5798,17 @@ static void dsp_mac_m_y1_y0_b(void)
 
 static void dsp_mac_p_x0_y1_a(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_X0], dsp_core.registers[DSP_REG_Y1], source, SIGN_PLUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_X0], dsp_core.registers[DSP_REG_Y1], SIGN_PLUS);
 
-	dest[0] = dsp_core.registers[DSP_REG_A2];
-	dest[1] = dsp_core.registers[DSP_REG_A1];
-	dest[2] = dsp_core.registers[DSP_REG_A0];
-	newsr = dsp_add56(source, dest);
+	dest = dsp_read_acc56(DSP_REG_A);
+	newsr = dsp_add56(source, &dest);
 
-	dsp_core.registers[DSP_REG_A2] = dest[0];
-	dsp_core.registers[DSP_REG_A1] = dest[1];
-	dsp_core.registers[DSP_REG_A0] = dest[2];
+	dsp_write_acc56(DSP_REG_A, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 	dsp_core.registers[DSP_REG_SR] |= newsr & 0xfe;
@@ -6136,21 +5816,17 @@ static void dsp_mac_p_x0_y1_a(void)
 
 static void dsp_mac_m_x0_y1_a(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_X0], dsp_core.registers[DSP_REG_Y1], source, SIGN_MINUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_X0], dsp_core.registers[DSP_REG_Y1], SIGN_MINUS);
 
-	dest[0] = dsp_core.registers[DSP_REG_A2];
-	dest[1] = dsp_core.registers[DSP_REG_A1];
-	dest[2] = dsp_core.registers[DSP_REG_A0];
-	newsr = dsp_add56(source, dest);
+	dest = dsp_read_acc56(DSP_REG_A);
+	newsr = dsp_add56(source, &dest);
 
-	dsp_core.registers[DSP_REG_A2] = dest[0];
-	dsp_core.registers[DSP_REG_A1] = dest[1];
-	dsp_core.registers[DSP_REG_A0] = dest[2];
+	dsp_write_acc56(DSP_REG_A, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 	dsp_core.registers[DSP_REG_SR] |= newsr & 0xfe;
@@ -6158,21 +5834,17 @@ static void dsp_mac_m_x0_y1_a(void)
 
 static void dsp_mac_p_x0_y1_b(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_X0], dsp_core.registers[DSP_REG_Y1], source, SIGN_PLUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_X0], dsp_core.registers[DSP_REG_Y1], SIGN_PLUS);
 
-	dest[0] = dsp_core.registers[DSP_REG_B2];
-	dest[1] = dsp_core.registers[DSP_REG_B1];
-	dest[2] = dsp_core.registers[DSP_REG_B0];
-	newsr = dsp_add56(source, dest);
+	dest = dsp_read_acc56(DSP_REG_B);
+	newsr = dsp_add56(source, &dest);
 
-	dsp_core.registers[DSP_REG_B2] = dest[0];
-	dsp_core.registers[DSP_REG_B1] = dest[1];
-	dsp_core.registers[DSP_REG_B0] = dest[2];
+	dsp_write_acc56(DSP_REG_B, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 	dsp_core.registers[DSP_REG_SR] |= newsr & 0xfe;
@@ -6180,21 +5852,17 @@ static void dsp_mac_p_x0_y1_b(void)
 
 static void dsp_mac_m_x0_y1_b(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_X0], dsp_core.registers[DSP_REG_Y1], source, SIGN_MINUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_X0], dsp_core.registers[DSP_REG_Y1], SIGN_MINUS);
 
-	dest[0] = dsp_core.registers[DSP_REG_B2];
-	dest[1] = dsp_core.registers[DSP_REG_B1];
-	dest[2] = dsp_core.registers[DSP_REG_B0];
-	newsr = dsp_add56(source, dest);
+	dest = dsp_read_acc56(DSP_REG_B);
+	newsr = dsp_add56(source, &dest);
 
-	dsp_core.registers[DSP_REG_B2] = dest[0];
-	dsp_core.registers[DSP_REG_B1] = dest[1];
-	dsp_core.registers[DSP_REG_B0] = dest[2];
+	dsp_write_acc56(DSP_REG_B, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 	dsp_core.registers[DSP_REG_SR] |= newsr & 0xfe;
@@ -6202,21 +5870,17 @@ static void dsp_mac_m_x0_y1_b(void)
 
 static void dsp_mac_p_y0_x0_a(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_Y0], dsp_core.registers[DSP_REG_X0], source, SIGN_PLUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_Y0], dsp_core.registers[DSP_REG_X0], SIGN_PLUS);
 
-	dest[0] = dsp_core.registers[DSP_REG_A2];
-	dest[1] = dsp_core.registers[DSP_REG_A1];
-	dest[2] = dsp_core.registers[DSP_REG_A0];
-	newsr = dsp_add56(source, dest);
+	dest = dsp_read_acc56(DSP_REG_A);
+	newsr = dsp_add56(source, &dest);
 
-	dsp_core.registers[DSP_REG_A2] = dest[0];
-	dsp_core.registers[DSP_REG_A1] = dest[1];
-	dsp_core.registers[DSP_REG_A0] = dest[2];
+	dsp_write_acc56(DSP_REG_A, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 	dsp_core.registers[DSP_REG_SR] |= newsr & 0xfe;
@@ -6224,21 +5888,17 @@ static void dsp_mac_p_y0_x0_a(void)
 
 static void dsp_mac_m_y0_x0_a(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_Y0], dsp_core.registers[DSP_REG_X0], source, SIGN_MINUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_Y0], dsp_core.registers[DSP_REG_X0], SIGN_MINUS);
 
-	dest[0] = dsp_core.registers[DSP_REG_A2];
-	dest[1] = dsp_core.registers[DSP_REG_A1];
-	dest[2] = dsp_core.registers[DSP_REG_A0];
-	newsr = dsp_add56(source, dest);
+	dest = dsp_read_acc56(DSP_REG_A);
+	newsr = dsp_add56(source, &dest);
 
-	dsp_core.registers[DSP_REG_A2] = dest[0];
-	dsp_core.registers[DSP_REG_A1] = dest[1];
-	dsp_core.registers[DSP_REG_A0] = dest[2];
+	dsp_write_acc56(DSP_REG_A, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 	dsp_core.registers[DSP_REG_SR] |= newsr & 0xfe;
@@ -6246,21 +5906,17 @@ static void dsp_mac_m_y0_x0_a(void)
 
 static void dsp_mac_p_y0_x0_b(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_Y0], dsp_core.registers[DSP_REG_X0], source, SIGN_PLUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_Y0], dsp_core.registers[DSP_REG_X0], SIGN_PLUS);
 
-	dest[0] = dsp_core.registers[DSP_REG_B2];
-	dest[1] = dsp_core.registers[DSP_REG_B1];
-	dest[2] = dsp_core.registers[DSP_REG_B0];
-	newsr = dsp_add56(source, dest);
+	dest = dsp_read_acc56(DSP_REG_B);
+	newsr = dsp_add56(source, &dest);
 
-	dsp_core.registers[DSP_REG_B2] = dest[0];
-	dsp_core.registers[DSP_REG_B1] = dest[1];
-	dsp_core.registers[DSP_REG_B0] = dest[2];
+	dsp_write_acc56(DSP_REG_B, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 	dsp_core.registers[DSP_REG_SR] |= newsr & 0xfe;
@@ -6268,21 +5924,17 @@ static void dsp_mac_p_y0_x0_b(void)
 
 static void dsp_mac_m_y0_x0_b(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_Y0], dsp_core.registers[DSP_REG_X0], source, SIGN_MINUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_Y0], dsp_core.registers[DSP_REG_X0], SIGN_MINUS);
 
-	dest[0] = dsp_core.registers[DSP_REG_B2];
-	dest[1] = dsp_core.registers[DSP_REG_B1];
-	dest[2] = dsp_core.registers[DSP_REG_B0];
-	newsr = dsp_add56(source, dest);
+	dest = dsp_read_acc56(DSP_REG_B);
+	newsr = dsp_add56(source, &dest);
 
-	dsp_core.registers[DSP_REG_B2] = dest[0];
-	dsp_core.registers[DSP_REG_B1] = dest[1];
-	dsp_core.registers[DSP_REG_B0] = dest[2];
+	dsp_write_acc56(DSP_REG_B, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 	dsp_core.registers[DSP_REG_SR] |= newsr & 0xfe;
@@ -6290,21 +5942,17 @@ static void dsp_mac_m_y0_x0_b(void)
 
 static void dsp_mac_p_x1_y0_a(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_X1], dsp_core.registers[DSP_REG_Y0], source, SIGN_PLUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_X1], dsp_core.registers[DSP_REG_Y0], SIGN_PLUS);
 
-	dest[0] = dsp_core.registers[DSP_REG_A2];
-	dest[1] = dsp_core.registers[DSP_REG_A1];
-	dest[2] = dsp_core.registers[DSP_REG_A0];
-	newsr = dsp_add56(source, dest);
+	dest = dsp_read_acc56(DSP_REG_A);
+	newsr = dsp_add56(source, &dest);
 
-	dsp_core.registers[DSP_REG_A2] = dest[0];
-	dsp_core.registers[DSP_REG_A1] = dest[1];
-	dsp_core.registers[DSP_REG_A0] = dest[2];
+	dsp_write_acc56(DSP_REG_A, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 	dsp_core.registers[DSP_REG_SR] |= newsr & 0xfe;
@@ -6312,21 +5960,17 @@ static void dsp_mac_p_x1_y0_a(void)
 
 static void dsp_mac_m_x1_y0_a(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_X1], dsp_core.registers[DSP_REG_Y0], source, SIGN_MINUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_X1], dsp_core.registers[DSP_REG_Y0], SIGN_MINUS);
 
-	dest[0] = dsp_core.registers[DSP_REG_A2];
-	dest[1] = dsp_core.registers[DSP_REG_A1];
-	dest[2] = dsp_core.registers[DSP_REG_A0];
-	newsr = dsp_add56(source, dest);
+	dest = dsp_read_acc56(DSP_REG_A);
+	newsr = dsp_add56(source, &dest);
 
-	dsp_core.registers[DSP_REG_A2] = dest[0];
-	dsp_core.registers[DSP_REG_A1] = dest[1];
-	dsp_core.registers[DSP_REG_A0] = dest[2];
+	dsp_write_acc56(DSP_REG_A, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 	dsp_core.registers[DSP_REG_SR] |= newsr & 0xfe;
@@ -6334,21 +5978,17 @@ static void dsp_mac_m_x1_y0_a(void)
 
 static void dsp_mac_p_x1_y0_b(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_X1], dsp_core.registers[DSP_REG_Y0], source, SIGN_PLUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_X1], dsp_core.registers[DSP_REG_Y0], SIGN_PLUS);
 
-	dest[0] = dsp_core.registers[DSP_REG_B2];
-	dest[1] = dsp_core.registers[DSP_REG_B1];
-	dest[2] = dsp_core.registers[DSP_REG_B0];
-	newsr = dsp_add56(source, dest);
+	dest = dsp_read_acc56(DSP_REG_B);
+	newsr = dsp_add56(source, &dest);
 
-	dsp_core.registers[DSP_REG_B2] = dest[0];
-	dsp_core.registers[DSP_REG_B1] = dest[1];
-	dsp_core.registers[DSP_REG_B0] = dest[2];
+	dsp_write_acc56(DSP_REG_B, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 	dsp_core.registers[DSP_REG_SR] |= newsr & 0xfe;
@@ -6356,21 +5996,17 @@ static void dsp_mac_p_x1_y0_b(void)
 
 static void dsp_mac_m_x1_y0_b(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_X1], dsp_core.registers[DSP_REG_Y0], source, SIGN_MINUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_X1], dsp_core.registers[DSP_REG_Y0], SIGN_MINUS);
 
-	dest[0] = dsp_core.registers[DSP_REG_B2];
-	dest[1] = dsp_core.registers[DSP_REG_B1];
-	dest[2] = dsp_core.registers[DSP_REG_B0];
-	newsr = dsp_add56(source, dest);
+	dest = dsp_read_acc56(DSP_REG_B);
+	newsr = dsp_add56(source, &dest);
 
-	dsp_core.registers[DSP_REG_B2] = dest[0];
-	dsp_core.registers[DSP_REG_B1] = dest[1];
-	dsp_core.registers[DSP_REG_B0] = dest[2];
+	dsp_write_acc56(DSP_REG_B, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 	dsp_core.registers[DSP_REG_SR] |= newsr & 0xfe;
@@ -6378,21 +6014,17 @@ static void dsp_mac_m_x1_y0_b(void)
 
 static void dsp_mac_p_y1_x1_a(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_Y1], dsp_core.registers[DSP_REG_X1], source, SIGN_PLUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_Y1], dsp_core.registers[DSP_REG_X1], SIGN_PLUS);
 
-	dest[0] = dsp_core.registers[DSP_REG_A2];
-	dest[1] = dsp_core.registers[DSP_REG_A1];
-	dest[2] = dsp_core.registers[DSP_REG_A0];
-	newsr = dsp_add56(source, dest);
+	dest = dsp_read_acc56(DSP_REG_A);
+	newsr = dsp_add56(source, &dest);
 
-	dsp_core.registers[DSP_REG_A2] = dest[0];
-	dsp_core.registers[DSP_REG_A1] = dest[1];
-	dsp_core.registers[DSP_REG_A0] = dest[2];
+	dsp_write_acc56(DSP_REG_A, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 	dsp_core.registers[DSP_REG_SR] |= newsr & 0xfe;
@@ -6400,21 +6032,17 @@ static void dsp_mac_p_y1_x1_a(void)
 
 static void dsp_mac_m_y1_x1_a(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_Y1], dsp_core.registers[DSP_REG_X1], source, SIGN_MINUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_Y1], dsp_core.registers[DSP_REG_X1], SIGN_MINUS);
 
-	dest[0] = dsp_core.registers[DSP_REG_A2];
-	dest[1] = dsp_core.registers[DSP_REG_A1];
-	dest[2] = dsp_core.registers[DSP_REG_A0];
-	newsr = dsp_add56(source, dest);
+	dest = dsp_read_acc56(DSP_REG_A);
+	newsr = dsp_add56(source, &dest);
 
-	dsp_core.registers[DSP_REG_A2] = dest[0];
-	dsp_core.registers[DSP_REG_A1] = dest[1];
-	dsp_core.registers[DSP_REG_A0] = dest[2];
+	dsp_write_acc56(DSP_REG_A, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 	dsp_core.registers[DSP_REG_SR] |= newsr & 0xfe;
@@ -6422,21 +6050,17 @@ static void dsp_mac_m_y1_x1_a(void)
 
 static void dsp_mac_p_y1_x1_b(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_Y1], dsp_core.registers[DSP_REG_X1], source, SIGN_PLUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_Y1], dsp_core.registers[DSP_REG_X1], SIGN_PLUS);
 
-	dest[0] = dsp_core.registers[DSP_REG_B2];
-	dest[1] = dsp_core.registers[DSP_REG_B1];
-	dest[2] = dsp_core.registers[DSP_REG_B0];
-	newsr = dsp_add56(source, dest);
+	dest = dsp_read_acc56(DSP_REG_B);
+	newsr = dsp_add56(source, &dest);
 
-	dsp_core.registers[DSP_REG_B2] = dest[0];
-	dsp_core.registers[DSP_REG_B1] = dest[1];
-	dsp_core.registers[DSP_REG_B0] = dest[2];
+	dsp_write_acc56(DSP_REG_B, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 	dsp_core.registers[DSP_REG_SR] |= newsr & 0xfe;
@@ -6444,21 +6068,17 @@ static void dsp_mac_p_y1_x1_b(void)
 
 static void dsp_mac_m_y1_x1_b(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_Y1], dsp_core.registers[DSP_REG_X1], source, SIGN_MINUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_Y1], dsp_core.registers[DSP_REG_X1], SIGN_MINUS);
 
-	dest[0] = dsp_core.registers[DSP_REG_B2];
-	dest[1] = dsp_core.registers[DSP_REG_B1];
-	dest[2] = dsp_core.registers[DSP_REG_B0];
-	newsr = dsp_add56(source, dest);
+	dest = dsp_read_acc56(DSP_REG_B);
+	newsr = dsp_add56(source, &dest);
 
-	dsp_core.registers[DSP_REG_B2] = dest[0];
-	dsp_core.registers[DSP_REG_B1] = dest[1];
-	dsp_core.registers[DSP_REG_B0] = dest[2];
+	dsp_write_acc56(DSP_REG_B, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 	dsp_core.registers[DSP_REG_SR] |= newsr & 0xfe;
@@ -6466,23 +6086,19 @@ static void dsp_mac_m_y1_x1_b(void)
 
 static void dsp_macr_p_x0_x0_a(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_X0], dsp_core.registers[DSP_REG_X0], source, SIGN_PLUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_X0], dsp_core.registers[DSP_REG_X0], SIGN_PLUS);
 
-	dest[0] = dsp_core.registers[DSP_REG_A2];
-	dest[1] = dsp_core.registers[DSP_REG_A1];
-	dest[2] = dsp_core.registers[DSP_REG_A0];
-	newsr = dsp_add56(source, dest);
+	dest = dsp_read_acc56(DSP_REG_A);
+	newsr = dsp_add56(source, &dest);
 
-	dsp_rnd56(dest);
+	dsp_rnd56(&dest);
 
-	dsp_core.registers[DSP_REG_A2] = dest[0];
-	dsp_core.registers[DSP_REG_A1] = dest[1];
-	dsp_core.registers[DSP_REG_A0] = dest[2];
+	dsp_write_acc56(DSP_REG_A, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 	dsp_core.registers[DSP_REG_SR] |= newsr & 0xfe;
@@ -6490,46 +6106,38 @@ static void dsp_macr_p_x0_x0_a(void)
 
 static void dsp_macr_m_x0_x0_a(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_X0], dsp_core.registers[DSP_REG_X0], source, SIGN_MINUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_X0], dsp_core.registers[DSP_REG_X0], SIGN_MINUS);
 
-	dest[0] = dsp_core.registers[DSP_REG_A2];
-	dest[1] = dsp_core.registers[DSP_REG_A1];
-	dest[2] = dsp_core.registers[DSP_REG_A0];
-	newsr = dsp_add56(source, dest);
+	dest = dsp_read_acc56(DSP_REG_A);
+	newsr = dsp_add56(source, &dest);
 
-	dsp_rnd56(dest);
+	dsp_rnd56(&dest);
 
-	dsp_core.registers[DSP_REG_A2] = dest[0];
-	dsp_core.registers[DSP_REG_A1] = dest[1];
-	dsp_core.registers[DSP_REG_A0] = dest[2];
+	dsp_write_acc56(DSP_REG_A, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 	dsp_core.registers[DSP_REG_SR] |= newsr & 0xfe;
 }
 static void dsp_macr_p_x0_x0_b(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_X0], dsp_core.registers[DSP_REG_X0], source, SIGN_PLUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_X0], dsp_core.registers[DSP_REG_X0], SIGN_PLUS);
 
-	dest[0] = dsp_core.registers[DSP_REG_B2];
-	dest[1] = dsp_core.registers[DSP_REG_B1];
-	dest[2] = dsp_core.registers[DSP_REG_B0];
-	newsr = dsp_add56(source, dest);
+	dest = dsp_read_acc56(DSP_REG_B);
+	newsr = dsp_add56(source, &dest);
 
-	dsp_rnd56(dest);
+	dsp_rnd56(&dest);
 
-	dsp_core.registers[DSP_REG_B2] = dest[0];
-	dsp_core.registers[DSP_REG_B1] = dest[1];
-	dsp_core.registers[DSP_REG_B0] = dest[2];
+	dsp_write_acc56(DSP_REG_B, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 	dsp_core.registers[DSP_REG_SR] |= newsr & 0xfe;
@@ -6537,23 +6145,19 @@ static void dsp_macr_p_x0_x0_b(void)
 
 static void dsp_macr_m_x0_x0_b(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_X0], dsp_core.registers[DSP_REG_X0], source, SIGN_MINUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_X0], dsp_core.registers[DSP_REG_X0], SIGN_MINUS);
 
-	dest[0] = dsp_core.registers[DSP_REG_B2];
-	dest[1] = dsp_core.registers[DSP_REG_B1];
-	dest[2] = dsp_core.registers[DSP_REG_B0];
-	newsr = dsp_add56(source, dest);
+	dest = dsp_read_acc56(DSP_REG_B);
+	newsr = dsp_add56(source, &dest);
 
-	dsp_rnd56(dest);
+	dsp_rnd56(&dest);
 
-	dsp_core.registers[DSP_REG_B2] = dest[0];
-	dsp_core.registers[DSP_REG_B1] = dest[1];
-	dsp_core.registers[DSP_REG_B0] = dest[2];
+	dsp_write_acc56(DSP_REG_B, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 	dsp_core.registers[DSP_REG_SR] |= newsr & 0xfe;
@@ -6561,23 +6165,19 @@ static void dsp_macr_m_x0_x0_b(void)
 
 static void dsp_macr_p_y0_y0_a(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_Y0], dsp_core.registers[DSP_REG_Y0], source, SIGN_PLUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_Y0], dsp_core.registers[DSP_REG_Y0], SIGN_PLUS);
 
-	dest[0] = dsp_core.registers[DSP_REG_A2];
-	dest[1] = dsp_core.registers[DSP_REG_A1];
-	dest[2] = dsp_core.registers[DSP_REG_A0];
-	newsr = dsp_add56(source, dest);
+	dest = dsp_read_acc56(DSP_REG_A);
+	newsr = dsp_add56(source, &dest);
 
-	dsp_rnd56(dest);
+	dsp_rnd56(&dest);
 
-	dsp_core.registers[DSP_REG_A2] = dest[0];
-	dsp_core.registers[DSP_REG_A1] = dest[1];
-	dsp_core.registers[DSP_REG_A0] = dest[2];
+	dsp_write_acc56(DSP_REG_A, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 	dsp_core.registers[DSP_REG_SR] |= newsr & 0xfe;
@@ -6585,46 +6185,38 @@ static void dsp_macr_p_y0_y0_a(void)
 
 static void dsp_macr_m_y0_y0_a(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_Y0], dsp_core.registers[DSP_REG_Y0], source, SIGN_MINUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_Y0], dsp_core.registers[DSP_REG_Y0], SIGN_MINUS);
 
-	dest[0] = dsp_core.registers[DSP_REG_A2];
-	dest[1] = dsp_core.registers[DSP_REG_A1];
-	dest[2] = dsp_core.registers[DSP_REG_A0];
-	newsr = dsp_add56(source, dest);
+	dest = dsp_read_acc56(DSP_REG_A);
+	newsr = dsp_add56(source, &dest);
 
-	dsp_rnd56(dest);
+	dsp_rnd56(&dest);
 
-	dsp_core.registers[DSP_REG_A2] = dest[0];
-	dsp_core.registers[DSP_REG_A1] = dest[1];
-	dsp_core.registers[DSP_REG_A0] = dest[2];
+	dsp_write_acc56(DSP_REG_A, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 	dsp_core.registers[DSP_REG_SR] |= newsr & 0xfe;
 }
 static void dsp_macr_p_y0_y0_b(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_Y0], dsp_core.registers[DSP_REG_Y0], source, SIGN_PLUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_Y0], dsp_core.registers[DSP_REG_Y0], SIGN_PLUS);
 
-	dest[0] = dsp_core.registers[DSP_REG_B2];
-	dest[1] = dsp_core.registers[DSP_REG_B1];
-	dest[2] = dsp_core.registers[DSP_REG_B0];
-	newsr = dsp_add56(source, dest);
+	dest = dsp_read_acc56(DSP_REG_B);
+	newsr = dsp_add56(source, &dest);
 
-	dsp_rnd56(dest);
+	dsp_rnd56(&dest);
 
-	dsp_core.registers[DSP_REG_B2] = dest[0];
-	dsp_core.registers[DSP_REG_B1] = dest[1];
-	dsp_core.registers[DSP_REG_B0] = dest[2];
+	dsp_write_acc56(DSP_REG_B, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 	dsp_core.registers[DSP_REG_SR] |= newsr & 0xfe;
@@ -6632,23 +6224,19 @@ static void dsp_macr_p_y0_y0_b(void)
 
 static void dsp_macr_m_y0_y0_b(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_Y0], dsp_core.registers[DSP_REG_Y0], source, SIGN_MINUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_Y0], dsp_core.registers[DSP_REG_Y0], SIGN_MINUS);
 
-	dest[0] = dsp_core.registers[DSP_REG_B2];
-	dest[1] = dsp_core.registers[DSP_REG_B1];
-	dest[2] = dsp_core.registers[DSP_REG_B0];
-	newsr = dsp_add56(source, dest);
+	dest = dsp_read_acc56(DSP_REG_B);
+	newsr = dsp_add56(source, &dest);
 
-	dsp_rnd56(dest);
+	dsp_rnd56(&dest);
 
-	dsp_core.registers[DSP_REG_B2] = dest[0];
-	dsp_core.registers[DSP_REG_B1] = dest[1];
-	dsp_core.registers[DSP_REG_B0] = dest[2];
+	dsp_write_acc56(DSP_REG_B, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 	dsp_core.registers[DSP_REG_SR] |= newsr & 0xfe;
@@ -6656,23 +6244,19 @@ static void dsp_macr_m_y0_y0_b(void)
 
 static void dsp_macr_p_x1_x0_a(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_X1], dsp_core.registers[DSP_REG_X0], source, SIGN_PLUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_X1], dsp_core.registers[DSP_REG_X0], SIGN_PLUS);
 
-	dest[0] = dsp_core.registers[DSP_REG_A2];
-	dest[1] = dsp_core.registers[DSP_REG_A1];
-	dest[2] = dsp_core.registers[DSP_REG_A0];
-	newsr = dsp_add56(source, dest);
+	dest = dsp_read_acc56(DSP_REG_A);
+	newsr = dsp_add56(source, &dest);
 
-	dsp_rnd56(dest);
+	dsp_rnd56(&dest);
 
-	dsp_core.registers[DSP_REG_A2] = dest[0];
-	dsp_core.registers[DSP_REG_A1] = dest[1];
-	dsp_core.registers[DSP_REG_A0] = dest[2];
+	dsp_write_acc56(DSP_REG_A, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 	dsp_core.registers[DSP_REG_SR] |= newsr & 0xfe;
@@ -6680,23 +6264,19 @@ static void dsp_macr_p_x1_x0_a(void)
 
 static void dsp_macr_m_x1_x0_a(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_X1], dsp_core.registers[DSP_REG_X0], source, SIGN_MINUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_X1], dsp_core.registers[DSP_REG_X0], SIGN_MINUS);
 
-	dest[0] = dsp_core.registers[DSP_REG_A2];
-	dest[1] = dsp_core.registers[DSP_REG_A1];
-	dest[2] = dsp_core.registers[DSP_REG_A0];
-	newsr = dsp_add56(source, dest);
+	dest = dsp_read_acc56(DSP_REG_A);
+	newsr = dsp_add56(source, &dest);
 
-	dsp_rnd56(dest);
+	dsp_rnd56(&dest);
 
-	dsp_core.registers[DSP_REG_A2] = dest[0];
-	dsp_core.registers[DSP_REG_A1] = dest[1];
-	dsp_core.registers[DSP_REG_A0] = dest[2];
+	dsp_write_acc56(DSP_REG_A, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 	dsp_core.registers[DSP_REG_SR] |= newsr & 0xfe;
@@ -6704,23 +6284,19 @@ static void dsp_macr_m_x1_x0_a(void)
 
 static void dsp_macr_p_x1_x0_b(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_X1], dsp_core.registers[DSP_REG_X0], source, SIGN_PLUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_X1], dsp_core.registers[DSP_REG_X0], SIGN_PLUS);
 
-	dest[0] = dsp_core.registers[DSP_REG_B2];
-	dest[1] = dsp_core.registers[DSP_REG_B1];
-	dest[2] = dsp_core.registers[DSP_REG_B0];
-	newsr = dsp_add56(source, dest);
+	dest = dsp_read_acc56(DSP_REG_B);
+	newsr = dsp_add56(source, &dest);
 
-	dsp_rnd56(dest);
+	dsp_rnd56(&dest);
 
-	dsp_core.registers[DSP_REG_B2] = dest[0];
-	dsp_core.registers[DSP_REG_B1] = dest[1];
-	dsp_core.registers[DSP_REG_B0] = dest[2];
+	dsp_write_acc56(DSP_REG_B, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 	dsp_core.registers[DSP_REG_SR] |= newsr & 0xfe;
@@ -6728,23 +6304,19 @@ static void dsp_macr_p_x1_x0_b(void)
 
 static void dsp_macr_m_x1_x0_b(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_X1], dsp_core.registers[DSP_REG_X0], source, SIGN_MINUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_X1], dsp_core.registers[DSP_REG_X0], SIGN_MINUS);
 
-	dest[0] = dsp_core.registers[DSP_REG_B2];
-	dest[1] = dsp_core.registers[DSP_REG_B1];
-	dest[2] = dsp_core.registers[DSP_REG_B0];
-	newsr = dsp_add56(source, dest);
+	dest = dsp_read_acc56(DSP_REG_B);
+	newsr = dsp_add56(source, &dest);
 
-	dsp_rnd56(dest);
+	dsp_rnd56(&dest);
 
-	dsp_core.registers[DSP_REG_B2] = dest[0];
-	dsp_core.registers[DSP_REG_B1] = dest[1];
-	dsp_core.registers[DSP_REG_B0] = dest[2];
+	dsp_write_acc56(DSP_REG_B, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 	dsp_core.registers[DSP_REG_SR] |= newsr & 0xfe;
@@ -6752,23 +6324,19 @@ static void dsp_macr_m_x1_x0_b(void)
 
 static void dsp_macr_p_y1_y0_a(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_Y1], dsp_core.registers[DSP_REG_Y0], source, SIGN_PLUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_Y1], dsp_core.registers[DSP_REG_Y0], SIGN_PLUS);
 
-	dest[0] = dsp_core.registers[DSP_REG_A2];
-	dest[1] = dsp_core.registers[DSP_REG_A1];
-	dest[2] = dsp_core.registers[DSP_REG_A0];
-	newsr = dsp_add56(source, dest);
+	dest = dsp_read_acc56(DSP_REG_A);
+	newsr = dsp_add56(source, &dest);
 
-	dsp_rnd56(dest);
+	dsp_rnd56(&dest);
 
-	dsp_core.registers[DSP_REG_A2] = dest[0];
-	dsp_core.registers[DSP_REG_A1] = dest[1];
-	dsp_core.registers[DSP_REG_A0] = dest[2];
+	dsp_write_acc56(DSP_REG_A, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 	dsp_core.registers[DSP_REG_SR] |= newsr & 0xfe;
@@ -6776,23 +6344,19 @@ static void dsp_macr_p_y1_y0_a(void)
 
 static void dsp_macr_m_y1_y0_a(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_Y1], dsp_core.registers[DSP_REG_Y0], source, SIGN_MINUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_Y1], dsp_core.registers[DSP_REG_Y0], SIGN_MINUS);
 
-	dest[0] = dsp_core.registers[DSP_REG_A2];
-	dest[1] = dsp_core.registers[DSP_REG_A1];
-	dest[2] = dsp_core.registers[DSP_REG_A0];
-	newsr = dsp_add56(source, dest);
+	dest = dsp_read_acc56(DSP_REG_A);
+	newsr = dsp_add56(source, &dest);
 
-	dsp_rnd56(dest);
+	dsp_rnd56(&dest);
 
-	dsp_core.registers[DSP_REG_A2] = dest[0];
-	dsp_core.registers[DSP_REG_A1] = dest[1];
-	dsp_core.registers[DSP_REG_A0] = dest[2];
+	dsp_write_acc56(DSP_REG_A, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 	dsp_core.registers[DSP_REG_SR] |= newsr & 0xfe;
@@ -6800,23 +6364,19 @@ static void dsp_macr_m_y1_y0_a(void)
 
 static void dsp_macr_p_y1_y0_b(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_Y1], dsp_core.registers[DSP_REG_Y0], source, SIGN_PLUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_Y1], dsp_core.registers[DSP_REG_Y0], SIGN_PLUS);
 
-	dest[0] = dsp_core.registers[DSP_REG_B2];
-	dest[1] = dsp_core.registers[DSP_REG_B1];
-	dest[2] = dsp_core.registers[DSP_REG_B0];
-	newsr = dsp_add56(source, dest);
+	dest = dsp_read_acc56(DSP_REG_B);
+	newsr = dsp_add56(source, &dest);
 
-	dsp_rnd56(dest);
+	dsp_rnd56(&dest);
 
-	dsp_core.registers[DSP_REG_B2] = dest[0];
-	dsp_core.registers[DSP_REG_B1] = dest[1];
-	dsp_core.registers[DSP_REG_B0] = dest[2];
+	dsp_write_acc56(DSP_REG_B, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 	dsp_core.registers[DSP_REG_SR] |= newsr & 0xfe;
@@ -6824,23 +6384,19 @@ static void dsp_macr_p_y1_y0_b(void)
 
 static void dsp_macr_m_y1_y0_b(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_Y1], dsp_core.registers[DSP_REG_Y0], source, SIGN_MINUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_Y1], dsp_core.registers[DSP_REG_Y0], SIGN_MINUS);
 
-	dest[0] = dsp_core.registers[DSP_REG_B2];
-	dest[1] = dsp_core.registers[DSP_REG_B1];
-	dest[2] = dsp_core.registers[DSP_REG_B0];
-	newsr = dsp_add56(source, dest);
+	dest = dsp_read_acc56(DSP_REG_B);
+	newsr = dsp_add56(source, &dest);
 
-	dsp_rnd56(dest);
+	dsp_rnd56(&dest);
 
-	dsp_core.registers[DSP_REG_B2] = dest[0];
-	dsp_core.registers[DSP_REG_B1] = dest[1];
-	dsp_core.registers[DSP_REG_B0] = dest[2];
+	dsp_write_acc56(DSP_REG_B, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 	dsp_core.registers[DSP_REG_SR] |= newsr & 0xfe;
@@ -6848,23 +6404,19 @@ static void dsp_macr_m_y1_y0_b(void)
 
 static void dsp_macr_p_x0_y1_a(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_X0], dsp_core.registers[DSP_REG_Y1], source, SIGN_PLUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_X0], dsp_core.registers[DSP_REG_Y1], SIGN_PLUS);
 
-	dest[0] = dsp_core.registers[DSP_REG_A2];
-	dest[1] = dsp_core.registers[DSP_REG_A1];
-	dest[2] = dsp_core.registers[DSP_REG_A0];
-	newsr = dsp_add56(source, dest);
+	dest = dsp_read_acc56(DSP_REG_A);
+	newsr = dsp_add56(source, &dest);
 
-	dsp_rnd56(dest);
+	dsp_rnd56(&dest);
 
-	dsp_core.registers[DSP_REG_A2] = dest[0];
-	dsp_core.registers[DSP_REG_A1] = dest[1];
-	dsp_core.registers[DSP_REG_A0] = dest[2];
+	dsp_write_acc56(DSP_REG_A, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 	dsp_core.registers[DSP_REG_SR] |= newsr & 0xfe;
@@ -6872,23 +6424,19 @@ static void dsp_macr_p_x0_y1_a(void)
 
 static void dsp_macr_m_x0_y1_a(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_X0], dsp_core.registers[DSP_REG_Y1], source, SIGN_MINUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_X0], dsp_core.registers[DSP_REG_Y1], SIGN_MINUS);
 
-	dest[0] = dsp_core.registers[DSP_REG_A2];
-	dest[1] = dsp_core.registers[DSP_REG_A1];
-	dest[2] = dsp_core.registers[DSP_REG_A0];
-	newsr = dsp_add56(source, dest);
+	dest = dsp_read_acc56(DSP_REG_A);
+	newsr = dsp_add56(source, &dest);
 
-	dsp_rnd56(dest);
+	dsp_rnd56(&dest);
 
-	dsp_core.registers[DSP_REG_A2] = dest[0];
-	dsp_core.registers[DSP_REG_A1] = dest[1];
-	dsp_core.registers[DSP_REG_A0] = dest[2];
+	dsp_write_acc56(DSP_REG_A, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 	dsp_core.registers[DSP_REG_SR] |= newsr & 0xfe;
@@ -6896,23 +6444,19 @@ static void dsp_macr_m_x0_y1_a(void)
 
 static void dsp_macr_p_x0_y1_b(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_X0], dsp_core.registers[DSP_REG_Y1], source, SIGN_PLUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_X0], dsp_core.registers[DSP_REG_Y1], SIGN_PLUS);
 
-	dest[0] = dsp_core.registers[DSP_REG_B2];
-	dest[1] = dsp_core.registers[DSP_REG_B1];
-	dest[2] = dsp_core.registers[DSP_REG_B0];
-	newsr = dsp_add56(source, dest);
+	dest = dsp_read_acc56(DSP_REG_B);
+	newsr = dsp_add56(source, &dest);
 
-	dsp_rnd56(dest);
+	dsp_rnd56(&dest);
 
-	dsp_core.registers[DSP_REG_B2] = dest[0];
-	dsp_core.registers[DSP_REG_B1] = dest[1];
-	dsp_core.registers[DSP_REG_B0] = dest[2];
+	dsp_write_acc56(DSP_REG_B, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 	dsp_core.registers[DSP_REG_SR] |= newsr & 0xfe;
@@ -6920,23 +6464,19 @@ static void dsp_macr_p_x0_y1_b(void)
 
 static void dsp_macr_m_x0_y1_b(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_X0], dsp_core.registers[DSP_REG_Y1], source, SIGN_MINUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_X0], dsp_core.registers[DSP_REG_Y1], SIGN_MINUS);
 
-	dest[0] = dsp_core.registers[DSP_REG_B2];
-	dest[1] = dsp_core.registers[DSP_REG_B1];
-	dest[2] = dsp_core.registers[DSP_REG_B0];
-	newsr = dsp_add56(source, dest);
+	dest = dsp_read_acc56(DSP_REG_B);
+	newsr = dsp_add56(source, &dest);
 
-	dsp_rnd56(dest);
+	dsp_rnd56(&dest);
 
-	dsp_core.registers[DSP_REG_B2] = dest[0];
-	dsp_core.registers[DSP_REG_B1] = dest[1];
-	dsp_core.registers[DSP_REG_B0] = dest[2];
+	dsp_write_acc56(DSP_REG_B, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 	dsp_core.registers[DSP_REG_SR] |= newsr & 0xfe;
@@ -6944,23 +6484,19 @@ static void dsp_macr_m_x0_y1_b(void)
 
 static void dsp_macr_p_y0_x0_a(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_Y0], dsp_core.registers[DSP_REG_X0], source, SIGN_PLUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_Y0], dsp_core.registers[DSP_REG_X0], SIGN_PLUS);
 
-	dest[0] = dsp_core.registers[DSP_REG_A2];
-	dest[1] = dsp_core.registers[DSP_REG_A1];
-	dest[2] = dsp_core.registers[DSP_REG_A0];
-	newsr = dsp_add56(source, dest);
+	dest = dsp_read_acc56(DSP_REG_A);
+	newsr = dsp_add56(source, &dest);
 
-	dsp_rnd56(dest);
+	dsp_rnd56(&dest);
 
-	dsp_core.registers[DSP_REG_A2] = dest[0];
-	dsp_core.registers[DSP_REG_A1] = dest[1];
-	dsp_core.registers[DSP_REG_A0] = dest[2];
+	dsp_write_acc56(DSP_REG_A, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 	dsp_core.registers[DSP_REG_SR] |= newsr & 0xfe;
@@ -6968,23 +6504,19 @@ static void dsp_macr_p_y0_x0_a(void)
 
 static void dsp_macr_m_y0_x0_a(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_Y0], dsp_core.registers[DSP_REG_X0], source, SIGN_MINUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_Y0], dsp_core.registers[DSP_REG_X0], SIGN_MINUS);
 
-	dest[0] = dsp_core.registers[DSP_REG_A2];
-	dest[1] = dsp_core.registers[DSP_REG_A1];
-	dest[2] = dsp_core.registers[DSP_REG_A0];
-	newsr = dsp_add56(source, dest);
+	dest = dsp_read_acc56(DSP_REG_A);
+	newsr = dsp_add56(source, &dest);
 
-	dsp_rnd56(dest);
+	dsp_rnd56(&dest);
 
-	dsp_core.registers[DSP_REG_A2] = dest[0];
-	dsp_core.registers[DSP_REG_A1] = dest[1];
-	dsp_core.registers[DSP_REG_A0] = dest[2];
+	dsp_write_acc56(DSP_REG_A, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 	dsp_core.registers[DSP_REG_SR] |= newsr & 0xfe;
@@ -6992,23 +6524,19 @@ static void dsp_macr_m_y0_x0_a(void)
 
 static void dsp_macr_p_y0_x0_b(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_Y0], dsp_core.registers[DSP_REG_X0], source, SIGN_PLUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_Y0], dsp_core.registers[DSP_REG_X0], SIGN_PLUS);
 
-	dest[0] = dsp_core.registers[DSP_REG_B2];
-	dest[1] = dsp_core.registers[DSP_REG_B1];
-	dest[2] = dsp_core.registers[DSP_REG_B0];
-	newsr = dsp_add56(source, dest);
+	dest = dsp_read_acc56(DSP_REG_B);
+	newsr = dsp_add56(source, &dest);
 
-	dsp_rnd56(dest);
+	dsp_rnd56(&dest);
 
-	dsp_core.registers[DSP_REG_B2] = dest[0];
-	dsp_core.registers[DSP_REG_B1] = dest[1];
-	dsp_core.registers[DSP_REG_B0] = dest[2];
+	dsp_write_acc56(DSP_REG_B, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 	dsp_core.registers[DSP_REG_SR] |= newsr & 0xfe;
@@ -7016,23 +6544,19 @@ static void dsp_macr_p_y0_x0_b(void)
 
 static void dsp_macr_m_y0_x0_b(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_Y0], dsp_core.registers[DSP_REG_X0], source, SIGN_MINUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_Y0], dsp_core.registers[DSP_REG_X0], SIGN_MINUS);
 
-	dest[0] = dsp_core.registers[DSP_REG_B2];
-	dest[1] = dsp_core.registers[DSP_REG_B1];
-	dest[2] = dsp_core.registers[DSP_REG_B0];
-	newsr = dsp_add56(source, dest);
+	dest = dsp_read_acc56(DSP_REG_B);
+	newsr = dsp_add56(source, &dest);
 
-	dsp_rnd56(dest);
+	dsp_rnd56(&dest);
 
-	dsp_core.registers[DSP_REG_B2] = dest[0];
-	dsp_core.registers[DSP_REG_B1] = dest[1];
-	dsp_core.registers[DSP_REG_B0] = dest[2];
+	dsp_write_acc56(DSP_REG_B, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 	dsp_core.registers[DSP_REG_SR] |= newsr & 0xfe;
@@ -7040,23 +6564,19 @@ static void dsp_macr_m_y0_x0_b(void)
 
 static void dsp_macr_p_x1_y0_a(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_X1], dsp_core.registers[DSP_REG_Y0], source, SIGN_PLUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_X1], dsp_core.registers[DSP_REG_Y0], SIGN_PLUS);
 
-	dest[0] = dsp_core.registers[DSP_REG_A2];
-	dest[1] = dsp_core.registers[DSP_REG_A1];
-	dest[2] = dsp_core.registers[DSP_REG_A0];
-	newsr = dsp_add56(source, dest);
+	dest = dsp_read_acc56(DSP_REG_A);
+	newsr = dsp_add56(source, &dest);
 
-	dsp_rnd56(dest);
+	dsp_rnd56(&dest);
 
-	dsp_core.registers[DSP_REG_A2] = dest[0];
-	dsp_core.registers[DSP_REG_A1] = dest[1];
-	dsp_core.registers[DSP_REG_A0] = dest[2];
+	dsp_write_acc56(DSP_REG_A, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 	dsp_core.registers[DSP_REG_SR] |= newsr & 0xfe;
@@ -7064,23 +6584,19 @@ static void dsp_macr_p_x1_y0_a(void)
 
 static void dsp_macr_m_x1_y0_a(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_X1], dsp_core.registers[DSP_REG_Y0], source, SIGN_MINUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_X1], dsp_core.registers[DSP_REG_Y0], SIGN_MINUS);
 
-	dest[0] = dsp_core.registers[DSP_REG_A2];
-	dest[1] = dsp_core.registers[DSP_REG_A1];
-	dest[2] = dsp_core.registers[DSP_REG_A0];
-	newsr = dsp_add56(source, dest);
+	dest = dsp_read_acc56(DSP_REG_A);
+	newsr = dsp_add56(source, &dest);
 
-	dsp_rnd56(dest);
+	dsp_rnd56(&dest);
 
-	dsp_core.registers[DSP_REG_A2] = dest[0];
-	dsp_core.registers[DSP_REG_A1] = dest[1];
-	dsp_core.registers[DSP_REG_A0] = dest[2];
+	dsp_write_acc56(DSP_REG_A, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 	dsp_core.registers[DSP_REG_SR] |= newsr & 0xfe;
@@ -7088,23 +6604,19 @@ static void dsp_macr_m_x1_y0_a(void)
 
 static void dsp_macr_p_x1_y0_b(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_X1], dsp_core.registers[DSP_REG_Y0], source, SIGN_PLUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_X1], dsp_core.registers[DSP_REG_Y0], SIGN_PLUS);
 
-	dest[0] = dsp_core.registers[DSP_REG_B2];
-	dest[1] = dsp_core.registers[DSP_REG_B1];
-	dest[2] = dsp_core.registers[DSP_REG_B0];
-	newsr = dsp_add56(source, dest);
+	dest = dsp_read_acc56(DSP_REG_B);
+	newsr = dsp_add56(source, &dest);
 
-	dsp_rnd56(dest);
+	dsp_rnd56(&dest);
 
-	dsp_core.registers[DSP_REG_B2] = dest[0];
-	dsp_core.registers[DSP_REG_B1] = dest[1];
-	dsp_core.registers[DSP_REG_B0] = dest[2];
+	dsp_write_acc56(DSP_REG_B, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 	dsp_core.registers[DSP_REG_SR] |= newsr & 0xfe;
@@ -7112,23 +6624,19 @@ static void dsp_macr_p_x1_y0_b(void)
 
 static void dsp_macr_m_x1_y0_b(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_X1], dsp_core.registers[DSP_REG_Y0], source, SIGN_MINUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_X1], dsp_core.registers[DSP_REG_Y0], SIGN_MINUS);
 
-	dest[0] = dsp_core.registers[DSP_REG_B2];
-	dest[1] = dsp_core.registers[DSP_REG_B1];
-	dest[2] = dsp_core.registers[DSP_REG_B0];
-	newsr = dsp_add56(source, dest);
+	dest = dsp_read_acc56(DSP_REG_B);
+	newsr = dsp_add56(source, &dest);
 
-	dsp_rnd56(dest);
+	dsp_rnd56(&dest);
 
-	dsp_core.registers[DSP_REG_B2] = dest[0];
-	dsp_core.registers[DSP_REG_B1] = dest[1];
-	dsp_core.registers[DSP_REG_B0] = dest[2];
+	dsp_write_acc56(DSP_REG_B, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 	dsp_core.registers[DSP_REG_SR] |= newsr & 0xfe;
@@ -7136,23 +6644,19 @@ static void dsp_macr_m_x1_y0_b(void)
 
 static void dsp_macr_p_y1_x1_a(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_Y1], dsp_core.registers[DSP_REG_X1], source, SIGN_PLUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_Y1], dsp_core.registers[DSP_REG_X1], SIGN_PLUS);
 
-	dest[0] = dsp_core.registers[DSP_REG_A2];
-	dest[1] = dsp_core.registers[DSP_REG_A1];
-	dest[2] = dsp_core.registers[DSP_REG_A0];
-	newsr = dsp_add56(source, dest);
+	dest = dsp_read_acc56(DSP_REG_A);
+	newsr = dsp_add56(source, &dest);
 
-	dsp_rnd56(dest);
+	dsp_rnd56(&dest);
 
-	dsp_core.registers[DSP_REG_A2] = dest[0];
-	dsp_core.registers[DSP_REG_A1] = dest[1];
-	dsp_core.registers[DSP_REG_A0] = dest[2];
+	dsp_write_acc56(DSP_REG_A, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 	dsp_core.registers[DSP_REG_SR] |= newsr & 0xfe;
@@ -7160,23 +6664,19 @@ static void dsp_macr_p_y1_x1_a(void)
 
 static void dsp_macr_m_y1_x1_a(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_Y1], dsp_core.registers[DSP_REG_X1], source, SIGN_MINUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_Y1], dsp_core.registers[DSP_REG_X1], SIGN_MINUS);
 
-	dest[0] = dsp_core.registers[DSP_REG_A2];
-	dest[1] = dsp_core.registers[DSP_REG_A1];
-	dest[2] = dsp_core.registers[DSP_REG_A0];
-	newsr = dsp_add56(source, dest);
+	dest = dsp_read_acc56(DSP_REG_A);
+	newsr = dsp_add56(source, &dest);
 
-	dsp_rnd56(dest);
+	dsp_rnd56(&dest);
 
-	dsp_core.registers[DSP_REG_A2] = dest[0];
-	dsp_core.registers[DSP_REG_A1] = dest[1];
-	dsp_core.registers[DSP_REG_A0] = dest[2];
+	dsp_write_acc56(DSP_REG_A, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 	dsp_core.registers[DSP_REG_SR] |= newsr & 0xfe;
@@ -7184,23 +6684,19 @@ static void dsp_macr_m_y1_x1_a(void)
 
 static void dsp_macr_p_y1_x1_b(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_Y1], dsp_core.registers[DSP_REG_X1], source, SIGN_PLUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_Y1], dsp_core.registers[DSP_REG_X1], SIGN_PLUS);
 
-	dest[0] = dsp_core.registers[DSP_REG_B2];
-	dest[1] = dsp_core.registers[DSP_REG_B1];
-	dest[2] = dsp_core.registers[DSP_REG_B0];
-	newsr = dsp_add56(source, dest);
+	dest = dsp_read_acc56(DSP_REG_B);
+	newsr = dsp_add56(source, &dest);
 
-	dsp_rnd56(dest);
+	dsp_rnd56(&dest);
 
-	dsp_core.registers[DSP_REG_B2] = dest[0];
-	dsp_core.registers[DSP_REG_B1] = dest[1];
-	dsp_core.registers[DSP_REG_B0] = dest[2];
+	dsp_write_acc56(DSP_REG_B, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 	dsp_core.registers[DSP_REG_SR] |= newsr & 0xfe;
@@ -7208,23 +6704,19 @@ static void dsp_macr_p_y1_x1_b(void)
 
 static void dsp_macr_m_y1_x1_b(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_Y1], dsp_core.registers[DSP_REG_X1], source, SIGN_MINUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_Y1], dsp_core.registers[DSP_REG_X1], SIGN_MINUS);
 
-	dest[0] = dsp_core.registers[DSP_REG_B2];
-	dest[1] = dsp_core.registers[DSP_REG_B1];
-	dest[2] = dsp_core.registers[DSP_REG_B0];
-	newsr = dsp_add56(source, dest);
+	dest = dsp_read_acc56(DSP_REG_B);
+	newsr = dsp_add56(source, &dest);
 
-	dsp_rnd56(dest);
+	dsp_rnd56(&dest);
 
-	dsp_core.registers[DSP_REG_B2] = dest[0];
-	dsp_core.registers[DSP_REG_B1] = dest[1];
-	dsp_core.registers[DSP_REG_B0] = dest[2];
+	dsp_write_acc56(DSP_REG_B, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 	dsp_core.registers[DSP_REG_SR] |= newsr & 0xfe;
@@ -7239,980 +6731,846 @@ static void dsp_move(void)
 
 static void dsp_mpy_p_x0_x0_a(void)
 {
-	Uint32 source[3];
+	Uint64 source;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_X0], dsp_core.registers[DSP_REG_X0], source, SIGN_PLUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_X0], dsp_core.registers[DSP_REG_X0], SIGN_PLUS);
 
-	dsp_core.registers[DSP_REG_A2] = source[0];
-	dsp_core.registers[DSP_REG_A1] = source[1];
-	dsp_core.registers[DSP_REG_A0] = source[2];
+	dsp_write_acc56(DSP_REG_A, source);
 
-	dsp_ccr_update_e_u_n_z(source[0], source[1], source[2]);
+	dsp_ccr_update_e_u_n_z(source);
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 }
 
 static void dsp_mpy_m_x0_x0_a(void)
 {
-	Uint32 source[3];
+	Uint64 source;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_X0], dsp_core.registers[DSP_REG_X0], source, SIGN_MINUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_X0], dsp_core.registers[DSP_REG_X0], SIGN_MINUS);
 
-	dsp_core.registers[DSP_REG_A2] = source[0];
-	dsp_core.registers[DSP_REG_A1] = source[1];
-	dsp_core.registers[DSP_REG_A0] = source[2];
+	dsp_write_acc56(DSP_REG_A, source);
 
-	dsp_ccr_update_e_u_n_z(source[0], source[1], source[2]);
+	dsp_ccr_update_e_u_n_z(source);
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 }
 
 static void dsp_mpy_p_x0_x0_b(void)
 {
-	Uint32 source[3];
+	Uint64 source;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_X0], dsp_core.registers[DSP_REG_X0], source, SIGN_PLUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_X0], dsp_core.registers[DSP_REG_X0], SIGN_PLUS);
 
-	dsp_core.registers[DSP_REG_B2] = source[0];
-	dsp_core.registers[DSP_REG_B1] = source[1];
-	dsp_core.registers[DSP_REG_B0] = source[2];
+	dsp_write_acc56(DSP_REG_B, source);
 
-	dsp_ccr_update_e_u_n_z(source[0], source[1], source[2]);
+	dsp_ccr_update_e_u_n_z(source);
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 }
 
 static void dsp_mpy_m_x0_x0_b(void)
 {
-	Uint32 source[3];
+	Uint64 source;
 
 
-	dsp_mul56(dsp_core.registers[DSP_REG_X0], dsp_core.registers[DSP_REG_X0], source, SIGN_MINUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_X0], dsp_core.registers[DSP_REG_X0], SIGN_MINUS);
 
-	dsp_core.registers[DSP_REG_B2] = source[0];
-	dsp_core.registers[DSP_REG_B1] = source[1];
-	dsp_core.registers[DSP_REG_B0] = source[2];
+	dsp_write_acc56(DSP_REG_B, source);
 
-	dsp_ccr_update_e_u_n_z(source[0], source[1], source[2]);
+	dsp_ccr_update_e_u_n_z(source);
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 }
 
 static void dsp_mpy_p_y0_y0_a(void)
 {
-	Uint32 source[3];
+	Uint64 source;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_Y0], dsp_core.registers[DSP_REG_Y0], source, SIGN_PLUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_Y0], dsp_core.registers[DSP_REG_Y0], SIGN_PLUS);
 
-	dsp_core.registers[DSP_REG_A2] = source[0];
-	dsp_core.registers[DSP_REG_A1] = source[1];
-	dsp_core.registers[DSP_REG_A0] = source[2];
+	dsp_write_acc56(DSP_REG_A, source);
 
-	dsp_ccr_update_e_u_n_z(source[0], source[1], source[2]);
+	dsp_ccr_update_e_u_n_z(source);
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 }
 
 static void dsp_mpy_m_y0_y0_a(void)
 {
-	Uint32 source[3];
+	Uint64 source;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_Y0], dsp_core.registers[DSP_REG_Y0], source, SIGN_MINUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_Y0], dsp_core.registers[DSP_REG_Y0], SIGN_MINUS);
 
-	dsp_core.registers[DSP_REG_A2] = source[0];
-	dsp_core.registers[DSP_REG_A1] = source[1];
-	dsp_core.registers[DSP_REG_A0] = source[2];
+	dsp_write_acc56(DSP_REG_A, source);
 
-	dsp_ccr_update_e_u_n_z(source[0], source[1], source[2]);
+	dsp_ccr_update_e_u_n_z(source);
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 }
 
 static void dsp_mpy_p_y0_y0_b(void)
 {
-	Uint32 source[3];
+	Uint64 source;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_Y0], dsp_core.registers[DSP_REG_Y0], source, SIGN_PLUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_Y0], dsp_core.registers[DSP_REG_Y0], SIGN_PLUS);
 
-	dsp_core.registers[DSP_REG_B2] = source[0];
-	dsp_core.registers[DSP_REG_B1] = source[1];
-	dsp_core.registers[DSP_REG_B0] = source[2];
+	dsp_write_acc56(DSP_REG_B, source);
 
-	dsp_ccr_update_e_u_n_z(source[0], source[1], source[2]);
+	dsp_ccr_update_e_u_n_z(source);
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 }
 
 static void dsp_mpy_m_y0_y0_b(void)
 {
-	Uint32 source[3];
+	Uint64 source;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_Y0], dsp_core.registers[DSP_REG_Y0], source, SIGN_MINUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_Y0], dsp_core.registers[DSP_REG_Y0], SIGN_MINUS);
 
-	dsp_core.registers[DSP_REG_B2] = source[0];
-	dsp_core.registers[DSP_REG_B1] = source[1];
-	dsp_core.registers[DSP_REG_B0] = source[2];
+	dsp_write_acc56(DSP_REG_B, source);
 
-	dsp_ccr_update_e_u_n_z(source[0], source[1], source[2]);
+	dsp_ccr_update_e_u_n_z(source);
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 }
 
 static void dsp_mpy_p_x1_x0_a(void)
 {
-	Uint32 source[3];
+	Uint64 source;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_X1], dsp_core.registers[DSP_REG_X0], source, SIGN_PLUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_X1], dsp_core.registers[DSP_REG_X0], SIGN_PLUS);
 
-	dsp_core.registers[DSP_REG_A2] = source[0];
-	dsp_core.registers[DSP_REG_A1] = source[1];
-	dsp_core.registers[DSP_REG_A0] = source[2];
+	dsp_write_acc56(DSP_REG_A, source);
 
-	dsp_ccr_update_e_u_n_z(source[0], source[1], source[2]);
+	dsp_ccr_update_e_u_n_z(source);
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 }
 
 static void dsp_mpy_m_x1_x0_a(void)
 {
-	Uint32 source[3];
+	Uint64 source;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_X1], dsp_core.registers[DSP_REG_X0], source, SIGN_MINUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_X1], dsp_core.registers[DSP_REG_X0], SIGN_MINUS);
 
-	dsp_core.registers[DSP_REG_A2] = source[0];
-	dsp_core.registers[DSP_REG_A1] = source[1];
-	dsp_core.registers[DSP_REG_A0] = source[2];
+	dsp_write_acc56(DSP_REG_A, source);
 
-	dsp_ccr_update_e_u_n_z(source[0], source[1], source[2]);
+	dsp_ccr_update_e_u_n_z(source);
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 }
 
 static void dsp_mpy_p_x1_x0_b(void)
 {
-	Uint32 source[3];
+	Uint64 source;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_X1], dsp_core.registers[DSP_REG_X0], source, SIGN_PLUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_X1], dsp_core.registers[DSP_REG_X0], SIGN_PLUS);
 
-	dsp_core.registers[DSP_REG_B2] = source[0];
-	dsp_core.registers[DSP_REG_B1] = source[1];
-	dsp_core.registers[DSP_REG_B0] = source[2];
+	dsp_write_acc56(DSP_REG_B, source);
 
-	dsp_ccr_update_e_u_n_z(source[0], source[1], source[2]);
+	dsp_ccr_update_e_u_n_z(source);
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 }
 
 static void dsp_mpy_m_x1_x0_b(void)
 {
-	Uint32 source[3];
+	Uint64 source;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_X1], dsp_core.registers[DSP_REG_X0], source, SIGN_MINUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_X1], dsp_core.registers[DSP_REG_X0], SIGN_MINUS);
 
-	dsp_core.registers[DSP_REG_B2] = source[0];
-	dsp_core.registers[DSP_REG_B1] = source[1];
-	dsp_core.registers[DSP_REG_B0] = source[2];
+	dsp_write_acc56(DSP_REG_B, source);
 
-	dsp_ccr_update_e_u_n_z(source[0], source[1], source[2]);
+	dsp_ccr_update_e_u_n_z(source);
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 }
 
 static void dsp_mpy_p_y1_y0_a(void)
 {
-	Uint32 source[3];
+	Uint64 source;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_Y1], dsp_core.registers[DSP_REG_Y0], source, SIGN_PLUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_Y1], dsp_core.registers[DSP_REG_Y0], SIGN_PLUS);
 
-	dsp_core.registers[DSP_REG_A2] = source[0];
-	dsp_core.registers[DSP_REG_A1] = source[1];
-	dsp_core.registers[DSP_REG_A0] = source[2];
+	dsp_write_acc56(DSP_REG_A, source);
 
-	dsp_ccr_update_e_u_n_z(source[0], source[1], source[2]);
+	dsp_ccr_update_e_u_n_z(source);
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 }
 
 static void dsp_mpy_m_y1_y0_a(void)
 {
-	Uint32 source[3];
+	Uint64 source;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_Y1], dsp_core.registers[DSP_REG_Y0], source, SIGN_MINUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_Y1], dsp_core.registers[DSP_REG_Y0], SIGN_MINUS);
 
-	dsp_core.registers[DSP_REG_A2] = source[0];
-	dsp_core.registers[DSP_REG_A1] = source[1];
-	dsp_core.registers[DSP_REG_A0] = source[2];
+	dsp_write_acc56(DSP_REG_A, source);
 
-	dsp_ccr_update_e_u_n_z(source[0], source[1], source[2]);
+	dsp_ccr_update_e_u_n_z(source);
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 }
 
 static void dsp_mpy_p_y1_y0_b(void)
 {
-	Uint32 source[3];
+	Uint64 source;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_Y1], dsp_core.registers[DSP_REG_Y0], source, SIGN_PLUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_Y1], dsp_core.registers[DSP_REG_Y0], SIGN_PLUS);
 
-	dsp_core.registers[DSP_REG_B2] = source[0];
-	dsp_core.registers[DSP_REG_B1] = source[1];
-	dsp_core.registers[DSP_REG_B0] = source[2];
+	dsp_write_acc56(DSP_REG_B, source);
 
-	dsp_ccr_update_e_u_n_z(source[0], source[1], source[2]);
+	dsp_ccr_update_e_u_n_z(source);
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 }
 
 static void dsp_mpy_m_y1_y0_b(void)
 {
-	Uint32 source[3];
+	Uint64 source;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_Y1], dsp_core.registers[DSP_REG_Y0], source, SIGN_MINUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_Y1], dsp_core.registers[DSP_REG_Y0], SIGN_MINUS);
 
-	dsp_core.registers[DSP_REG_B2] = source[0];
-	dsp_core.registers[DSP_REG_B1] = source[1];
-	dsp_core.registers[DSP_REG_B0] = source[2];
+	dsp_write_acc56(DSP_REG_B, source);
 
-	dsp_ccr_update_e_u_n_z(source[0], source[1], source[2]);
+	dsp_ccr_update_e_u_n_z(source);
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 }
 
 static void dsp_mpy_p_x0_y1_a(void)
 {
-	Uint32 source[3];
+	Uint64 source;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_X0], dsp_core.registers[DSP_REG_Y1], source, SIGN_PLUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_X0], dsp_core.registers[DSP_REG_Y1], SIGN_PLUS);
 
-	dsp_core.registers[DSP_REG_A2] = source[0];
-	dsp_core.registers[DSP_REG_A1] = source[1];
-	dsp_core.registers[DSP_REG_A0] = source[2];
+	dsp_write_acc56(DSP_REG_A, source);
 
-	dsp_ccr_update_e_u_n_z(source[0], source[1], source[2]);
+	dsp_ccr_update_e_u_n_z(source);
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 }
 
 static void dsp_mpy_m_x0_y1_a(void)
 {
-	Uint32 source[3];
+	Uint64 source;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_X0], dsp_core.registers[DSP_REG_Y1], source, SIGN_MINUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_X0], dsp_core.registers[DSP_REG_Y1], SIGN_MINUS);
 
-	dsp_core.registers[DSP_REG_A2] = source[0];
-	dsp_core.registers[DSP_REG_A1] = source[1];
-	dsp_core.registers[DSP_REG_A0] = source[2];
+	dsp_write_acc56(DSP_REG_A, source);
 
-	dsp_ccr_update_e_u_n_z(source[0], source[1], source[2]);
+	dsp_ccr_update_e_u_n_z(source);
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 }
 
 static void dsp_mpy_p_x0_y1_b(void)
 {
-	Uint32 source[3];
+	Uint64 source;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_X0], dsp_core.registers[DSP_REG_Y1], source, SIGN_PLUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_X0], dsp_core.registers[DSP_REG_Y1], SIGN_PLUS);
 
-	dsp_core.registers[DSP_REG_B2] = source[0];
-	dsp_core.registers[DSP_REG_B1] = source[1];
-	dsp_core.registers[DSP_REG_B0] = source[2];
+	dsp_write_acc56(DSP_REG_B, source);
 
-	dsp_ccr_update_e_u_n_z(source[0], source[1], source[2]);
+	dsp_ccr_update_e_u_n_z(source);
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 }
 
 static void dsp_mpy_m_x0_y1_b(void)
 {
-	Uint32 source[3];
+	Uint64 source;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_X0], dsp_core.registers[DSP_REG_Y1], source, SIGN_MINUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_X0], dsp_core.registers[DSP_REG_Y1], SIGN_MINUS);
 
-	dsp_core.registers[DSP_REG_B2] = source[0];
-	dsp_core.registers[DSP_REG_B1] = source[1];
-	dsp_core.registers[DSP_REG_B0] = source[2];
+	dsp_write_acc56(DSP_REG_B, source);
 
-	dsp_ccr_update_e_u_n_z(source[0], source[1], source[2]);
+	dsp_ccr_update_e_u_n_z(source);
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 }
 
 static void dsp_mpy_p_y0_x0_a(void)
 {
-	Uint32 source[3];
+	Uint64 source;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_Y0], dsp_core.registers[DSP_REG_X0], source, SIGN_PLUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_Y0], dsp_core.registers[DSP_REG_X0], SIGN_PLUS);
 
-	dsp_core.registers[DSP_REG_A2] = source[0];
-	dsp_core.registers[DSP_REG_A1] = source[1];
-	dsp_core.registers[DSP_REG_A0] = source[2];
+	dsp_write_acc56(DSP_REG_A, source);
 
-	dsp_ccr_update_e_u_n_z(source[0], source[1], source[2]);
+	dsp_ccr_update_e_u_n_z(source);
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 }
 
 static void dsp_mpy_m_y0_x0_a(void)
 {
-	Uint32 source[3];
+	Uint64 source;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_Y0], dsp_core.registers[DSP_REG_X0], source, SIGN_MINUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_Y0], dsp_core.registers[DSP_REG_X0], SIGN_MINUS);
 
-	dsp_core.registers[DSP_REG_A2] = source[0];
-	dsp_core.registers[DSP_REG_A1] = source[1];
-	dsp_core.registers[DSP_REG_A0] = source[2];
+	dsp_write_acc56(DSP_REG_A, source);
 
-	dsp_ccr_update_e_u_n_z(source[0], source[1], source[2]);
+	dsp_ccr_update_e_u_n_z(source);
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 }
 
 static void dsp_mpy_p_y0_x0_b(void)
 {
-	Uint32 source[3];
+	Uint64 source;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_Y0], dsp_core.registers[DSP_REG_X0], source, SIGN_PLUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_Y0], dsp_core.registers[DSP_REG_X0], SIGN_PLUS);
 
-	dsp_core.registers[DSP_REG_B2] = source[0];
-	dsp_core.registers[DSP_REG_B1] = source[1];
-	dsp_core.registers[DSP_REG_B0] = source[2];
+	dsp_write_acc56(DSP_REG_B, source);
 
-	dsp_ccr_update_e_u_n_z(source[0], source[1], source[2]);
+	dsp_ccr_update_e_u_n_z(source);
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 }
 
 static void dsp_mpy_m_y0_x0_b(void)
 {
-	Uint32 source[3];
+	Uint64 source;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_Y0], dsp_core.registers[DSP_REG_X0], source, SIGN_MINUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_Y0], dsp_core.registers[DSP_REG_X0], SIGN_MINUS);
 
-	dsp_core.registers[DSP_REG_B2] = source[0];
-	dsp_core.registers[DSP_REG_B1] = source[1];
-	dsp_core.registers[DSP_REG_B0] = source[2];
+	dsp_write_acc56(DSP_REG_B, source);
 
-	dsp_ccr_update_e_u_n_z(source[0], source[1], source[2]);
+	dsp_ccr_update_e_u_n_z(source);
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 }
 
 static void dsp_mpy_p_x1_y0_a(void)
 {
-	Uint32 source[3];
+	Uint64 source;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_X1], dsp_core.registers[DSP_REG_Y0], source, SIGN_PLUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_X1], dsp_core.registers[DSP_REG_Y0], SIGN_PLUS);
 
-	dsp_core.registers[DSP_REG_A2] = source[0];
-	dsp_core.registers[DSP_REG_A1] = source[1];
-	dsp_core.registers[DSP_REG_A0] = source[2];
+	dsp_write_acc56(DSP_REG_A, source);
 
-	dsp_ccr_update_e_u_n_z(source[0], source[1], source[2]);
+	dsp_ccr_update_e_u_n_z(source);
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 }
 
 static void dsp_mpy_m_x1_y0_a(void)
 {
-	Uint32 source[3];
+	Uint64 source;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_X1], dsp_core.registers[DSP_REG_Y0], source, SIGN_MINUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_X1], dsp_core.registers[DSP_REG_Y0], SIGN_MINUS);
 
-	dsp_core.registers[DSP_REG_A2] = source[0];
-	dsp_core.registers[DSP_REG_A1] = source[1];
-	dsp_core.registers[DSP_REG_A0] = source[2];
+	dsp_write_acc56(DSP_REG_A, source);
 
-	dsp_ccr_update_e_u_n_z(source[0], source[1], source[2]);
+	dsp_ccr_update_e_u_n_z(source);
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 }
 
 static void dsp_mpy_p_x1_y0_b(void)
 {
-	Uint32 source[3];
+	Uint64 source;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_X1], dsp_core.registers[DSP_REG_Y0], source, SIGN_PLUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_X1], dsp_core.registers[DSP_REG_Y0], SIGN_PLUS);
 
-	dsp_core.registers[DSP_REG_B2] = source[0];
-	dsp_core.registers[DSP_REG_B1] = source[1];
-	dsp_core.registers[DSP_REG_B0] = source[2];
+	dsp_write_acc56(DSP_REG_B, source);
 
-	dsp_ccr_update_e_u_n_z(source[0], source[1], source[2]);
+	dsp_ccr_update_e_u_n_z(source);
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 }
 
 static void dsp_mpy_m_x1_y0_b(void)
 {
-	Uint32 source[3];
+	Uint64 source;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_X1], dsp_core.registers[DSP_REG_Y0], source, SIGN_MINUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_X1], dsp_core.registers[DSP_REG_Y0], SIGN_MINUS);
 
-	dsp_core.registers[DSP_REG_B2] = source[0];
-	dsp_core.registers[DSP_REG_B1] = source[1];
-	dsp_core.registers[DSP_REG_B0] = source[2];
+	dsp_write_acc56(DSP_REG_B, source);
 
-	dsp_ccr_update_e_u_n_z(source[0], source[1], source[2]);
+	dsp_ccr_update_e_u_n_z(source);
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 }
 
 static void dsp_mpy_p_y1_x1_a(void)
 {
-	Uint32 source[3];
+	Uint64 source;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_Y1], dsp_core.registers[DSP_REG_X1], source, SIGN_PLUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_Y1], dsp_core.registers[DSP_REG_X1], SIGN_PLUS);
 
-	dsp_core.registers[DSP_REG_A2] = source[0];
-	dsp_core.registers[DSP_REG_A1] = source[1];
-	dsp_core.registers[DSP_REG_A0] = source[2];
+	dsp_write_acc56(DSP_REG_A, source);
 
-	dsp_ccr_update_e_u_n_z(source[0], source[1], source[2]);
+	dsp_ccr_update_e_u_n_z(source);
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 }
 
 static void dsp_mpy_m_y1_x1_a(void)
 {
-	Uint32 source[3];
+	Uint64 source;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_Y1], dsp_core.registers[DSP_REG_X1], source, SIGN_MINUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_Y1], dsp_core.registers[DSP_REG_X1], SIGN_MINUS);
 
-	dsp_core.registers[DSP_REG_A2] = source[0];
-	dsp_core.registers[DSP_REG_A1] = source[1];
-	dsp_core.registers[DSP_REG_A0] = source[2];
+	dsp_write_acc56(DSP_REG_A, source);
 
-	dsp_ccr_update_e_u_n_z(source[0], source[1], source[2]);
+	dsp_ccr_update_e_u_n_z(source);
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 }
 
 static void dsp_mpy_p_y1_x1_b(void)
 {
-	Uint32 source[3];
+	Uint64 source;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_Y1], dsp_core.registers[DSP_REG_X1], source, SIGN_PLUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_Y1], dsp_core.registers[DSP_REG_X1], SIGN_PLUS);
 
-	dsp_core.registers[DSP_REG_B2] = source[0];
-	dsp_core.registers[DSP_REG_B1] = source[1];
-	dsp_core.registers[DSP_REG_B0] = source[2];
+	dsp_write_acc56(DSP_REG_B, source);
 
-	dsp_ccr_update_e_u_n_z(source[0], source[1], source[2]);
+	dsp_ccr_update_e_u_n_z(source);
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 }
 
 static void dsp_mpy_m_y1_x1_b(void)
 {
-	Uint32 source[3];
+	Uint64 source;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_Y1], dsp_core.registers[DSP_REG_X1], source, SIGN_MINUS);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_Y1], dsp_core.registers[DSP_REG_X1], SIGN_MINUS);
 
-	dsp_core.registers[DSP_REG_B2] = source[0];
-	dsp_core.registers[DSP_REG_B1] = source[1];
-	dsp_core.registers[DSP_REG_B0] = source[2];
+	dsp_write_acc56(DSP_REG_B, source);
 
-	dsp_ccr_update_e_u_n_z(source[0], source[1], source[2]);
+	dsp_ccr_update_e_u_n_z(source);
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 }
 
 static void dsp_mpyr_p_x0_x0_a(void)
 {
-	Uint32 source[3];
+	Uint64 source;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_X0], dsp_core.registers[DSP_REG_X0], source, SIGN_PLUS);
-	dsp_rnd56(source);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_X0], dsp_core.registers[DSP_REG_X0], SIGN_PLUS);
+	dsp_rnd56(&source);
 
-	dsp_core.registers[DSP_REG_A2] = source[0];
-	dsp_core.registers[DSP_REG_A1] = source[1];
-	dsp_core.registers[DSP_REG_A0] = source[2];
+	dsp_write_acc56(DSP_REG_A, source);
 
-	dsp_ccr_update_e_u_n_z(source[0], source[1], source[2]);
+	dsp_ccr_update_e_u_n_z(source);
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 }
 
 static void dsp_mpyr_m_x0_x0_a(void)
 {
-	Uint32 source[3];
+	Uint64 source;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_X0], dsp_core.registers[DSP_REG_X0], source, SIGN_MINUS);
-	dsp_rnd56(source);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_X0], dsp_core.registers[DSP_REG_X0], SIGN_MINUS);
+	dsp_rnd56(&source);
 
-	dsp_core.registers[DSP_REG_A2] = source[0];
-	dsp_core.registers[DSP_REG_A1] = source[1];
-	dsp_core.registers[DSP_REG_A0] = source[2];
+	dsp_write_acc56(DSP_REG_A, source);
 
-	dsp_ccr_update_e_u_n_z(source[0], source[1], source[2]);
+	dsp_ccr_update_e_u_n_z(source);
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 }
 
 static void dsp_mpyr_p_x0_x0_b(void)
 {
-	Uint32 source[3];
+	Uint64 source;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_X0], dsp_core.registers[DSP_REG_X0], source, SIGN_PLUS);
-	dsp_rnd56(source);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_X0], dsp_core.registers[DSP_REG_X0], SIGN_PLUS);
+	dsp_rnd56(&source);
 
-	dsp_core.registers[DSP_REG_B2] = source[0];
-	dsp_core.registers[DSP_REG_B1] = source[1];
-	dsp_core.registers[DSP_REG_B0] = source[2];
+	dsp_write_acc56(DSP_REG_B, source);
 
-	dsp_ccr_update_e_u_n_z(source[0], source[1], source[2]);
+	dsp_ccr_update_e_u_n_z(source);
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 }
 
 static void dsp_mpyr_m_x0_x0_b(void)
 {
-	Uint32 source[3];
+	Uint64 source;
 
 
-	dsp_mul56(dsp_core.registers[DSP_REG_X0], dsp_core.registers[DSP_REG_X0], source, SIGN_MINUS);
-	dsp_rnd56(source);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_X0], dsp_core.registers[DSP_REG_X0], SIGN_MINUS);
+	dsp_rnd56(&source);
 
-	dsp_core.registers[DSP_REG_B2] = source[0];
-	dsp_core.registers[DSP_REG_B1] = source[1];
-	dsp_core.registers[DSP_REG_B0] = source[2];
+	dsp_write_acc56(DSP_REG_B, source);
 
-	dsp_ccr_update_e_u_n_z(source[0], source[1], source[2]);
+	dsp_ccr_update_e_u_n_z(source);
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 }
 
 static void dsp_mpyr_p_y0_y0_a(void)
 {
-	Uint32 source[3];
+	Uint64 source;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_Y0], dsp_core.registers[DSP_REG_Y0], source, SIGN_PLUS);
-	dsp_rnd56(source);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_Y0], dsp_core.registers[DSP_REG_Y0], SIGN_PLUS);
+	dsp_rnd56(&source);
 
-	dsp_core.registers[DSP_REG_A2] = source[0];
-	dsp_core.registers[DSP_REG_A1] = source[1];
-	dsp_core.registers[DSP_REG_A0] = source[2];
+	dsp_write_acc56(DSP_REG_A, source);
 
-	dsp_ccr_update_e_u_n_z(source[0], source[1], source[2]);
+	dsp_ccr_update_e_u_n_z(source);
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 }
 
 static void dsp_mpyr_m_y0_y0_a(void)
 {
-	Uint32 source[3];
+	Uint64 source;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_Y0], dsp_core.registers[DSP_REG_Y0], source, SIGN_MINUS);
-	dsp_rnd56(source);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_Y0], dsp_core.registers[DSP_REG_Y0], SIGN_MINUS);
+	dsp_rnd56(&source);
 
-	dsp_core.registers[DSP_REG_A2] = source[0];
-	dsp_core.registers[DSP_REG_A1] = source[1];
-	dsp_core.registers[DSP_REG_A0] = source[2];
+	dsp_write_acc56(DSP_REG_A, source);
 
-	dsp_ccr_update_e_u_n_z(source[0], source[1], source[2]);
+	dsp_ccr_update_e_u_n_z(source);
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 }
 
 static void dsp_mpyr_p_y0_y0_b(void)
 {
-	Uint32 source[3];
+	Uint64 source;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_Y0], dsp_core.registers[DSP_REG_Y0], source, SIGN_PLUS);
-	dsp_rnd56(source);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_Y0], dsp_core.registers[DSP_REG_Y0], SIGN_PLUS);
+	dsp_rnd56(&source);
 
-	dsp_core.registers[DSP_REG_B2] = source[0];
-	dsp_core.registers[DSP_REG_B1] = source[1];
-	dsp_core.registers[DSP_REG_B0] = source[2];
+	dsp_write_acc56(DSP_REG_B, source);
 
-	dsp_ccr_update_e_u_n_z(source[0], source[1], source[2]);
+	dsp_ccr_update_e_u_n_z(source);
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 }
 
 static void dsp_mpyr_m_y0_y0_b(void)
 {
-	Uint32 source[3];
+	Uint64 source;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_Y0], dsp_core.registers[DSP_REG_Y0], source, SIGN_MINUS);
-	dsp_rnd56(source);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_Y0], dsp_core.registers[DSP_REG_Y0], SIGN_MINUS);
+	dsp_rnd56(&source);
 
-	dsp_core.registers[DSP_REG_B2] = source[0];
-	dsp_core.registers[DSP_REG_B1] = source[1];
-	dsp_core.registers[DSP_REG_B0] = source[2];
+	dsp_write_acc56(DSP_REG_B, source);
 
-	dsp_ccr_update_e_u_n_z(source[0], source[1], source[2]);
+	dsp_ccr_update_e_u_n_z(source);
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 }
 
 static void dsp_mpyr_p_x1_x0_a(void)
 {
-	Uint32 source[3];
+	Uint64 source;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_X1], dsp_core.registers[DSP_REG_X0], source, SIGN_PLUS);
-	dsp_rnd56(source);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_X1], dsp_core.registers[DSP_REG_X0], SIGN_PLUS);
+	dsp_rnd56(&source);
 
-	dsp_core.registers[DSP_REG_A2] = source[0];
-	dsp_core.registers[DSP_REG_A1] = source[1];
-	dsp_core.registers[DSP_REG_A0] = source[2];
+	dsp_write_acc56(DSP_REG_A, source);
 
-	dsp_ccr_update_e_u_n_z(source[0], source[1], source[2]);
+	dsp_ccr_update_e_u_n_z(source);
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 }
 
 static void dsp_mpyr_m_x1_x0_a(void)
 {
-	Uint32 source[3];
+	Uint64 source;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_X1], dsp_core.registers[DSP_REG_X0], source, SIGN_MINUS);
-	dsp_rnd56(source);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_X1], dsp_core.registers[DSP_REG_X0], SIGN_MINUS);
+	dsp_rnd56(&source);
 
-	dsp_core.registers[DSP_REG_A2] = source[0];
-	dsp_core.registers[DSP_REG_A1] = source[1];
-	dsp_core.registers[DSP_REG_A0] = source[2];
+	dsp_write_acc56(DSP_REG_A, source);
 
-	dsp_ccr_update_e_u_n_z(source[0], source[1], source[2]);
+	dsp_ccr_update_e_u_n_z(source);
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 }
 
 static void dsp_mpyr_p_x1_x0_b(void)
 {
-	Uint32 source[3];
+	Uint64 source;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_X1], dsp_core.registers[DSP_REG_X0], source, SIGN_PLUS);
-	dsp_rnd56(source);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_X1], dsp_core.registers[DSP_REG_X0], SIGN_PLUS);
+	dsp_rnd56(&source);
 
-	dsp_core.registers[DSP_REG_B2] = source[0];
-	dsp_core.registers[DSP_REG_B1] = source[1];
-	dsp_core.registers[DSP_REG_B0] = source[2];
+	dsp_write_acc56(DSP_REG_B, source);
 
-	dsp_ccr_update_e_u_n_z(source[0], source[1], source[2]);
+	dsp_ccr_update_e_u_n_z(source);
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 }
 
 static void dsp_mpyr_m_x1_x0_b(void)
 {
-	Uint32 source[3];
+	Uint64 source;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_X1], dsp_core.registers[DSP_REG_X0], source, SIGN_MINUS);
-	dsp_rnd56(source);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_X1], dsp_core.registers[DSP_REG_X0], SIGN_MINUS);
+	dsp_rnd56(&source);
 
-	dsp_core.registers[DSP_REG_B2] = source[0];
-	dsp_core.registers[DSP_REG_B1] = source[1];
-	dsp_core.registers[DSP_REG_B0] = source[2];
+	dsp_write_acc56(DSP_REG_B, source);
 
-	dsp_ccr_update_e_u_n_z(source[0], source[1], source[2]);
+	dsp_ccr_update_e_u_n_z(source);
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 }
 
 static void dsp_mpyr_p_y1_y0_a(void)
 {
-	Uint32 source[3];
+	Uint64 source;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_Y1], dsp_core.registers[DSP_REG_Y0], source, SIGN_PLUS);
-	dsp_rnd56(source);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_Y1], dsp_core.registers[DSP_REG_Y0], SIGN_PLUS);
+	dsp_rnd56(&source);
 
-	dsp_core.registers[DSP_REG_A2] = source[0];
-	dsp_core.registers[DSP_REG_A1] = source[1];
-	dsp_core.registers[DSP_REG_A0] = source[2];
+	dsp_write_acc56(DSP_REG_A, source);
 
-	dsp_ccr_update_e_u_n_z(source[0], source[1], source[2]);
+	dsp_ccr_update_e_u_n_z(source);
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 }
 
 static void dsp_mpyr_m_y1_y0_a(void)
 {
-	Uint32 source[3];
+	Uint64 source;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_Y1], dsp_core.registers[DSP_REG_Y0], source, SIGN_MINUS);
-	dsp_rnd56(source);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_Y1], dsp_core.registers[DSP_REG_Y0], SIGN_MINUS);
+	dsp_rnd56(&source);
 
-	dsp_core.registers[DSP_REG_A2] = source[0];
-	dsp_core.registers[DSP_REG_A1] = source[1];
-	dsp_core.registers[DSP_REG_A0] = source[2];
+	dsp_write_acc56(DSP_REG_A, source);
 
-	dsp_ccr_update_e_u_n_z(source[0], source[1], source[2]);
+	dsp_ccr_update_e_u_n_z(source);
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 }
 
 static void dsp_mpyr_p_y1_y0_b(void)
 {
-	Uint32 source[3];
+	Uint64 source;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_Y1], dsp_core.registers[DSP_REG_Y0], source, SIGN_PLUS);
-	dsp_rnd56(source);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_Y1], dsp_core.registers[DSP_REG_Y0], SIGN_PLUS);
+	dsp_rnd56(&source);
 
-	dsp_core.registers[DSP_REG_B2] = source[0];
-	dsp_core.registers[DSP_REG_B1] = source[1];
-	dsp_core.registers[DSP_REG_B0] = source[2];
+	dsp_write_acc56(DSP_REG_B, source);
 
-	dsp_ccr_update_e_u_n_z(source[0], source[1], source[2]);
+	dsp_ccr_update_e_u_n_z(source);
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 }
 
 static void dsp_mpyr_m_y1_y0_b(void)
 {
-	Uint32 source[3];
+	Uint64 source;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_Y1], dsp_core.registers[DSP_REG_Y0], source, SIGN_MINUS);
-	dsp_rnd56(source);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_Y1], dsp_core.registers[DSP_REG_Y0], SIGN_MINUS);
+	dsp_rnd56(&source);
 
-	dsp_core.registers[DSP_REG_B2] = source[0];
-	dsp_core.registers[DSP_REG_B1] = source[1];
-	dsp_core.registers[DSP_REG_B0] = source[2];
+	dsp_write_acc56(DSP_REG_B, source);
 
-	dsp_ccr_update_e_u_n_z(source[0], source[1], source[2]);
+	dsp_ccr_update_e_u_n_z(source);
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 }
 
 static void dsp_mpyr_p_x0_y1_a(void)
 {
-	Uint32 source[3];
+	Uint64 source;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_X0], dsp_core.registers[DSP_REG_Y1], source, SIGN_PLUS);
-	dsp_rnd56(source);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_X0], dsp_core.registers[DSP_REG_Y1], SIGN_PLUS);
+	dsp_rnd56(&source);
 
-	dsp_core.registers[DSP_REG_A2] = source[0];
-	dsp_core.registers[DSP_REG_A1] = source[1];
-	dsp_core.registers[DSP_REG_A0] = source[2];
+	dsp_write_acc56(DSP_REG_A, source);
 
-	dsp_ccr_update_e_u_n_z(source[0], source[1], source[2]);
+	dsp_ccr_update_e_u_n_z(source);
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 }
 
 static void dsp_mpyr_m_x0_y1_a(void)
 {
-	Uint32 source[3];
+	Uint64 source;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_X0], dsp_core.registers[DSP_REG_Y1], source, SIGN_MINUS);
-	dsp_rnd56(source);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_X0], dsp_core.registers[DSP_REG_Y1], SIGN_MINUS);
+	dsp_rnd56(&source);
 
-	dsp_core.registers[DSP_REG_A2] = source[0];
-	dsp_core.registers[DSP_REG_A1] = source[1];
-	dsp_core.registers[DSP_REG_A0] = source[2];
+	dsp_write_acc56(DSP_REG_A, source);
 
-	dsp_ccr_update_e_u_n_z(source[0], source[1], source[2]);
+	dsp_ccr_update_e_u_n_z(source);
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 }
 
 static void dsp_mpyr_p_x0_y1_b(void)
 {
-	Uint32 source[3];
+	Uint64 source;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_X0], dsp_core.registers[DSP_REG_Y1], source, SIGN_PLUS);
-	dsp_rnd56(source);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_X0], dsp_core.registers[DSP_REG_Y1], SIGN_PLUS);
+	dsp_rnd56(&source);
 
-	dsp_core.registers[DSP_REG_B2] = source[0];
-	dsp_core.registers[DSP_REG_B1] = source[1];
-	dsp_core.registers[DSP_REG_B0] = source[2];
+	dsp_write_acc56(DSP_REG_B, source);
 
-	dsp_ccr_update_e_u_n_z(source[0], source[1], source[2]);
+	dsp_ccr_update_e_u_n_z(source);
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 }
 
 static void dsp_mpyr_m_x0_y1_b(void)
 {
-	Uint32 source[3];
+	Uint64 source;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_X0], dsp_core.registers[DSP_REG_Y1], source, SIGN_MINUS);
-	dsp_rnd56(source);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_X0], dsp_core.registers[DSP_REG_Y1], SIGN_MINUS);
+	dsp_rnd56(&source);
 
-	dsp_core.registers[DSP_REG_B2] = source[0];
-	dsp_core.registers[DSP_REG_B1] = source[1];
-	dsp_core.registers[DSP_REG_B0] = source[2];
+	dsp_write_acc56(DSP_REG_B, source);
 
-	dsp_ccr_update_e_u_n_z(source[0], source[1], source[2]);
+	dsp_ccr_update_e_u_n_z(source);
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 }
 
 static void dsp_mpyr_p_y0_x0_a(void)
 {
-	Uint32 source[3];
+	Uint64 source;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_Y0], dsp_core.registers[DSP_REG_X0], source, SIGN_PLUS);
-	dsp_rnd56(source);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_Y0], dsp_core.registers[DSP_REG_X0], SIGN_PLUS);
+	dsp_rnd56(&source);
 
-	dsp_core.registers[DSP_REG_A2] = source[0];
-	dsp_core.registers[DSP_REG_A1] = source[1];
-	dsp_core.registers[DSP_REG_A0] = source[2];
+	dsp_write_acc56(DSP_REG_A, source);
 
-	dsp_ccr_update_e_u_n_z(source[0], source[1], source[2]);
+	dsp_ccr_update_e_u_n_z(source);
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 }
 
 static void dsp_mpyr_m_y0_x0_a(void)
 {
-	Uint32 source[3];
+	Uint64 source;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_Y0], dsp_core.registers[DSP_REG_X0], source, SIGN_MINUS);
-	dsp_rnd56(source);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_Y0], dsp_core.registers[DSP_REG_X0], SIGN_MINUS);
+	dsp_rnd56(&source);
 
-	dsp_core.registers[DSP_REG_A2] = source[0];
-	dsp_core.registers[DSP_REG_A1] = source[1];
-	dsp_core.registers[DSP_REG_A0] = source[2];
+	dsp_write_acc56(DSP_REG_A, source);
 
-	dsp_ccr_update_e_u_n_z(source[0], source[1], source[2]);
+	dsp_ccr_update_e_u_n_z(source);
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 }
 
 static void dsp_mpyr_p_y0_x0_b(void)
 {
-	Uint32 source[3];
+	Uint64 source;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_Y0], dsp_core.registers[DSP_REG_X0], source, SIGN_PLUS);
-	dsp_rnd56(source);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_Y0], dsp_core.registers[DSP_REG_X0], SIGN_PLUS);
+	dsp_rnd56(&source);
 
-	dsp_core.registers[DSP_REG_B2] = source[0];
-	dsp_core.registers[DSP_REG_B1] = source[1];
-	dsp_core.registers[DSP_REG_B0] = source[2];
+	dsp_write_acc56(DSP_REG_B, source);
 
-	dsp_ccr_update_e_u_n_z(source[0], source[1], source[2]);
+	dsp_ccr_update_e_u_n_z(source);
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 }
 
 static void dsp_mpyr_m_y0_x0_b(void)
 {
-	Uint32 source[3];
+	Uint64 source;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_Y0], dsp_core.registers[DSP_REG_X0], source, SIGN_MINUS);
-	dsp_rnd56(source);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_Y0], dsp_core.registers[DSP_REG_X0], SIGN_MINUS);
+	dsp_rnd56(&source);
 
-	dsp_core.registers[DSP_REG_B2] = source[0];
-	dsp_core.registers[DSP_REG_B1] = source[1];
-	dsp_core.registers[DSP_REG_B0] = source[2];
+	dsp_write_acc56(DSP_REG_B, source);
 
-	dsp_ccr_update_e_u_n_z(source[0], source[1], source[2]);
+	dsp_ccr_update_e_u_n_z(source);
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 }
 
 static void dsp_mpyr_p_x1_y0_a(void)
 {
-	Uint32 source[3];
+	Uint64 source;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_X1], dsp_core.registers[DSP_REG_Y0], source, SIGN_PLUS);
-	dsp_rnd56(source);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_X1], dsp_core.registers[DSP_REG_Y0], SIGN_PLUS);
+	dsp_rnd56(&source);
 
-	dsp_core.registers[DSP_REG_A2] = source[0];
-	dsp_core.registers[DSP_REG_A1] = source[1];
-	dsp_core.registers[DSP_REG_A0] = source[2];
+	dsp_write_acc56(DSP_REG_A, source);
 
-	dsp_ccr_update_e_u_n_z(source[0], source[1], source[2]);
+	dsp_ccr_update_e_u_n_z(source);
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 }
 
 static void dsp_mpyr_m_x1_y0_a(void)
 {
-	Uint32 source[3];
+	Uint64 source;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_X1], dsp_core.registers[DSP_REG_Y0], source, SIGN_MINUS);
-	dsp_rnd56(source);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_X1], dsp_core.registers[DSP_REG_Y0], SIGN_MINUS);
+	dsp_rnd56(&source);
 
-	dsp_core.registers[DSP_REG_A2] = source[0];
-	dsp_core.registers[DSP_REG_A1] = source[1];
-	dsp_core.registers[DSP_REG_A0] = source[2];
+	dsp_write_acc56(DSP_REG_A, source);
 
-	dsp_ccr_update_e_u_n_z(source[0], source[1], source[2]);
+	dsp_ccr_update_e_u_n_z(source);
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 }
 
 static void dsp_mpyr_p_x1_y0_b(void)
 {
-	Uint32 source[3];
+	Uint64 source;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_X1], dsp_core.registers[DSP_REG_Y0], source, SIGN_PLUS);
-	dsp_rnd56(source);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_X1], dsp_core.registers[DSP_REG_Y0], SIGN_PLUS);
+	dsp_rnd56(&source);
 
-	dsp_core.registers[DSP_REG_B2] = source[0];
-	dsp_core.registers[DSP_REG_B1] = source[1];
-	dsp_core.registers[DSP_REG_B0] = source[2];
+	dsp_write_acc56(DSP_REG_B, source);
 
-	dsp_ccr_update_e_u_n_z(source[0], source[1], source[2]);
+	dsp_ccr_update_e_u_n_z(source);
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 }
 
 static void dsp_mpyr_m_x1_y0_b(void)
 {
-	Uint32 source[3];
+	Uint64 source;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_X1], dsp_core.registers[DSP_REG_Y0], source, SIGN_MINUS);
-	dsp_rnd56(source);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_X1], dsp_core.registers[DSP_REG_Y0], SIGN_MINUS);
+	dsp_rnd56(&source);
 
-	dsp_core.registers[DSP_REG_B2] = source[0];
-	dsp_core.registers[DSP_REG_B1] = source[1];
-	dsp_core.registers[DSP_REG_B0] = source[2];
+	dsp_write_acc56(DSP_REG_B, source);
 
-	dsp_ccr_update_e_u_n_z(source[0], source[1], source[2]);
+	dsp_ccr_update_e_u_n_z(source);
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 }
 
 static void dsp_mpyr_p_y1_x1_a(void)
 {
-	Uint32 source[3];
+	Uint64 source;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_Y1], dsp_core.registers[DSP_REG_X1], source, SIGN_PLUS);
-	dsp_rnd56(source);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_Y1], dsp_core.registers[DSP_REG_X1], SIGN_PLUS);
+	dsp_rnd56(&source);
 
-	dsp_core.registers[DSP_REG_A2] = source[0];
-	dsp_core.registers[DSP_REG_A1] = source[1];
-	dsp_core.registers[DSP_REG_A0] = source[2];
+	dsp_write_acc56(DSP_REG_A, source);
 
-	dsp_ccr_update_e_u_n_z(source[0], source[1], source[2]);
+	dsp_ccr_update_e_u_n_z(source);
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 }
 
 static void dsp_mpyr_m_y1_x1_a(void)
 {
-	Uint32 source[3];
+	Uint64 source;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_Y1], dsp_core.registers[DSP_REG_X1], source, SIGN_MINUS);
-	dsp_rnd56(source);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_Y1], dsp_core.registers[DSP_REG_X1], SIGN_MINUS);
+	dsp_rnd56(&source);
 
-	dsp_core.registers[DSP_REG_A2] = source[0];
-	dsp_core.registers[DSP_REG_A1] = source[1];
-	dsp_core.registers[DSP_REG_A0] = source[2];
+	dsp_write_acc56(DSP_REG_A, source);
 
-	dsp_ccr_update_e_u_n_z(source[0], source[1], source[2]);
+	dsp_ccr_update_e_u_n_z(source);
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 }
 
 static void dsp_mpyr_p_y1_x1_b(void)
 {
-	Uint32 source[3];
+	Uint64 source;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_Y1], dsp_core.registers[DSP_REG_X1], source, SIGN_PLUS);
-	dsp_rnd56(source);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_Y1], dsp_core.registers[DSP_REG_X1], SIGN_PLUS);
+	dsp_rnd56(&source);
 
-	dsp_core.registers[DSP_REG_B2] = source[0];
-	dsp_core.registers[DSP_REG_B1] = source[1];
-	dsp_core.registers[DSP_REG_B0] = source[2];
+	dsp_write_acc56(DSP_REG_B, source);
 
-	dsp_ccr_update_e_u_n_z(source[0], source[1], source[2]);
+	dsp_ccr_update_e_u_n_z(source);
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 }
 
 static void dsp_mpyr_m_y1_x1_b(void)
 {
-	Uint32 source[3];
+	Uint64 source;
 
-	dsp_mul56(dsp_core.registers[DSP_REG_Y1], dsp_core.registers[DSP_REG_X1], source, SIGN_MINUS);
-	dsp_rnd56(source);
+	source = dsp_mul56(dsp_core.registers[DSP_REG_Y1], dsp_core.registers[DSP_REG_X1], SIGN_MINUS);
+	dsp_rnd56(&source);
 
-	dsp_core.registers[DSP_REG_B2] = source[0];
-	dsp_core.registers[DSP_REG_B1] = source[1];
-	dsp_core.registers[DSP_REG_B0] = source[2];
+	dsp_write_acc56(DSP_REG_B, source);
 
-	dsp_ccr_update_e_u_n_z(source[0], source[1], source[2]);
+	dsp_ccr_update_e_u_n_z(source);
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 }
 
 static void dsp_neg_a(void)
 {
-	Uint32 source[3], dest[3], overflowed;
+	Uint64 source, dest;
+	Uint32 overflowed;
 
-	source[0] = dsp_core.registers[DSP_REG_A2];
-	source[1] = dsp_core.registers[DSP_REG_A1];
-	source[2] = dsp_core.registers[DSP_REG_A0];
+	source = dsp_read_acc56(DSP_REG_A);
 
-	overflowed = ((source[2]==0) && (source[1]==0) && (source[0]==0x80));
+	overflowed = (source == DSP_ACC56_MIN);
 
-	dest[0] = dest[1] = dest[2] = 0;
+	dest = 0;
 
-	dsp_sub56(source, dest);
+	dsp_sub56(source, &dest);
 
-	dsp_core.registers[DSP_REG_A2] = dest[0];
-	dsp_core.registers[DSP_REG_A1] = dest[1];
-	dsp_core.registers[DSP_REG_A0] = dest[2];
+	dsp_write_acc56(DSP_REG_A, dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 	dsp_core.registers[DSP_REG_SR] |= (overflowed<<DSP_SR_L)|(overflowed<<DSP_SR_V);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 }
 
 static void dsp_neg_b(void)
 {
-	Uint32 source[3], dest[3], overflowed;
+	Uint64 source, dest;
+	Uint32 overflowed;
 
-	source[0] = dsp_core.registers[DSP_REG_B2];
-	source[1] = dsp_core.registers[DSP_REG_B1];
-	source[2] = dsp_core.registers[DSP_REG_B0];
+	source = dsp_read_acc56(DSP_REG_B);
 
-	overflowed = ((source[2]==0) && (source[1]==0) && (source[0]==0x80));
+	overflowed = (source == DSP_ACC56_MIN);
 
-	dest[0] = dest[1] = dest[2] = 0;
+	dest = 0;
 
-	dsp_sub56(source, dest);
+	dsp_sub56(source, &dest);
 
-	dsp_core.registers[DSP_REG_B2] = dest[0];
-	dsp_core.registers[DSP_REG_B1] = dest[1];
-	dsp_core.registers[DSP_REG_B0] = dest[2];
+	dsp_write_acc56(DSP_REG_B, dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 	dsp_core.registers[DSP_REG_SR] |= (overflowed<<DSP_SR_L)|(overflowed<<DSP_SR_V);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 }
 
 static void dsp_nop(void)
@@ -8321,36 +7679,28 @@ static void dsp_or_y1_b(void)
 
 static void dsp_rnd_a(void)
 {
-	Uint32 dest[3];
+	Uint64 dest;
 
-	dest[0] = dsp_core.registers[DSP_REG_A2];
-	dest[1] = dsp_core.registers[DSP_REG_A1];
-	dest[2] = dsp_core.registers[DSP_REG_A0];
+	dest = dsp_read_acc56(DSP_REG_A);
 
-	dsp_rnd56(dest);
+	dsp_rnd56(&dest);
 
-	dsp_core.registers[DSP_REG_A2] = dest[0];
-	dsp_core.registers[DSP_REG_A1] = dest[1];
-	dsp_core.registers[DSP_REG_A0] = dest[2];
+	dsp_write_acc56(DSP_REG_A, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 }
 
 static void dsp_rnd_b(void)
 {
-	Uint32 dest[3];
+	Uint64 dest;
 
-	dest[0] = dsp_core.registers[DSP_REG_B2];
-	dest[1] = dsp_core.registers[DSP_REG_B1];
-	dest[2] = dsp_core.registers[DSP_REG_B0];
+	dest = dsp_read_acc56(DSP_REG_B);
 
-	dsp_rnd56(dest);
+	dsp_rnd56(&dest);
 
-	dsp_core.registers[DSP_REG_B2] = dest[0];
-	dsp_core.registers[DSP_REG_B1] = dest[1];
-	dsp_core.registers[DSP_REG_B0] = dest[2];
+	dsp_write_acc56(DSP_REG_B, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 }
 
 static void dsp_rol_a(void)
@@ -8417,31 +7767,26 @@ static void dsp_ror_b(void)
 
 static void dsp_sbc_x_a(void)
 {
-	Uint32 source[3], dest[3], curcarry;
+	Uint64 source, dest;
+	Uint32 curcarry;
 	Uint16 newsr;
 
 	curcarry = (dsp_core.registers[DSP_REG_SR]>>(DSP_SR_C)) & 1;
 
-	dest[2] = dsp_core.registers[DSP_REG_A0];
-	dest[1] = dsp_core.registers[DSP_REG_A1];
-	dest[0] = dsp_core.registers[DSP_REG_A2];
+	dest = dsp_read_acc56(DSP_REG_A);
 
-	source[2] = dsp_core.registers[DSP_REG_X0];
-	source[1] = dsp_core.registers[DSP_REG_X1];
-	source[0] = source[1] & (1<<23) ? 0xff : 0x0;
+	source = dsp_sext56(dsp_core.registers[DSP_REG_X1], dsp_core.registers[DSP_REG_X0]);
 
-	newsr = dsp_sub56(source, dest);
+	newsr = dsp_sub56(source, &dest);
 	
 	if (curcarry) {
-		source[0]=0; source[1]=0; source[2]=1;
-		newsr |= dsp_sub56(source, dest);
+		source = 1;
+		newsr |= dsp_sub56(source, &dest);
 	}
 
-	dsp_core.registers[DSP_REG_A2] = dest[0];
-	dsp_core.registers[DSP_REG_A1] = dest[1];
-	dsp_core.registers[DSP_REG_A0] = dest[2];
+	dsp_write_acc56(DSP_REG_A, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-((1<<DSP_SR_V)|(1<<DSP_SR_C));
 	dsp_core.registers[DSP_REG_SR] |= newsr;
@@ -8449,31 +7794,26 @@ static void dsp_sbc_x_a(void)
 
 static void dsp_sbc_x_b(void)
 {
-	Uint32 source[3], dest[3], curcarry;
+	Uint64 source, dest;
+	Uint32 curcarry;
 	Uint16 newsr;
 
 	curcarry = (dsp_core.registers[DSP_REG_SR]>>(DSP_SR_C)) & 1;
 
-	dest[2] = dsp_core.registers[DSP_REG_B0];
-	dest[1] = dsp_core.registers[DSP_REG_B1];
-	dest[0] = dsp_core.registers[DSP_REG_B2];
+	dest = dsp_read_acc56(DSP_REG_B);
 
-	source[2] = dsp_core.registers[DSP_REG_X0];
-	source[1] = dsp_core.registers[DSP_REG_X1];
-	source[0] = source[1] & (1<<23) ? 0xff : 0x0;
+	source = dsp_sext56(dsp_core.registers[DSP_REG_X1], dsp_core.registers[DSP_REG_X0]);
 
-	newsr = dsp_sub56(source, dest);
+	newsr = dsp_sub56(source, &dest);
 	
 	if (curcarry) {
-		source[0]=0; source[1]=0; source[2]=1;
-		newsr |= dsp_sub56(source, dest);
+		source = 1;
+		newsr |= dsp_sub56(source, &dest);
 	}
 
-	dsp_core.registers[DSP_REG_B2] = dest[0];
-	dsp_core.registers[DSP_REG_B1] = dest[1];
-	dsp_core.registers[DSP_REG_B0] = dest[2];
+	dsp_write_acc56(DSP_REG_B, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-((1<<DSP_SR_V)|(1<<DSP_SR_C));
 	dsp_core.registers[DSP_REG_SR] |= newsr;
@@ -8481,31 +7821,26 @@ static void dsp_sbc_x_b(void)
 
 static void dsp_sbc_y_a(void)
 {
-	Uint32 source[3], dest[3], curcarry;
+	Uint64 source, dest;
+	Uint32 curcarry;
 	Uint16 newsr;
 
 	curcarry = (dsp_core.registers[DSP_REG_SR]>>(DSP_SR_C)) & 1;
 
-	dest[2] = dsp_core.registers[DSP_REG_A0];
-	dest[1] = dsp_core.registers[DSP_REG_A1];
-	dest[0] = dsp_core.registers[DSP_REG_A2];
+	dest = dsp_read_acc56(DSP_REG_A);
 
-	source[2] = dsp_core.registers[DSP_REG_Y0];
-	source[1] = dsp_core.registers[DSP_REG_Y1];
-	source[0] = source[1] & (1<<23) ? 0xff : 0x0;
+	source = dsp_sext56(dsp_core.registers[DSP_REG_Y1], dsp_core.registers[DSP_REG_Y0]);
 
-	newsr = dsp_sub56(source, dest);
+	newsr = dsp_sub56(source, &dest);
 	
 	if (curcarry) {
-		source[0]=0; source[1]=0; source[2]=1;
-		newsr |= dsp_sub56(source, dest);
+		source = 1;
+		newsr |= dsp_sub56(source, &dest);
 	}
 
-	dsp_core.registers[DSP_REG_A2] = dest[0];
-	dsp_core.registers[DSP_REG_A1] = dest[1];
-	dsp_core.registers[DSP_REG_A0] = dest[2];
+	dsp_write_acc56(DSP_REG_A, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-((1<<DSP_SR_V)|(1<<DSP_SR_C));
 	dsp_core.registers[DSP_REG_SR] |= newsr;
@@ -8513,31 +7848,26 @@ static void dsp_sbc_y_a(void)
 
 static void dsp_sbc_y_b(void)
 {
-	Uint32 source[3], dest[3], curcarry;
+	Uint64 source, dest;
+	Uint32 curcarry;
 	Uint16 newsr;
 
 	curcarry = (dsp_core.registers[DSP_REG_SR]>>(DSP_SR_C)) & 1;
 
-	dest[2] = dsp_core.registers[DSP_REG_B0];
-	dest[1] = dsp_core.registers[DSP_REG_B1];
-	dest[0] = dsp_core.registers[DSP_REG_B2];
+	dest = dsp_read_acc56(DSP_REG_B);
 
-	source[2] = dsp_core.registers[DSP_REG_Y0];
-	source[1] = dsp_core.registers[DSP_REG_Y1];
-	source[0] = source[1] & (1<<23) ? 0xff : 0x0;
+	source = dsp_sext56(dsp_core.registers[DSP_REG_Y1], dsp_core.registers[DSP_REG_Y0]);
 
-	newsr = dsp_sub56(source, dest);
+	newsr = dsp_sub56(source, &dest);
 	
 	if (curcarry) {
-		source[0]=0; source[1]=0; source[2]=1;
-		newsr |= dsp_sub56(source, dest);
+		source = 1;
+		newsr |= dsp_sub56(source, &dest);
 	}
 
-	dsp_core.registers[DSP_REG_B2] = dest[0];
-	dsp_core.registers[DSP_REG_B1] = dest[1];
-	dsp_core.registers[DSP_REG_B0] = dest[2];
+	dsp_write_acc56(DSP_REG_B, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-((1<<DSP_SR_V)|(1<<DSP_SR_C));
 	dsp_core.registers[DSP_REG_SR] |= newsr;
@@ -8545,24 +7875,18 @@ static void dsp_sbc_y_b(void)
 
 static void dsp_sub_b_a(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dest[2] = dsp_core.registers[DSP_REG_A0];
-	dest[1] = dsp_core.registers[DSP_REG_A1];
-	dest[0] = dsp_core.registers[DSP_REG_A2];
+	dest = dsp_read_acc56(DSP_REG_A);
 
-	source[2] = dsp_core.registers[DSP_REG_B0];
-	source[1] = dsp_core.registers[DSP_REG_B1];
-	source[0] = dsp_core.registers[DSP_REG_B2];
+	source = dsp_read_acc56(DSP_REG_B);
 
-	newsr = dsp_sub56(source, dest);
+	newsr = dsp_sub56(source, &dest);
 
-	dsp_core.registers[DSP_REG_A2] = dest[0];
-	dsp_core.registers[DSP_REG_A1] = dest[1];
-	dsp_core.registers[DSP_REG_A0] = dest[2];
+	dsp_write_acc56(DSP_REG_A, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-((1<<DSP_SR_V)|(1<<DSP_SR_C));
 	dsp_core.registers[DSP_REG_SR] |= newsr;
@@ -8570,24 +7894,18 @@ static void dsp_sub_b_a(void)
 
 static void dsp_sub_a_b(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dest[2] = dsp_core.registers[DSP_REG_B0];
-	dest[1] = dsp_core.registers[DSP_REG_B1];
-	dest[0] = dsp_core.registers[DSP_REG_B2];
+	dest = dsp_read_acc56(DSP_REG_B);
 
-	source[2] = dsp_core.registers[DSP_REG_A0];
-	source[1] = dsp_core.registers[DSP_REG_A1];
-	source[0] = dsp_core.registers[DSP_REG_A2];
+	source = dsp_read_acc56(DSP_REG_A);
 
-	newsr = dsp_sub56(source, dest);
+	newsr = dsp_sub56(source, &dest);
 
-	dsp_core.registers[DSP_REG_B2] = dest[0];
-	dsp_core.registers[DSP_REG_B1] = dest[1];
-	dsp_core.registers[DSP_REG_B0] = dest[2];
+	dsp_write_acc56(DSP_REG_B, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-((1<<DSP_SR_V)|(1<<DSP_SR_C));
 	dsp_core.registers[DSP_REG_SR] |= newsr;
@@ -8595,24 +7913,18 @@ static void dsp_sub_a_b(void)
 
 static void dsp_sub_x_a(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dest[2] = dsp_core.registers[DSP_REG_A0];
-	dest[1] = dsp_core.registers[DSP_REG_A1];
-	dest[0] = dsp_core.registers[DSP_REG_A2];
+	dest = dsp_read_acc56(DSP_REG_A);
 
-	source[2] = dsp_core.registers[DSP_REG_X0];
-	source[1] = dsp_core.registers[DSP_REG_X1];
-	source[0] = source[1] & (1<<23) ? 0xff : 0x0;
+	source = dsp_sext56(dsp_core.registers[DSP_REG_X1], dsp_core.registers[DSP_REG_X0]);
 
-	newsr = dsp_sub56(source, dest);
+	newsr = dsp_sub56(source, &dest);
 
-	dsp_core.registers[DSP_REG_A2] = dest[0];
-	dsp_core.registers[DSP_REG_A1] = dest[1];
-	dsp_core.registers[DSP_REG_A0] = dest[2];
+	dsp_write_acc56(DSP_REG_A, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-((1<<DSP_SR_V)|(1<<DSP_SR_C));
 	dsp_core.registers[DSP_REG_SR] |= newsr;
@@ -8620,24 +7932,18 @@ static void dsp_sub_x_a(void)
 
 static void dsp_sub_x_b(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dest[2] = dsp_core.registers[DSP_REG_B0];
-	dest[1] = dsp_core.registers[DSP_REG_B1];
-	dest[0] = dsp_core.registers[DSP_REG_B2];
+	dest = dsp_read_acc56(DSP_REG_B);
 
-	source[2] = dsp_core.registers[DSP_REG_X0];
-	source[1] = dsp_core.registers[DSP_REG_X1];
-	source[0] = source[1] & (1<<23) ? 0xff : 0x0;
+	source = dsp_sext56(dsp_core.registers[DSP_REG_X1], dsp_core.registers[DSP_REG_X0]);
 
-	newsr = dsp_sub56(source, dest);
+	newsr = dsp_sub56(source, &dest);
 
-	dsp_core.registers[DSP_REG_B2] = dest[0];
-	dsp_core.registers[DSP_REG_B1] = dest[1];
-	dsp_core.registers[DSP_REG_B0] = dest[2];
+	dsp_write_acc56(DSP_REG_B, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-((1<<DSP_SR_V)|(1<<DSP_SR_C));
 	dsp_core.registers[DSP_REG_SR] |= newsr;
@@ -8645,24 +7951,18 @@ static void dsp_sub_x_b(void)
 
 static void dsp_sub_y_a(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dest[2] = dsp_core.registers[DSP_REG_A0];
-	dest[1] = dsp_core.registers[DSP_REG_A1];
-	dest[0] = dsp_core.registers[DSP_REG_A2];
+	dest = dsp_read_acc56(DSP_REG_A);
 
-	source[2] = dsp_core.registers[DSP_REG_Y0];
-	source[1] = dsp_core.registers[DSP_REG_Y1];
-	source[0] = source[1] & (1<<23) ? 0xff : 0x0;
+	source = dsp_sext56(dsp_core.registers[DSP_REG_Y1], dsp_core.registers[DSP_REG_Y0]);
 
-	newsr = dsp_sub56(source, dest);
+	newsr = dsp_sub56(source, &dest);
 
-	dsp_core.registers[DSP_REG_A2] = dest[0];
-	dsp_core.registers[DSP_REG_A1] = dest[1];
-	dsp_core.registers[DSP_REG_A0] = dest[2];
+	dsp_write_acc56(DSP_REG_A, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-((1<<DSP_SR_V)|(1<<DSP_SR_C));
 	dsp_core.registers[DSP_REG_SR] |= newsr;
@@ -8670,24 +7970,18 @@ static void dsp_sub_y_a(void)
 
 static void dsp_sub_y_b(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dest[2] = dsp_core.registers[DSP_REG_B0];
-	dest[1] = dsp_core.registers[DSP_REG_B1];
-	dest[0] = dsp_core.registers[DSP_REG_B2];
+	dest = dsp_read_acc56(DSP_REG_B);
 
-	source[2] = dsp_core.registers[DSP_REG_Y0];
-	source[1] = dsp_core.registers[DSP_REG_Y1];
-	source[0] = source[1] & (1<<23) ? 0xff : 0x0;
+	source = dsp_sext56(dsp_core.registers[DSP_REG_Y1], dsp_core.registers[DSP_REG_Y0]);
 
-	newsr = dsp_sub56(source, dest);
+	newsr = dsp_sub56(source, &dest);
 
-	dsp_core.registers[DSP_REG_B2] = dest[0];
-	dsp_core.registers[DSP_REG_B1] = dest[1];
-	dsp_core.registers[DSP_REG_B0] = dest[2];
+	dsp_write_acc56(DSP_REG_B, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-((1<<DSP_SR_V)|(1<<DSP_SR_C));
 	dsp_core.registers[DSP_REG_SR] |= newsr;
@@ -8695,24 +7989,18 @@ static void dsp_sub_y_b(void)
 
 static void dsp_sub_x0_a(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dest[2] = dsp_core.registers[DSP_REG_A0];
-	dest[1] = dsp_core.registers[DSP_REG_A1];
-	dest[0] = dsp_core.registers[DSP_REG_A2];
+	dest = dsp_read_acc56(DSP_REG_A);
 
-	source[2] = 0;
-	source[1] = dsp_core.registers[DSP_REG_X0];
-	source[0] = source[1] & (1<<23) ? 0xff : 0x0;
+	source = dsp_sext56(dsp_core.registers[DSP_REG_X0], 0);
 
-	newsr = dsp_sub56(source, dest);
+	newsr = dsp_sub56(source, &dest);
 
-	dsp_core.registers[DSP_REG_A2] = dest[0];
-	dsp_core.registers[DSP_REG_A1] = dest[1];
-	dsp_core.registers[DSP_REG_A0] = dest[2];
+	dsp_write_acc56(DSP_REG_A, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-((1<<DSP_SR_V)|(1<<DSP_SR_C));
 	dsp_core.registers[DSP_REG_SR] |= newsr;
@@ -8720,24 +8008,18 @@ static void dsp_sub_x0_a(void)
 
 static void dsp_sub_x0_b(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dest[2] = dsp_core.registers[DSP_REG_B0];
-	dest[1] = dsp_core.registers[DSP_REG_B1];
-	dest[0] = dsp_core.registers[DSP_REG_B2];
+	dest = dsp_read_acc56(DSP_REG_B);
 
-	source[2] = 0;
-	source[1] = dsp_core.registers[DSP_REG_X0];
-	source[0] = source[1] & (1<<23) ? 0xff : 0x0;
+	source = dsp_sext56(dsp_core.registers[DSP_REG_X0], 0);
 
-	newsr = dsp_sub56(source, dest);
+	newsr = dsp_sub56(source, &dest);
 
-	dsp_core.registers[DSP_REG_B2] = dest[0];
-	dsp_core.registers[DSP_REG_B1] = dest[1];
-	dsp_core.registers[DSP_REG_B0] = dest[2];
+	dsp_write_acc56(DSP_REG_B, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-((1<<DSP_SR_V)|(1<<DSP_SR_C));
 	dsp_core.registers[DSP_REG_SR] |= newsr;
@@ -8745,24 +8027,18 @@ static void dsp_sub_x0_b(void)
 
 static void dsp_sub_y0_a(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dest[2] = dsp_core.registers[DSP_REG_A0];
-	dest[1] = dsp_core.registers[DSP_REG_A1];
-	dest[0] = dsp_core.registers[DSP_REG_A2];
+	dest = dsp_read_acc56(DSP_REG_A);
 
-	source[2] = 0;
-	source[1] = dsp_core.registers[DSP_REG_Y0];
-	source[0] = source[1] & (1<<23) ? 0xff : 0x0;
+	source = dsp_sext56(dsp_core.registers[DSP_REG_Y0], 0);
 
-	newsr = dsp_sub56(source, dest);
+	newsr = dsp_sub56(source, &dest);
 
-	dsp_core.registers[DSP_REG_A2] = dest[0];
-	dsp_core.registers[DSP_REG_A1] = dest[1];
-	dsp_core.registers[DSP_REG_A0] = dest[2];
+	dsp_write_acc56(DSP_REG_A, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-((1<<DSP_SR_V)|(1<<DSP_SR_C));
 	dsp_core.registers[DSP_REG_SR] |= newsr;
@@ -8770,24 +8046,18 @@ static void dsp_sub_y0_a(void)
 
 static void dsp_sub_y0_b(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dest[2] = dsp_core.registers[DSP_REG_B0];
-	dest[1] = dsp_core.registers[DSP_REG_B1];
-	dest[0] = dsp_core.registers[DSP_REG_B2];
+	dest = dsp_read_acc56(DSP_REG_B);
 
-	source[2] = 0;
-	source[1] = dsp_core.registers[DSP_REG_Y0];
-	source[0] = source[1] & (1<<23) ? 0xff : 0x0;
+	source = dsp_sext56(dsp_core.registers[DSP_REG_Y0], 0);
 
-	newsr = dsp_sub56(source, dest);
+	newsr = dsp_sub56(source, &dest);
 
-	dsp_core.registers[DSP_REG_B2] = dest[0];
-	dsp_core.registers[DSP_REG_B1] = dest[1];
-	dsp_core.registers[DSP_REG_B0] = dest[2];
+	dsp_write_acc56(DSP_REG_B, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-((1<<DSP_SR_V)|(1<<DSP_SR_C));
 	dsp_core.registers[DSP_REG_SR] |= newsr;
@@ -8795,24 +8065,18 @@ static void dsp_sub_y0_b(void)
 
 static void dsp_sub_x1_a(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dest[2] = dsp_core.registers[DSP_REG_A0];
-	dest[1] = dsp_core.registers[DSP_REG_A1];
-	dest[0] = dsp_core.registers[DSP_REG_A2];
+	dest = dsp_read_acc56(DSP_REG_A);
 
-	source[2] = 0;
-	source[1] = dsp_core.registers[DSP_REG_X1];
-	source[0] = source[1] & (1<<23) ? 0xff : 0x0;
+	source = dsp_sext56(dsp_core.registers[DSP_REG_X1], 0);
 
-	newsr = dsp_sub56(source, dest);
+	newsr = dsp_sub56(source, &dest);
 
-	dsp_core.registers[DSP_REG_A2] = dest[0];
-	dsp_core.registers[DSP_REG_A1] = dest[1];
-	dsp_core.registers[DSP_REG_A0] = dest[2];
+	dsp_write_acc56(DSP_REG_A, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-((1<<DSP_SR_V)|(1<<DSP_SR_C));
 	dsp_core.registers[DSP_REG_SR] |= newsr;
@@ -8820,24 +8084,18 @@ static void dsp_sub_x1_a(void)
 
 static void dsp_sub_x1_b(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dest[2] = dsp_core.registers[DSP_REG_B0];
-	dest[1] = dsp_core.registers[DSP_REG_B1];
-	dest[0] = dsp_core.registers[DSP_REG_B2];
+	dest = dsp_read_acc56(DSP_REG_B);
 
-	source[2] = 0;
-	source[1] = dsp_core.registers[DSP_REG_X1];
-	source[0] = source[1] & (1<<23) ? 0xff : 0x0;
+	source = dsp_sext56(dsp_core.registers[DSP_REG_X1], 0);
 
-	newsr = dsp_sub56(source, dest);
+	newsr = dsp_sub56(source, &dest);
 
-	dsp_core.registers[DSP_REG_B2] = dest[0];
-	dsp_core.registers[DSP_REG_B1] = dest[1];
-	dsp_core.registers[DSP_REG_B0] = dest[2];
+	dsp_write_acc56(DSP_REG_B, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-((1<<DSP_SR_V)|(1<<DSP_SR_C));
 	dsp_core.registers[DSP_REG_SR] |= newsr;
@@ -8845,24 +8103,18 @@ static void dsp_sub_x1_b(void)
 
 static void dsp_sub_y1_a(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dest[2] = dsp_core.registers[DSP_REG_A0];
-	dest[1] = dsp_core.registers[DSP_REG_A1];
-	dest[0] = dsp_core.registers[DSP_REG_A2];
+	dest = dsp_read_acc56(DSP_REG_A);
 
-	source[2] = 0;
-	source[1] = dsp_core.registers[DSP_REG_Y1];
-	source[0] = source[1] & (1<<23) ? 0xff : 0x0;
+	source = dsp_sext56(dsp_core.registers[DSP_REG_Y1], 0);
 
-	newsr = dsp_sub56(source, dest);
+	newsr = dsp_sub56(source, &dest);
 
-	dsp_core.registers[DSP_REG_A2] = dest[0];
-	dsp_core.registers[DSP_REG_A1] = dest[1];
-	dsp_core.registers[DSP_REG_A0] = dest[2];
+	dsp_write_acc56(DSP_REG_A, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-((1<<DSP_SR_V)|(1<<DSP_SR_C));
 	dsp_core.registers[DSP_REG_SR] |= newsr;
@@ -8870,24 +8122,18 @@ static void dsp_sub_y1_a(void)
 
 static void dsp_sub_y1_b(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dest[2] = dsp_core.registers[DSP_REG_B0];
-	dest[1] = dsp_core.registers[DSP_REG_B1];
-	dest[0] = dsp_core.registers[DSP_REG_B2];
+	dest = dsp_read_acc56(DSP_REG_B);
 
-	source[2] = 0;
-	source[1] = dsp_core.registers[DSP_REG_Y1];
-	source[0] = source[1] & (1<<23) ? 0xff : 0x0;
+	source = dsp_sext56(dsp_core.registers[DSP_REG_Y1], 0);
 
-	newsr = dsp_sub56(source, dest);
+	newsr = dsp_sub56(source, &dest);
 
-	dsp_core.registers[DSP_REG_B2] = dest[0];
-	dsp_core.registers[DSP_REG_B1] = dest[1];
-	dsp_core.registers[DSP_REG_B0] = dest[2];
+	dsp_write_acc56(DSP_REG_B, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-((1<<DSP_SR_V)|(1<<DSP_SR_C));
 	dsp_core.registers[DSP_REG_SR] |= newsr;
@@ -8895,24 +8141,18 @@ static void dsp_sub_y1_b(void)
 
 static void dsp_subl_a(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dest[0] = dsp_core.registers[DSP_REG_A2];
-	dest[1] = dsp_core.registers[DSP_REG_A1];
-	dest[2] = dsp_core.registers[DSP_REG_A0];
-	newsr = dsp_asl56(dest);
+	dest = dsp_read_acc56(DSP_REG_A);
+	newsr = dsp_asl56(&dest);
 
-	source[0] = dsp_core.registers[DSP_REG_B2];
-	source[1] = dsp_core.registers[DSP_REG_B1];
-	source[2] = dsp_core.registers[DSP_REG_B0];
-	newsr |= dsp_sub56(source, dest);
+	source = dsp_read_acc56(DSP_REG_B);
+	newsr |= dsp_sub56(source, &dest);
 
-	dsp_core.registers[DSP_REG_A2] = dest[0];
-	dsp_core.registers[DSP_REG_A1] = dest[1];
-	dsp_core.registers[DSP_REG_A0] = dest[2];
+	dsp_write_acc56(DSP_REG_A, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-((1<<DSP_SR_V)|(1<<DSP_SR_C));
 	dsp_core.registers[DSP_REG_SR] |= newsr;
@@ -8920,24 +8160,18 @@ static void dsp_subl_a(void)
 
 static void dsp_subl_b(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dest[0] = dsp_core.registers[DSP_REG_B2];
-	dest[1] = dsp_core.registers[DSP_REG_B1];
-	dest[2] = dsp_core.registers[DSP_REG_B0];
-	newsr = dsp_asl56(dest);
+	dest = dsp_read_acc56(DSP_REG_B);
+	newsr = dsp_asl56(&dest);
 
-	source[0] = dsp_core.registers[DSP_REG_A2];
-	source[1] = dsp_core.registers[DSP_REG_A1];
-	source[2] = dsp_core.registers[DSP_REG_A0];
-	newsr |= dsp_sub56(source, dest);
+	source = dsp_read_acc56(DSP_REG_A);
+	newsr |= dsp_sub56(source, &dest);
 
-	dsp_core.registers[DSP_REG_B2] = dest[0];
-	dsp_core.registers[DSP_REG_B1] = dest[1];
-	dsp_core.registers[DSP_REG_B0] = dest[2];
+	dsp_write_acc56(DSP_REG_B, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-((1<<DSP_SR_V)|(1<<DSP_SR_C));
 	dsp_core.registers[DSP_REG_SR] |= newsr;
@@ -8945,26 +8179,20 @@ static void dsp_subl_b(void)
 
 static void dsp_subr_a(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dest[0] = dsp_core.registers[DSP_REG_A2];
-	dest[1] = dsp_core.registers[DSP_REG_A1];
-	dest[2] = dsp_core.registers[DSP_REG_A0];
+	dest = dsp_read_acc56(DSP_REG_A);
 	
-	newsr = dsp_asr56(dest);
+	newsr = dsp_asr56(&dest);
 
-	source[0] = dsp_core.registers[DSP_REG_B2];
-	source[1] = dsp_core.registers[DSP_REG_B1];
-	source[2] = dsp_core.registers[DSP_REG_B0];
+	source = dsp_read_acc56(DSP_REG_B);
 	
-	newsr |= dsp_sub56(source, dest);
+	newsr |= dsp_sub56(source, &dest);
 
-	dsp_core.registers[DSP_REG_A2] = dest[0];
-	dsp_core.registers[DSP_REG_A1] = dest[1];
-	dsp_core.registers[DSP_REG_A0] = dest[2];
+	dsp_write_acc56(DSP_REG_A, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-((1<<DSP_SR_V)|(1<<DSP_SR_C));
 	dsp_core.registers[DSP_REG_SR] |= newsr;
@@ -8972,26 +8200,20 @@ static void dsp_subr_a(void)
 
 static void dsp_subr_b(void)
 {
-	Uint32 source[3], dest[3];
+	Uint64 source, dest;
 	Uint16 newsr;
 
-	dest[0] = dsp_core.registers[DSP_REG_B2];
-	dest[1] = dsp_core.registers[DSP_REG_B1];
-	dest[2] = dsp_core.registers[DSP_REG_B0];
+	dest = dsp_read_acc56(DSP_REG_B);
 	
-	newsr = dsp_asr56(dest);
+	newsr = dsp_asr56(&dest);
 
-	source[0] = dsp_core.registers[DSP_REG_A2];
-	source[1] = dsp_core.registers[DSP_REG_A1];
-	source[2] = dsp_core.registers[DSP_REG_A0];
+	source = dsp_read_acc56(DSP_REG_A);
 	
-	newsr |= dsp_sub56(source, dest);
+	newsr |= dsp_sub56(source, &dest);
 
-	dsp_core.registers[DSP_REG_B2] = dest[0];
-	dsp_core.registers[DSP_REG_B1] = dest[1];
-	dsp_core.registers[DSP_REG_B0] = dest[2];
+	dsp_write_acc56(DSP_REG_B, dest);
 
-	dsp_ccr_update_e_u_n_z(dest[0], dest[1], dest[2]);
+	dsp_ccr_update_e_u_n_z(dest);
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-((1<<DSP_SR_V)|(1<<DSP_SR_C));
 	dsp_core.registers[DSP_REG_SR] |= newsr;
@@ -9093,18 +8315,14 @@ static void dsp_tfr_y1_b(void)
 
 static void dsp_tst_a(void)
 {
-	dsp_ccr_update_e_u_n_z(	dsp_core.registers[DSP_REG_A2],
-				dsp_core.registers[DSP_REG_A1],
-				dsp_core.registers[DSP_REG_A0]);
+	dsp_ccr_update_e_u_n_z(dsp_read_acc56(DSP_REG_A));
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 }
 
 static void dsp_tst_b(void)
 {
-	dsp_ccr_update_e_u_n_z(	dsp_core.registers[DSP_REG_B2],
-				dsp_core.registers[DSP_REG_B1],
-				dsp_core.registers[DSP_REG_B0]);
+	dsp_ccr_update_e_u_n_z(dsp_read_acc56(DSP_REG_B));
 
 	dsp_core.registers[DSP_REG_SR] &= BITMASK(16)-(1<<DSP_SR_V);
 }
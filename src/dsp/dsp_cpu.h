@@ -114,6 +114,7 @@ extern "C" {
 extern void dsp56k_init_cpu(void);		/* Set dsp_core to use */
 extern void dsp56k_execute_instruction(void);	/* Execute 1 instruction */
 extern Uint16 dsp56k_execute_one_disasm_instruction(FILE *out, Uint16 pc);	/* Execute 1 instruction in disasm mode */
+extern void dsp56k_flush_decode_cache(void);	/* Forget decoded instructions after P memory change */
 
 /* Interrupt relative functions */
 void dsp_set_interrupt(Uint32 intr, Uint32 set);
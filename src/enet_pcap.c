@@ -47,6 +47,7 @@ static void pcap_tick(void)
             memcpy(p->data,data,h.caplen);
             QueueEnter(pcapq,p);
             SDL_UnlockMutex(pcap_mutex);
+            enet_rx_notify();
             Log_Printf(LOG_WARN, "[PCAP] Output packet with %i bytes to queue",h.caplen);
         }
     }
@@ -75,6 +76,9 @@ void enet_pcap_queue_poll(void)
             enet_receive(qp->data,qp->len);
             free(qp);
         }
+        if (QueuePeek(pcapq)>0) {
+            enet_rx_notify(); /* more packets waiting */
+        }
         SDL_UnlockMutex(pcap_mutex);
     }
 }
@@ -55,6 +55,7 @@ void slirp_output (const unsigned char *pkt, int pkt_len)
     memcpy(p->data,pkt,pkt_len);
     QueueEnter(slirpq,p);
     SDL_UnlockMutex(slirp_mutex);
+    enet_rx_notify();
     Log_Printf(LOG_WARN, "[SLIRP] Output packet with %i bytes to queue",pkt_len);
 }
 
@@ -113,6 +114,9 @@ void enet_slirp_queue_poll(void)
         enet_receive(qp->data,qp->len);
         free(qp);
     }
+    if (QueuePeek(slirpq)>0) {
+        enet_rx_notify(); /* more packets waiting */
+    }
     SDL_UnlockMutex(slirp_mutex);
 }
 
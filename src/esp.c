@@ -10,6 +10,7 @@
 #include "sysReg.h"
 #include "dma.h"
 #include "scsi.h"
+#include "memorySnapShot.h"
 
 #define LOG_ESPDMA_LEVEL    LOG_DEBUG   /* Print debugging messages for ESP DMA registers */
 #define LOG_ESPCMD_LEVEL    LOG_DEBUG   /* Print debugging messages for ESP commands */
@@ -142,6 +143,7 @@ Uint8 mode_dma;
 /* Experimental */
 #define ESP_CLOCK_FREQ  20      /* ESP is clocked at 20 MHz */
 #define ESP_DELAY       100     /* Standard wait time for ESP interrupt (except bus reset and selection timeout) */
+#define ESP_FAST_DELAY  10      /* Wait time between DMA passes in fast transfer mode */
 
 
 /* ESP DMA control and status registers */
@@ -770,11 +772,30 @@ bool esp_transfer_done(bool write) {
 }
 
 
+/* In fast transfer mode the whole transfer is moved in as few DMA passes
+ * as possible. The latency of the transfer only depends on its size. */
+static Sint64 esp_fast_transfer_time(void) {
+    Sint64 rate = ConfigureParams.SCSI.nFastTransferRate;
+    
+    if (rate <= 0) {
+        rate = 20480;
+    }
+    return ESP_FAST_DELAY + ((Sint64)esp_counter * 1000000) / (rate * 1024);
+}
+
+static int esp_io_delay(void) {
+    return ConfigureParams.SCSI.bFastTransfer ? ESP_FAST_DELAY : 100;
+}
+
 /* Transfer information */
 void esp_transfer_info(void) {
     if(mode_dma) {
         esp_io_state=ESP_IO_STATE_TRANSFERING;
-        CycInt_AddRelativeInterruptUs(SCSI_Seek_Time() + SCSI_Sector_Time(), 100, INTERRUPT_ESP_IO);
+        if (ConfigureParams.SCSI.bFastTransfer) {
+            CycInt_AddRelativeInterruptUs(esp_fast_transfer_time(), 0, INTERRUPT_ESP_IO);
+        } else {
+            CycInt_AddRelativeInterruptUs(SCSI_Seek_Time() + SCSI_Sector_Time(), 100, INTERRUPT_ESP_IO);
+        }
     } else {
         Log_Printf(LOG_ESPCMD_LEVEL, "[ESP] start PIO transfer");
         switch (SCSIbus.phase) {
@@ -830,7 +851,7 @@ void ESP_IO_Handler(void) {
             return;
     }
     
-    CycInt_AddRelativeInterruptUs(100, 0, INTERRUPT_ESP_IO);
+    CycInt_AddRelativeInterruptUs(esp_io_delay(), 0, INTERRUPT_ESP_IO);
 }
 
 
@@ -917,3 +938,29 @@ if(scsi_command_group < 3 || scsi_command_group > 4) {
     status &= ~STAT_VGC;
 }
 #endif
+
+
+/* Save/restore controller registers, FIFO and the DMA control register */
+void ESP_MemorySnapShot_Capture(bool bSave) {
+    MemorySnapShot_Store(&esp_state, sizeof(esp_state));
+    MemorySnapShot_Store(&esp_cmd_state, sizeof(esp_cmd_state));
+    MemorySnapShot_Store(&writetranscountl, sizeof(writetranscountl));
+    MemorySnapShot_Store(&writetranscounth, sizeof(writetranscounth));
+    MemorySnapShot_Store(fifo, sizeof(fifo));
+    MemorySnapShot_Store(command, sizeof(command));
+    MemorySnapShot_Store(&status, sizeof(status));
+    MemorySnapShot_Store(&selectbusid, sizeof(selectbusid));
+    MemorySnapShot_Store(&intstatus, sizeof(intstatus));
+    MemorySnapShot_Store(&selecttimeout, sizeof(selecttimeout));
+    MemorySnapShot_Store(&seqstep, sizeof(seqstep));
+    MemorySnapShot_Store(&syncperiod, sizeof(syncperiod));
+    MemorySnapShot_Store(&fifoflags, sizeof(fifoflags));
+    MemorySnapShot_Store(&syncoffset, sizeof(syncoffset));
+    MemorySnapShot_Store(&configuration, sizeof(configuration));
+    MemorySnapShot_Store(&clockconv, sizeof(clockconv));
+    MemorySnapShot_Store(&esptest, sizeof(esptest));
+    MemorySnapShot_Store(&esp_counter, sizeof(esp_counter));
+    MemorySnapShot_Store(&esp_io_state, sizeof(esp_io_state));
+    MemorySnapShot_Store(&mode_dma, sizeof(mode_dma));
+    MemorySnapShot_Store(&esp_dma, sizeof(esp_dma));
+}
@@ -19,6 +19,9 @@
 #include "enet_pcap.h"
 #include "cycInt.h"
 #include "statusbar.h"
+#include "host.h"
+#include "memorySnapShot.h"
+#include "journal.h"
 
 
 #define LOG_EN_LEVEL        LOG_DEBUG
@@ -42,6 +45,10 @@ struct {
 
 bool enet_stopped;
 
+/* Statistics for batch reports */
+Uint64 nEnetFramesReceived;
+Uint64 nEnetFramesSent;
+
 #define TXSTAT_READY        0x80    /* r */
 #define TXSTAT_NET_BUSY     0x40    /* r */
 #define TXSTAT_TX_RECVD     0x20    /* r */
@@ -111,6 +118,7 @@ void EN_TX_Status_Write(void) {
     if ((enet.tx_status&enet.tx_mask&0x0F)==0) {
         set_interrupt(INT_EN_TX, RELEASE_INT);
     }
+    enet_wakeup();
 }
 
 void EN_TX_Mask_Read(void) { // 0x02006001
@@ -164,6 +172,7 @@ void EN_TX_Mode_Read(void) { // 0x02006004
 void EN_TX_Mode_Write(void) {
     enet.tx_mode=IoMem[IoAccessCurrentAddress & IO_SEG_MASK];
  	Log_Printf(LOG_EN_REG_LEVEL,"[EN] Transmitter mode write at $%08x val=$%02x PC=$%08x\n", IoAccessCurrentAddress, IoMem[IoAccessCurrentAddress & IO_SEG_MASK], m68k_getpc());
+    enet_wakeup();
 }
 
 void EN_RX_Mode_Read(void) { // 0x02006005
@@ -174,6 +183,7 @@ void EN_RX_Mode_Read(void) { // 0x02006005
 void EN_RX_Mode_Write(void) {
     enet.rx_mode=IoMem[IoAccessCurrentAddress & IO_SEG_MASK];
  	Log_Printf(LOG_EN_REG_LEVEL,"[EN] Receiver mode write at $%08x val=$%02x PC=$%08x\n", IoAccessCurrentAddress, IoMem[IoAccessCurrentAddress & IO_SEG_MASK], m68k_getpc());
+    enet_wakeup();
 }
 
 void EN_Reset_Write(void) { // 0x02006006
@@ -374,7 +384,7 @@ static bool enet_packet_for_me(Uint8 *packet) {
     }
 }
 
-void enet_receive(Uint8 *pkt, int len) {
+static void enet_receive_frame(Uint8 *pkt, int len) {
     if (enet_packet_for_me(pkt)) {
 #if 1   /* Hack for short packets from SLIRP */
         if (len<60) {
@@ -384,12 +394,19 @@ void enet_receive(Uint8 *pkt, int len) {
 #endif
         memcpy(enet_rx_buffer.data,pkt,len);
         enet_rx_buffer.size=enet_rx_buffer.limit=len;
+        nEnetFramesReceived++;
 		enet.tx_status |= TXSTAT_NET_BUSY;
     } else {
         Log_Printf(LOG_WARN, "[EN] Packet is not for me.");
     }
 }
 
+/* Frames from the host network are journaled, looped back frames are not */
+void enet_receive(Uint8 *pkt, int len) {
+    Journal_Record(JOURNAL_ENET_FRAME, pkt, len);
+    enet_receive_frame(pkt, len);
+}
+
 static void print_buf(Uint8 *buf, Uint32 size) {
 #if LOG_EN_DATA
     int i;
@@ -411,6 +428,26 @@ static void print_buf(Uint8 *buf, Uint32 size) {
 #define ENET_IO_DELAY   500     /* use 500 for NeXT hardware test, 20 for status test */
 #define ENET_IO_SHORT   40      /* use 40 for 68030 hardware test */
 
+/* The periodic check is only scheduled while there is work to do. Backend
+ * threads set enet_rx_signal after queueing a frame. If the check is not
+ * running, the emulation thread picks it up whenever an interrupt handler
+ * is dispatched and restarts the check. A received frame is then seen after
+ * the next emulated interrupt plus ENET_IO_DELAY, the event loop interrupt
+ * bounds this to 5 ms. */
+static atomic_int enet_rx_signal;
+static bool enet_io_active;
+
+/* The emulation thread only sees the signal through enet_rx_sync(), which
+ * journals it. Everything else uses enet_rx_pending. */
+static bool enet_rx_pending;
+
+static bool enet_rx_sync(void) {
+	if (Journal_Event(JOURNAL_ENET_RX, host_atomic_get(&enet_rx_signal) && host_atomic_set(&enet_rx_signal, 0))) {
+		enet_rx_pending = true;
+	}
+	return enet_rx_pending;
+}
+
 enum {
     RECV_STATE_WAITING,
     RECV_STATE_RECEIVING
@@ -483,7 +520,10 @@ static void enet_io(void) {
 					receiver_state = RECV_STATE_RECEIVING;
 			} else if (en_state == EN_THINWIRE || en_state == EN_TWISTEDPAIR) {
 				/* Receive from real world network */
-				enet_output();
+				if (enet_rx_sync()) {
+					enet_rx_pending = false;
+					enet_output();
+				}
 				break;
 			} else
 				break;
@@ -550,16 +590,17 @@ static void enet_io(void) {
 							   enet_tx_buffer.data[0], enet_tx_buffer.data[1], enet_tx_buffer.data[2],
 							   enet_tx_buffer.data[3], enet_tx_buffer.data[4], enet_tx_buffer.data[5]);
 					print_buf(enet_tx_buffer.data, enet_tx_buffer.size);
+					nEnetFramesSent++;
 					if (en_state == EN_LOOPBACK) {
 						/* Loop back */
 						Log_Printf(LOG_WARN, "[EN] Loopback packet.");
-						enet_receive(enet_tx_buffer.data, enet_tx_buffer.size);
+						enet_receive_frame(enet_tx_buffer.data, enet_tx_buffer.size);
 					} else {
 						/* Send to real world network */
 						enet_input(enet_tx_buffer.data,enet_tx_buffer.size);
 						/* Simultaneously receive packet on thin ethernet */
 						if (en_state == EN_THINWIRE) {
-							enet_receive(enet_tx_buffer.data, enet_tx_buffer.size);
+							enet_receive_frame(enet_tx_buffer.data, enet_tx_buffer.size);
 						}
 					}
 					enet_tx_buffer.size=0;
@@ -637,7 +678,10 @@ static void new_enet_io(void) {
 					receiver_state = RECV_STATE_RECEIVING;
 			} else if (en_state == EN_THINWIRE || en_state == EN_TWISTEDPAIR) {
 				/* Receive from real world network */
-				enet_output();
+				if (enet_rx_sync()) {
+					enet_rx_pending = false;
+					enet_output();
+				}
 				break;
 			} else
 				break;
@@ -690,16 +734,17 @@ static void new_enet_io(void) {
 							   enet_tx_buffer.data[3], enet_tx_buffer.data[4], enet_tx_buffer.data[5]);
 					print_buf(enet_tx_buffer.data, enet_tx_buffer.size);
 					enet.tx_status &= ~TXSTAT_TX_RECVD;
+					nEnetFramesSent++;
 					if (en_state == EN_LOOPBACK) {
 						/* Loop back */
 						Log_Printf(LOG_WARN, "[newEN] Loopback packet.");
-						enet_receive(enet_tx_buffer.data, enet_tx_buffer.size);
+						enet_receive_frame(enet_tx_buffer.data, enet_tx_buffer.size);
 					} else {
 						/* Send to real world network */
 						enet_input(enet_tx_buffer.data,enet_tx_buffer.size);
 						/* Simultaneously receive packet on thin ethernet */
 						if (en_state == EN_THINWIRE) {
-							enet_receive(enet_tx_buffer.data, enet_tx_buffer.size);
+							enet_receive_frame(enet_tx_buffer.data, enet_tx_buffer.size);
 						}
 					}
 					enet_tx_buffer.size=0;
@@ -717,11 +762,26 @@ static void new_enet_io(void) {
 	}
 }
 
+/* Check if the transmitter or receiver have something to do */
+static bool enet_io_busy(void) {
+	if (receiver_state != RECV_STATE_WAITING || enet_rx_buffer.size > 0) {
+		return true;
+	}
+	if (enet_tx_buffer.size > 0 || dma_enet_tx_enabled()) {
+		return true;
+	}
+	if (en_state == EN_THINWIRE || en_state == EN_TWISTEDPAIR) {
+		return enet_rx_sync();
+	}
+	return false;
+}
+
 void ENET_IO_Handler(void) {
 	CycInt_AcknowledgeInterrupt();
 	
 	if (enet.reset&EN_RESET) {
 		Log_Printf(LOG_WARN, "Stopping Ethernet Transmitter/Receiver");
+		enet_io_active=false;
 		enet_stopped=true;
 		/* Stop SLIRP/PCAP */
 		if (ConfigureParams.Ethernet.bEthernetConnected) {
@@ -736,16 +796,66 @@ void ENET_IO_Handler(void) {
 		enet_io();
 	}
 	
-	CycInt_AddRelativeInterruptUs(receiver_state==RECV_STATE_WAITING?ENET_IO_DELAY:ENET_IO_SHORT, 0, INTERRUPT_ENET_IO);
+	if (enet_io_busy()) {
+		CycInt_AddRelativeInterruptUs(receiver_state==RECV_STATE_WAITING?ENET_IO_DELAY:ENET_IO_SHORT, 0, INTERRUPT_ENET_IO);
+	} else {
+		enet_io_active=false;
+	}
+}
+
+/* Restart periodic check, call this from the emulation thread only */
+void enet_wakeup(void) {
+	if (!enet_io_active && !enet_stopped) {
+		enet_io_active=true;
+		CycInt_AddRelativeInterruptUs(ENET_IO_DELAY, 0, INTERRUPT_ENET_IO);
+	}
+}
+
+/* Signal arrival of a frame, this can be called from any thread */
+void enet_rx_notify(void) {
+	host_atomic_set(&enet_rx_signal, 1);
+}
+
+/* Called on every interrupt dispatch to pick up frames queued by backend
+ * threads. The signal is peeked without barrier, during replay it comes
+ * from the journal. */
+void ENET_RX_Check(void) {
+	if (enet_io_active || (!host_atomic_peek(&enet_rx_signal) && !Journal_Replaying())) {
+		return;
+	}
+	if (enet_rx_sync()) {
+		enet_wakeup();
+	}
+}
+
+/* During replay frames come from the journal and frames sent by the guest
+ * are dropped */
+static Uint8 enet_journal_frame[sizeof(enet_rx_buffer.data)];
+
+static void enet_journal_output(void) {
+    int len = Journal_Replay(JOURNAL_ENET_FRAME, enet_journal_frame, sizeof(enet_journal_frame));
+    if (len > 0) {
+        enet_receive_frame(enet_journal_frame, len);
+    }
+}
+
+static void enet_journal_input(Uint8 *pkt, int pkt_len) {
+}
+
+static void enet_journal_start(Uint8 *mac) {
+}
+
+static void enet_journal_stop(void) {
 }
 
 void enet_reset(void) {
     if (enet.reset&EN_RESET) {
         enet.tx_status=ConfigureParams.System.bTurbo?0:TXSTAT_READY;
+        enet_wakeup(); /* let the periodic check stop the transmitter/receiver */
     } else if (enet_stopped==true) {
         Log_Printf(LOG_WARN, "Starting Ethernet Transmitter/Receiver");
         enet_stopped=false;
-        CycInt_AddRelativeInterruptUs(ENET_IO_DELAY, 0, INTERRUPT_ENET_IO);
+        enet_wakeup();
         /* Start SLIRP/PCAP */
         if (ConfigureParams.Ethernet.bEthernetConnected) {
             enet_start(enet.mac_addr);
@@ -759,6 +869,9 @@ void Ethernet_Reset(bool hard) {
     if (hard) {
         enet.reset=EN_RESET;
         enet_stopped=true;
+        enet_io_active=false;
+        host_atomic_set(&enet_rx_signal, 0);
+        enet_rx_pending=false;
         enet_rx_buffer.size=enet_tx_buffer.size=0;
         enet_rx_buffer.limit=enet_tx_buffer.limit=64*1024;
         enet.tx_status=ConfigureParams.System.bTurbo?0:TXSTAT_READY;
@@ -768,6 +881,12 @@ void Ethernet_Reset(bool hard) {
         /* Stop SLIRP/PCAP */
         enet_stop();
     }
+    if (Journal_Replaying()) {
+        enet_output = enet_journal_output;
+        enet_input  = enet_journal_input;
+        enet_start  = enet_journal_start;
+        enet_stop   = enet_journal_stop;
+    } else
 #if HAVE_PCAP
     if (ConfigureParams.Ethernet.nHostInterface == ENET_PCAP) {
         enet_output = enet_pcap_queue_poll;
@@ -791,4 +910,30 @@ void Ethernet_Reset(bool hard) {
         /* Stop SLIRP/PCAP */
         enet_stop();
     }
+    enet_wakeup();
+}
+
+/* Stop or restart the host network backend without touching the controller */
+void Ethernet_Pause(bool pause) {
+    if (pause) {
+        enet_stop();
+    } else if (ConfigureParams.Ethernet.bEthernetConnected && !enet_stopped && !(enet.reset&EN_RESET)) {
+        enet_start(enet.mac_addr);
+    }
+}
+
+/* Save/restore controller state and frame buffers. Host network
+ * connections are not part of the snapshot. */
+void Ethernet_MemorySnapShot_Capture(bool bSave) {
+    MemorySnapShot_Store(&enet, sizeof(enet));
+    MemorySnapShot_Store(&enet_stopped, sizeof(enet_stopped));
+    MemorySnapShot_Store(&enet_io_active, sizeof(enet_io_active));
+    MemorySnapShot_Store(&enet_rx_pending, sizeof(enet_rx_pending));
+    MemorySnapShot_Store(&receiver_state, sizeof(receiver_state));
+    MemorySnapShot_Store(&tx_done, sizeof(tx_done));
+    MemorySnapShot_Store(&rx_chain, sizeof(rx_chain));
+    MemorySnapShot_Store(&old_size, sizeof(old_size));
+    MemorySnapShot_Store(&en_state, sizeof(en_state));
+    MemorySnapShot_Store(&enet_tx_buffer, sizeof(enet_tx_buffer));
+    MemorySnapShot_Store(&enet_rx_buffer, sizeof(enet_rx_buffer));
 }
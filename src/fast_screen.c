@@ -112,14 +112,18 @@ static void blitColor(SDL_Texture* tex) {
 
 /*
  Dimension format is 8bit per pixel, big-endian: RRGGBBAA
+ If lines is not NULL only the full lines it covers are blitted.
  */
-void blitDimension(Uint32* vram, SDL_Texture* tex) {
+void blitDimension(Uint32* vram, SDL_Texture* tex, const SDL_Rect* lines) {
+    SDL_Rect all = {0, 0, NeXT_SCRN_WIDTH, NeXT_SCRN_HEIGHT};
+    if (!lines) lines = &all;
 #if ND_STEP
-    Uint32* src = &vram[0];
+    Uint32* src = &vram[lines->y * (NeXT_SCRN_WIDTH+32)];
 #else
-    Uint32* src = &vram[16];
+    Uint32* src = &vram[lines->y * (NeXT_SCRN_WIDTH+32) + 16];
 #endif
     int     d;
+    int     pitch;
     Uint32  format;
     SDL_QueryTexture(tex, &format, &d, &d, &d);
     if(SDL_BYTEORDER == SDL_BIG_ENDIAN) {
@@ -127,12 +131,12 @@ void blitDimension(Uint32* vram, SDL_Texture* tex) {
         switch (format) {
             default: {
                 void*   pixels;
-                SDL_LockTexture(tex, NULL, &pixels, &d);
-                Uint32* dst = (Uint32*)pixels;
+                SDL_LockTexture(tex, lines, &pixels, &pitch);
 
                 /* fallback to SDL_MapRGB */
                 SDL_PixelFormat* pformat = SDL_AllocFormat(format);
-                for(int y = NeXT_SCRN_HEIGHT; --y >= 0;) {
+                for(int y = 0; y < lines->h; y++) {
+                    Uint32* dst = (Uint32*)((Uint8*)pixels + y * pitch);
                     for(int x = NeXT_SCRN_WIDTH; --x >= 0;) {
                         Uint32 v = *src++;
                         *dst++   = SDL_MapRGB(pformat, (v >> 8) & 0xFF, (v>>16) & 0xFF, (v>>24) & 0xFF);
@@ -148,17 +152,17 @@ void blitDimension(Uint32* vram, SDL_Texture* tex) {
         /* Add little-endian accelerated blit loops as needed here */
         switch (format) {
             case SDL_PIXELFORMAT_ARGB8888: {
-                SDL_UpdateTexture(tex, NULL, src, (NeXT_SCRN_WIDTH+32)*4);
+                SDL_UpdateTexture(tex, lines, src, (NeXT_SCRN_WIDTH+32)*4);
                 break;
             }
             default: {
                 void*   pixels;
-                SDL_LockTexture(tex, NULL, &pixels, &d);
-                Uint32* dst = (Uint32*)pixels;
+                SDL_LockTexture(tex, lines, &pixels, &pitch);
 
                 /* fallback to SDL_MapRGB */
                 SDL_PixelFormat* pformat = SDL_AllocFormat(format);
-                for(int y = NeXT_SCRN_HEIGHT; --y >= 0;) {
+                for(int y = 0; y < lines->h; y++) {
+                    Uint32* dst = (Uint32*)((Uint8*)pixels + y * pitch);
                     for(int x = NeXT_SCRN_WIDTH; --x >= 0;) {
                         Uint32 v = *src++;
                         *dst++   = SDL_MapRGB(pformat, (v >> 16) & 0xFF, (v>>8) & 0xFF, (v>>0) & 0xFF);
@@ -179,7 +183,7 @@ void blitDimension(Uint32* vram, SDL_Texture* tex) {
 static void blitScreen(SDL_Texture* tex) {
     if (ConfigureParams.Screen.nMonitorType==MONITOR_TYPE_DIMENSION) {
         Uint32* vram = nd_vram_for_slot(ND_SLOT(ConfigureParams.Screen.nMonitorNum));
-        if(vram) blitDimension(vram, tex);
+        if(vram) blitDimension(vram, tex, NULL);
         return;
     }
     if(NEXTVideo) {
@@ -372,8 +376,11 @@ void nd_sdl_destroy(void);
  */
 void Screen_UnInit(void) {
     doRepaint = false; // stop repaint thread
-    int s;
-    SDL_WaitThread(repaintThread, &s);
+    if (repaintThread) {
+        int s;
+        SDL_WaitThread(repaintThread, &s);
+        repaintThread = NULL;
+    }
     nd_sdl_destroy();
 }
 
@@ -11,6 +11,7 @@
 #include "cycInt.h"
 #include "file.h"
 #include "statusbar.h"
+#include "memorySnapShot.h"
 
 
 #define LOG_FLP_REG_LEVEL   LOG_DEBUG
@@ -18,6 +19,21 @@
 
 #define IO_SEG_MASK	0x1FFFF
 
+/* Timing profiles: fast divides mechanical delays, instant limits them */
+#define FLP_FAST_DIVISOR    10
+#define FLP_INSTANT_TIME    100
+
+static int flp_timing(int delay) {
+    switch (ConfigureParams.Floppy.nTiming) {
+        case TIMING_FAST:
+            return delay / FLP_FAST_DIVISOR;
+        case TIMING_INSTANT:
+            return delay < FLP_INSTANT_TIME ? delay : FLP_INSTANT_TIME;
+        default:
+            return delay;
+    }
+}
+
 
 /* Controller */
 struct {
@@ -280,7 +296,7 @@ void floppy_reset(bool hard) {
     } else {
         /* Single poll interrupt after reset (delay = 250 ms) */
         flp_io_state = FLP_STATE_INTERRUPT;
-        CycInt_AddRelativeInterruptUs(250*1000, 0, INTERRUPT_FLP_IO);
+        CycInt_AddRelativeInterruptUs(flp_timing(250*1000), 0, INTERRUPT_FLP_IO);
     }
 }
 
@@ -402,19 +418,19 @@ static void floppy_seek_track(Uint8 c, Uint8 h, int drive) {
 
 static int get_sector_time(int drive) {
     switch (flpdrv[drive].floppysize) {
-        case SIZE_720K: return 22000;
-        case SIZE_1440K: return 11000;
-        case SIZE_2880K: return 5500;
-        default: return 1000;
+        case SIZE_720K: return flp_timing(22000);
+        case SIZE_1440K: return flp_timing(11000);
+        case SIZE_2880K: return flp_timing(5500);
+        default: return flp_timing(1000);
     }
 }
 
 static int get_seek_time(int drive) {
     if (flpdrv[drive].seekoffset > NUM_CYLINDERS) {
-        return FLP_SEEK_TIME;
+        return flp_timing(FLP_SEEK_TIME);
     }
     
-    return (flpdrv[drive].seekoffset * FLP_SEEK_TIME / NUM_CYLINDERS);
+    return flp_timing(flpdrv[drive].seekoffset * FLP_SEEK_TIME / NUM_CYLINDERS);
 }
 
 /* Media IDs for control register */
@@ -1266,3 +1282,56 @@ void Floppy_Reset(void) {
     Floppy_Uninit();
     Floppy_Init();
 }
+
+/* Reopen disk images read-only in a forked process, so the file position
+ * is not shared with other processes. The disks become write protected. */
+void Floppy_Reopen(void) {
+    int i;
+    
+    for (i = 0; i < FLP_MAX_DRIVES; i++) {
+        if (flpdrv[i].dsk) {
+            File_Close(flpdrv[i].dsk);
+            flpdrv[i].dsk = File_Open(ConfigureParams.Floppy.drive[i].szImageName, "rb");
+            flpdrv[i].protected = true;
+            if (flpdrv[i].dsk == NULL) {
+                Log_Printf(LOG_WARN, "Floppy Disk%i: Cannot reopen image file %s\n",
+                           i, ConfigureParams.Floppy.drive[i].szImageName);
+                flpdrv[i].inserted = false;
+            }
+        }
+    }
+}
+
+/* Save/restore controller and drive state, disk image handles are kept */
+void Floppy_MemorySnapShot_Capture(bool bSave) {
+    int i;
+    
+    MemorySnapShot_Store(&flp, sizeof(flp));
+    MemorySnapShot_Store(&floppy_select, sizeof(floppy_select));
+    for (i = 0; i < FLP_MAX_DRIVES; i++) {
+        FILE* dsk = flpdrv[i].dsk;
+        Uint32 floppysize = flpdrv[i].floppysize;
+        bool protected = flpdrv[i].protected;
+        bool inserted = flpdrv[i].inserted;
+        bool connected = flpdrv[i].connected;
+        
+        MemorySnapShot_Store(&flpdrv[i], sizeof(flpdrv[i]));
+        
+        flpdrv[i].dsk = dsk;
+        flpdrv[i].floppysize = floppysize;
+        flpdrv[i].protected = protected;
+        flpdrv[i].inserted = inserted;
+        flpdrv[i].connected = connected;
+    }
+    MemorySnapShot_Store(&flp_sector_counter, sizeof(flp_sector_counter));
+    MemorySnapShot_Store(&flp_io_drv, sizeof(flp_io_drv));
+    MemorySnapShot_Store(&flp_io_state, sizeof(flp_io_state));
+    MemorySnapShot_Store(&cmd_phase, sizeof(cmd_phase));
+    MemorySnapShot_Store(&cmd_size, sizeof(cmd_size));
+    MemorySnapShot_Store(&cmd_limit, sizeof(cmd_limit));
+    MemorySnapShot_Store(&command, sizeof(command));
+    MemorySnapShot_Store(cmd_data, sizeof(cmd_data));
+    MemorySnapShot_Store(&result_size, sizeof(result_size));
+    MemorySnapShot_Store(&old_size, sizeof(old_size));
+    MemorySnapShot_Store(&flp_buffer, sizeof(flp_buffer));
+}
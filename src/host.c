@@ -8,11 +8,19 @@
 #endif
 #endif
 #include <errno.h>
+#include <string.h>
+#if HAVE_MMAP
+#include <sys/mman.h>
+#endif
+#if defined(__linux__)
+#include <unistd.h>
+#endif
 
 #include "host.h"
 #include "configuration.h"
 #include "main.h"
 #include "log.h"
+#include "journal.h"
 #include "memory.h"
 #include "newcpu.h"
 
@@ -54,7 +62,7 @@ void host_reset() {
     pauseTimeStamp    = perfCounterStart;
     perfFrequency     = SDL_GetPerformanceFrequency();
     ticksStart        = SDL_GetTicks();
-    unixTimeStart     = time(NULL);
+    unixTimeStart     = Journal_Value(JOURNAL_UNIXTIME, time(NULL));
     cycleCounterStart = 0;
     cycleSecsStart    = 0;
     currentIsRealtime = false;
@@ -243,10 +251,23 @@ int host_atomic_get(atomic_int* a) {
     return SDL_AtomicGet(a);
 }
 
+/* Relaxed read without memory barrier, for cheap polling */
+int host_atomic_peek(atomic_int* a) {
+#if defined(__GNUC__)
+    return __atomic_load_n(&a->value, __ATOMIC_RELAXED);
+#else
+    return SDL_AtomicGet(a);
+#endif
+}
+
 bool host_atomic_cas(atomic_int* a, int oldValue, int newValue) {
     return SDL_AtomicCAS(a, oldValue, newValue);
 }
 
+int host_atomic_add(atomic_int* a, int value) {
+    return SDL_AtomicAdd(a, value);
+}
+
 thread_t* host_thread_create(thread_func_t func, const char* name, void* data) {
   return SDL_CreateThread(func, name, data);
 }
@@ -296,3 +317,71 @@ Uint8* host_malloc_aligned(size_t size) {
     return (Uint8*)malloc(size);
 #endif
 }
+
+/* Guest memory is reserved but only committed when the guest touches it.
+ * The mapping is 64 KB aligned like host_malloc_aligned and reads as zero. */
+Uint8* host_map_memory(size_t size) {
+#if HAVE_MMAP
+    size_t align = 0x10000;
+    int    flags = MAP_PRIVATE | MAP_ANON;
+#ifdef MAP_NORESERVE
+    flags |= MAP_NORESERVE;
+#endif
+    Uint8* base = (Uint8*)mmap(NULL, size + align, PROT_READ | PROT_WRITE, flags, -1, 0);
+    if (base == (Uint8*)MAP_FAILED) {
+        Log_Printf(LOG_WARN, "[Host] Unable to map %lu bytes (%s)", (unsigned long)size, strerror(errno));
+        return NULL;
+    }
+    /* Trim the mapping to an aligned block */
+    Uint8* result = (Uint8*)(((uintptr_t)base + align - 1) & ~(uintptr_t)(align - 1));
+    if (result > base)
+        munmap(base, result - base);
+    if (result + size < base + size + align)
+        munmap(result + size, (base + size + align) - (result + size));
+#if HAVE_MADVISE && defined(MADV_HUGEPAGE)
+    /* Transparent huge pages reduce TLB pressure for large guest memories */
+    if (size >= 0x200000)
+        madvise(result, size, MADV_HUGEPAGE);
+#endif
+    return result;
+#else
+    Uint8* result = host_malloc_aligned(size);
+    if (result)
+        memset(result, 0, size);
+    return result;
+#endif
+}
+
+void host_unmap_memory(Uint8* mem, size_t size) {
+    if (!mem)
+        return;
+#if HAVE_MMAP
+    munmap(mem, size);
+#else
+    free(mem);
+#endif
+}
+
+/* Clear guest memory and give its pages back to the host. Only Linux
+ * guarantees that discarded anonymous pages read back as zero. */
+void host_reclaim_memory(Uint8* mem, size_t size) {
+#if HAVE_MMAP && HAVE_MADVISE && defined(__linux__)
+    if (madvise(mem, size, MADV_DONTNEED) == 0)
+        return;
+#endif
+    memset(mem, 0, size);
+}
+
+size_t host_resident_size(void) {
+    size_t result = 0;
+#if defined(__linux__)
+    unsigned long pages, resident;
+    FILE* f = fopen("/proc/self/statm", "r");
+    if (f) {
+        if (fscanf(f, "%lu %lu", &pages, &resident) == 2)
+            result = (size_t)resident * (size_t)sysconf(_SC_PAGESIZE);
+        fclose(f);
+    }
+#endif
+    return result;
+}
@@ -7,3 +7,4 @@ void adb_wput(Uint32 addr, Uint16 w);
 void adb_bput(Uint32 addr, Uint8 b);
 
 void ADB_Reset(void);
+void ADB_MemorySnapShot_Capture(bool bSave);
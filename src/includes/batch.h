@@ -0,0 +1,23 @@
+/*
+  Previous - batch.h
+
+  This file is distributed under the GNU Public License, version 2 or at
+  your option any later version. Read the file gpl.txt for details.
+*/
+
+#ifndef PREV_BATCH_H
+#define PREV_BATCH_H
+
+extern void Batch_Enable(void);
+extern bool Batch_IsActive(void);
+extern void Batch_SetRunTime(double dSeconds);
+extern bool Batch_SetWriteMarker(Uint32 nAddr, Uint32 nValue);
+extern bool Batch_SetSerialMarker(const char *psString);
+extern void Batch_SetReportFile(const char *psFileName);
+extern void Batch_Start(void);
+extern void Batch_Check(void);
+extern void Batch_SerialOutput(Uint8 val);
+extern void Batch_Report(void);
+extern int  Batch_ExitStatus(void);
+
+#endif /* PREV_BATCH_H */
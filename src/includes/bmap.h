@@ -7,5 +7,6 @@ void bmap_wput(uaecptr addr, uae_u32 w);
 void bmap_bput(uaecptr addr, uae_u32 b);
 
 void bmap_init(void);
+void bmap_MemorySnapShot_Capture(bool bSave);
 
 extern int bmap_tpe_select;
@@ -26,6 +26,7 @@ struct Config_Tag
   void       *buf;                 /* Storage location     */
 };
 
+int set_config_value(const struct Config_Tag *, const char *, const char *);
 int input_config(const char *, const struct Config_Tag *, const char *);
 int update_config(const char *, const struct Config_Tag *, const char *);
 
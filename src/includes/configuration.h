@@ -26,6 +26,13 @@ typedef struct
 } CNF_CONFIGDLG;
 
 /* Logging and tracing */
+typedef enum
+{
+  JOURNAL_OFF,
+  JOURNAL_RECORD,
+  JOURNAL_REPLAY
+} JOURNALMODE;
+
 typedef struct
 {
   char sLogFileName[FILENAME_MAX];
@@ -33,6 +40,8 @@ typedef struct
   int nTextLogLevel;
   int nAlertDlgLogLevel;
   bool bConfirmQuit;
+  char sJournalFileName[FILENAME_MAX];
+  JOURNALMODE nJournalMode;       /* Record or replay host inputs */
 } CNF_LOG;
 
 
@@ -92,6 +101,8 @@ typedef enum {
   SHORTCUT_PAUSE,
   SHORTCUT_QUIT,
   SHORTCUT_DIMENSION,
+  SHORTCUT_SAVEMEM,
+  SHORTCUT_LOADMEM,
   SHORTCUT_KEYS,  /* number of shortcuts */
   SHORTCUT_NONE
 } SHORTCUTKEYIDX;
@@ -132,6 +143,9 @@ typedef struct
 {
   int nMemoryBankSize[4];
   MEMORY_SPEED nMemorySpeed;
+  char szMemoryCaptureFileName[FILENAME_MAX];
+  bool bAutoSave;               /* Restore snapshot at start-up, save it at exit */
+  int nForkWorkers;             /* Number of worker processes forked from the snapshot */
 } CNF_MEMORY;
 
 
@@ -186,9 +200,20 @@ typedef enum
 typedef struct {
     SCSIDISK target[ESP_MAX_DEVS];
     int nWriteProtection;
+    bool bFastTransfer;     /* Complete DMA transfers in one pass */
+    int nFastTransferRate;  /* Transfer rate in kB/sec for fast transfers */
 } CNF_SCSI;
 
 
+/* Timing profiles for MO and floppy drives */
+typedef enum
+{
+    TIMING_ACCURATE,
+    TIMING_FAST,
+    TIMING_INSTANT
+} DRIVETIMING;
+
+
 /* Magneto-optical drives configuration */
 #define MO_MAX_DRIVES   2
 typedef struct {
@@ -200,6 +225,7 @@ typedef struct {
 
 typedef struct {
     MODISK drive[MO_MAX_DRIVES];
+    int nTiming;
 } CNF_MO;
 
 
@@ -214,6 +240,7 @@ typedef struct {
 
 typedef struct {
     FLPDISK drive[FLP_MAX_DRIVES];
+    int nTiming;
 } CNF_FLOPPY;
 
 
@@ -258,10 +285,18 @@ typedef enum
     PAPER_LEGAL
 } PAPER_SIZE;
 
+typedef enum
+{
+    PRINT_PNG,          /* one PNG file per page */
+    PRINT_PBM,          /* one uncompressed PBM file per page */
+    PRINT_PBM_STREAM    /* all pages appended to one PBM file */
+} PRINT_FORMAT;
+
 typedef struct
 {
   bool bPrinterConnected;
   PAPER_SIZE nPaperSize;
+  PRINT_FORMAT nOutputFormat;
   char szPrintToFileName[FILENAME_MAX];
 } CNF_PRINTER;
 
@@ -314,6 +349,7 @@ typedef struct
   bool bRealtime;                 /* TRUE if realtime sources shoud be used */
   DSPTYPE nDSPType;               /* how to "emulate" DSP */
   bool bDSPMemoryExpansion;
+  bool bDSPThread;                /* Run DSP on a separate host thread */
   bool bRealTimeClock;
   FPUTYPE n_FPUType;
   bool bCompatibleFPU;            /* More compatible FPU */
@@ -372,7 +408,9 @@ int Configuration_CheckMemory(int *banksize);
 int  Configuration_CheckDimensionMemory(int *banksize);
 void Configuration_CheckDimensionSettings(void);
 void Configuration_CheckEthernetSettings(void);
+void Configuration_CheckJournalSettings(void);
 void Configuration_Load(const char *psFileName);
+bool Configuration_SetValue(const char *psSection, const char *psKey, const char *psValue);
 void Configuration_Save(void);
 void Configuration_MemorySnapShot_Capture(bool bSave);
 
@@ -35,6 +35,7 @@ typedef enum
   INTERRUPT_EVENT_LOOP,
   INTERRUPT_ND_VBL,
   INTERRUPT_ND_VIDEO_VBL,
+  INTERRUPT_THROTTLE,
   MAX_INTERRUPTS
 } interrupt_id;
 
@@ -70,6 +71,7 @@ void CycInt_AddRelativeInterruptUsCycles(int64_t us, int64_t usreal, interrupt_i
 void CycInt_RemovePendingInterrupt(interrupt_id Handler);
 bool CycInt_InterruptActive(interrupt_id Handler);
 bool CycInt_SetNewInterruptUs(void);
+int64_t CycInt_NextInterruptUs(void);
 
 #ifdef __cplusplus
 }
@@ -13,6 +13,8 @@ enum {
     CHANNEL_R2M         // 0x000001c0
 } DMA_CHANNEL;
 
+extern Uint64 nDMACompleted[];
+
 /* DMA Registers */
 void DMA_CSR_Read(void);
 void DMA_CSR_Write(void);
@@ -54,6 +56,7 @@ void dma_mo_read_memory(void);
 
 void dma_enet_write_memory(bool eop);
 bool dma_enet_read_memory(void);
+bool dma_enet_tx_enabled(void);
 
 void dma_dsp_write_memory(Uint8 val);
 Uint8 dma_dsp_read_memory(void);
@@ -75,3 +78,5 @@ void M2MDMA_IO_Handler(void);
 
 /* Function for video interrupt */
 void dma_video_interrupt(void);
+
+void DMA_MemorySnapShot_Capture(bool bSave);
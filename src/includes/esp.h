@@ -78,4 +78,6 @@ bool esp_transfer_done(bool write);
 extern Uint32 esp_counter;
 
 void ESP_InterruptHandler(void);
-void ESP_IO_Handler(void);
\ No newline at end of file
+void ESP_IO_Handler(void);
+
+void ESP_MemorySnapShot_Capture(bool bSave);
\ No newline at end of file
@@ -39,9 +39,17 @@ struct {
     int limit;
 } enet_rx_buffer;
 
+extern Uint64 nEnetFramesReceived;
+extern Uint64 nEnetFramesSent;
+
 void ENET_IO_Handler(void);
 void Ethernet_Reset(bool hard);
+void Ethernet_Pause(bool pause);
+void Ethernet_MemorySnapShot_Capture(bool bSave);
 void enet_receive(Uint8 *pkt, int len);
+void enet_wakeup(void);
+void enet_rx_notify(void);
+void ENET_RX_Check(void);
 
 /* Turbo ethernet controller */
 void EN_Control_Read(void);
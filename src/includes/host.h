@@ -59,10 +59,16 @@ extern "C" {
     int         host_trylock(lock_t* lock);
     int         host_atomic_set(atomic_int* a, int newValue);
     int         host_atomic_get(atomic_int* a);
+    int         host_atomic_peek(atomic_int* a);
     bool        host_atomic_cas(atomic_int* a, int oldValue, int newValue);
+    int         host_atomic_add(atomic_int* a, int value);
     thread_t*   host_thread_create(thread_func_t, const char* name, void* data);
     int         host_thread_wait(thread_t* thread);
     Uint8*      host_malloc_aligned(size_t size);
+    Uint8*      host_map_memory(size_t size);
+    void        host_unmap_memory(Uint8* mem, size_t size);
+    void        host_reclaim_memory(Uint8* mem, size_t size);
+    size_t      host_resident_size(void);
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,44 @@
+/*
+  Previous - journal.h
+
+  This file is distributed under the GNU Public License, version 2 or at
+  your option any later version. Read the file gpl.txt for details.
+*/
+
+#ifndef PREV_JOURNAL_H
+#define PREV_JOURNAL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Types of journal records, do not change their order */
+enum {
+	JOURNAL_KEYDOWN,
+	JOURNAL_KEYUP,
+	JOURNAL_MOUSE_MOVE,
+	JOURNAL_MOUSE_BUTTON,
+	JOURNAL_ENET_RX,        /* Host network signalled a received frame */
+	JOURNAL_ENET_FRAME,     /* Frame received from the host network */
+	JOURNAL_SNDIN,          /* Samples from the host sound input */
+	JOURNAL_SNDOUT_FULL,    /* Host sound output queue was full */
+	JOURNAL_UNIXTIME        /* Host time the real time clock starts from */
+};
+
+extern void Journal_Init(void);
+extern void Journal_UnInit(void);
+extern bool Journal_Active(void);
+extern bool Journal_Recording(void);
+extern bool Journal_Replaying(void);
+extern bool Journal_Event(int type, bool bHappened);
+extern Sint64 Journal_Value(int type, Sint64 nValue);
+extern void Journal_Record(int type, const void *pData, int nLen);
+extern int  Journal_Replay(int type, void *pData, int nMaxLen);
+extern bool Journal_Input(int type, int a, int b, int c, int d);
+extern void Journal_ReplayInput(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PREV_JOURNAL_H */
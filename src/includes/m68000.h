@@ -143,6 +143,7 @@ extern int BusMode;
 extern int	LastOpcodeFamily;
 extern int	LastInstrCycles;
 extern int	Pairing;
+extern Uint64	nCpuInstructions;
 extern char	PairingArray[ MAX_OPCODE_FAMILY ][ MAX_OPCODE_FAMILY ];
 extern const char *OpcodeName[];
 
@@ -168,6 +169,7 @@ static inline void M68000_AddCycles(int cycles) {
 
 void M68000_Init(void);
 void M68000_Reset(bool bCold);
+void M68000_MemorySnapShot_Capture(bool bSave);
 void M68000_Stop(void);
 void M68000_Start(void);
 void M68000_CheckCpuSettings(void);
@@ -0,0 +1,30 @@
+/*
+  Previous - memorySnapShot.h
+
+  This file is distributed under the GNU Public License, version 2 or at
+  your option any later version. Read the file gpl.txt for details.
+*/
+
+#ifndef PREV_MEMORYSNAPSHOT_H
+#define PREV_MEMORYSNAPSHOT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Size of the pages used to store emulated memory */
+#define SNAPSHOT_PAGE_SIZE  4096
+
+extern bool MemorySnapShot_Capture(const char *pszFileName, bool bConfirm);
+extern bool MemorySnapShot_CaptureIncremental(const char *pszFileName, bool bConfirm);
+extern bool MemorySnapShot_Restore(const char *pszFileName, bool bConfirm);
+extern void MemorySnapShot_Reset(void);
+extern const char* MemorySnapShot_LastFileName(void);
+extern void MemorySnapShot_Store(void *pData, int Size);
+extern void MemorySnapShot_StorePages(Uint8 *pMem, Uint32 nSize, Uint64 **ppHashes);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PREV_MEMORYSNAPSHOT_H */
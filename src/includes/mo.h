@@ -1,4 +1,9 @@
+extern Uint64 nMOSectorsRead;
+extern Uint64 nMOSectorsWritten;
+
 void MO_Reset(void);
+void MO_Reopen(void);
+void MO_MemorySnapShot_Capture(bool bSave);
 void MO_Insert(int disk);
 void MO_Eject(int disk);
 
@@ -0,0 +1,13 @@
+/*
+  Previous - options.h
+
+  This file is distributed under the GNU Public License, version 2 or at
+  your option any later version. Read the file gpl.txt for details.
+*/
+
+#ifndef PREV_OPTIONS_H
+#define PREV_OPTIONS_H
+
+extern bool Opt_ParseParameters(int argc, const char * const argv[]);
+
+#endif /* PREV_OPTIONS_H */
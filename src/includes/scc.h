@@ -232,6 +232,7 @@ void SCC_DataB_Read(void);
 void SCC_DataB_Write(void);
 
 void SCC_Reset(Uint8 mode);
+void SCC_MemorySnapShot_Capture(bool bSave);
 
 
 /* SCC DMA buffer */
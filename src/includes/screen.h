@@ -33,7 +33,7 @@ void Screen_ModeChanged(void);
 bool Update_StatusBar(void);
 void SDL_UpdateRects(SDL_Surface *screen, int numrects, SDL_Rect *rects);
 void SDL_UpdateRect(SDL_Surface *screen, Sint32 x, Sint32 y, Sint32 w, Sint32 h);
-void blitDimension(Uint32* vram, SDL_Texture* tex);
+void blitDimension(Uint32* vram, SDL_Texture* tex, const SDL_Rect* lines);
 
 #ifdef __cplusplus
 }
@@ -28,9 +28,14 @@ struct {
 } scsi_buffer;
 
 
+extern Uint64 nSCSIBlocksRead;
+extern Uint64 nSCSIBlocksWritten;
+
 void SCSI_Init(void);
 void SCSI_Uninit(void);
 void SCSI_Reset(void);
+void SCSI_Reopen(void);
+void SCSI_MemorySnapShot_Capture(bool bSave);
 void SCSI_Insert(Uint8 target);
 void SCSI_Eject(Uint8 target);
 
@@ -80,6 +80,7 @@ void set_dsp_interrupt(Uint8 state);
 void SID_Read(void);
 
 void SCR_Reset(void);
+void SCR_MemorySnapShot_Capture(bool bSave);
 void SCR1_Read0(void);
 void SCR1_Read1(void);
 void SCR1_Read2(void);
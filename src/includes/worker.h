@@ -0,0 +1,15 @@
+/*
+  Previous - worker.h
+
+  This file is distributed under the GNU Public License, version 2 or at
+  your option any later version. Read the file gpl.txt for details.
+*/
+
+#ifndef PREV_WORKER_H
+#define PREV_WORKER_H
+
+extern int Worker_Fork(int nWorkers);
+extern int Worker_GetIndex(void);
+extern int Worker_ExitStatus(void);
+
+#endif /* PREV_WORKER_H */
@@ -0,0 +1,476 @@
+/*
+  Previous - journal.c
+
+  This file is distributed under the GNU Public License, version 2 or at
+  your option any later version. Read the file gpl.txt for details.
+
+  Input journal
+
+  In record mode all inputs which reach the emulated machine from the host
+  are written to a journal together with the value of nCyclesMainCounter at
+  which they were delivered: keyboard and mouse events, frames from the host
+  network, sound input samples, the state of the host sound output queue and
+  the host time the real time clock starts from. In replay mode the inputs
+  are taken from the journal instead, so the machine runs through the same
+  states as during recording. This makes runs of the same guest workload
+  comparable between different builds of the emulator.
+
+  Replay requires emulated timing which does not depend on the host. While a
+  journal is active time is always derived from emulated cycles and the DSP
+  and i860 run on the CPU thread (see Configuration_CheckJournalSettings).
+  SCSI, MO and floppy operations then complete after a fixed number of
+  emulated cycles and are not journaled. Shortcuts and configuration changes
+  are not journaled either.
+
+  Host inputs are only recorded if they happened. Each record stores the
+  difference of the cycle counter to the previous record, the type and the
+  length of the data as variable length numbers followed by the data. The
+  difference can be negative, because a reset clears the cycle counter.
+*/
+const char Journal_fileid[] = "Previous journal.c : " __DATE__ " " __TIME__;
+
+#include "main.h"
+#include "configuration.h"
+#include "cycInt.h"
+#include "host.h"
+#include "kms.h"
+#include "log.h"
+#include "journal.h"
+
+#define JOURNAL_MAGIC       "PREVJRNL"
+#define JOURNAL_VERSION     1
+#define JOURNAL_MAX_DATA    (64*1024)
+#define JOURNAL_BUFFER_SIZE (64*1024)
+
+/* Variable length numbers are at most 10 byte */
+#define JOURNAL_MAX_NUMBER  10
+
+#define ZIGZAG(v)   (((Uint64)(v) << 1) ^ (Uint64)((Sint64)(v) >> 63))
+#define UNZIGZAG(n) ((Sint64)((n) >> 1) ^ -(Sint64)((n) & 1))
+
+static FILE *JournalFile;
+static int nJournalMode = JOURNAL_OFF;
+static Sint64 nLastCycle;           /* Cycle counter of the previous record */
+static bool bInjecting;             /* Replayed input is being delivered */
+
+/* In replay mode the next record is always read ahead */
+static Sint64 nNextCycle;
+static int nNextType;
+static int nNextLen;
+static Uint8 NextData[JOURNAL_MAX_DATA];
+
+/* Data of the last record taken in replay mode */
+static int nDataLen;
+static Uint8 Data[JOURNAL_MAX_DATA];
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Encode a variable length number, returns the number of bytes used.
+ */
+static int Journal_EncodeNumber(Uint8 *pBuf, Uint64 n)
+{
+	int i = 0;
+
+	do {
+		pBuf[i] = n & 0x7f;
+		n >>= 7;
+		if (n)
+			pBuf[i] |= 0x80;
+		i++;
+	} while (n);
+
+	return i;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Decode a variable length number, returns the number of bytes used or 0
+ * if the buffer ends before the number.
+ */
+static int Journal_DecodeNumber(const Uint8 *pBuf, int nLen, Uint64 *pn)
+{
+	Uint64 n = 0;
+	int i;
+
+	for (i = 0; i < nLen && i < JOURNAL_MAX_NUMBER; i++)
+	{
+		n |= (Uint64)(pBuf[i] & 0x7f) << (7 * i);
+		if (!(pBuf[i] & 0x80))
+		{
+			*pn = n;
+			return i + 1;
+		}
+	}
+	return 0;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Read a variable length number from the journal file.
+ */
+static bool Journal_ReadNumber(Uint64 *pn)
+{
+	Uint8 buf[JOURNAL_MAX_NUMBER];
+	int i, c;
+
+	for (i = 0; i < JOURNAL_MAX_NUMBER; i++)
+	{
+		c = getc(JournalFile);
+		if (c == EOF)
+			return false;
+		buf[i] = c;
+		if (!(c & 0x80))
+			return Journal_DecodeNumber(buf, i + 1, pn) > 0;
+	}
+	return false;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Close the journal and continue with host inputs.
+ */
+static void Journal_Close(void)
+{
+	if (JournalFile)
+	{
+		if (fclose(JournalFile) != 0 && nJournalMode == JOURNAL_RECORD)
+			Log_Printf(LOG_ERROR, "[Journal] Error while writing '%s'.\n",
+			           ConfigureParams.Log.sJournalFileName);
+		JournalFile = NULL;
+	}
+	nJournalMode = JOURNAL_OFF;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Append a record for the current cycle to the journal.
+ */
+static void Journal_Write(int type, const void *pData, int nLen)
+{
+	Uint8 head[2 * JOURNAL_MAX_NUMBER + 1];
+	int n;
+
+	n  = Journal_EncodeNumber(head, ZIGZAG(nCyclesMainCounter - nLastCycle));
+	head[n++] = type;
+	n += Journal_EncodeNumber(head + n, nLen);
+	nLastCycle = nCyclesMainCounter;
+
+	if (fwrite(head, 1, n, JournalFile) != (size_t)n ||
+	    (nLen > 0 && fwrite(pData, 1, nLen, JournalFile) != (size_t)nLen))
+	{
+		Log_Printf(LOG_ERROR, "[Journal] Error while writing '%s', recording stopped.\n",
+		           ConfigureParams.Log.sJournalFileName);
+		Journal_Close();
+	}
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Read the next record in replay mode. The replay ends with the journal.
+ */
+static void Journal_ReadNext(void)
+{
+	Uint64 delta, len;
+	int type;
+
+	if (!Journal_ReadNumber(&delta))
+	{
+		Log_Printf(LOG_WARN, "[Journal] Replay finished at cycle %"FMT_ll"d.\n",
+		           (long long)nCyclesMainCounter);
+		Journal_Close();
+		return;
+	}
+	type = getc(JournalFile);
+	if (type == EOF || !Journal_ReadNumber(&len) || len > JOURNAL_MAX_DATA ||
+	    fread(NextData, 1, len, JournalFile) != len)
+	{
+		Log_Printf(LOG_ERROR, "[Journal] '%s' is truncated, replay stopped.\n",
+		           ConfigureParams.Log.sJournalFileName);
+		Journal_Close();
+		return;
+	}
+	nNextCycle += UNZIGZAG(delta);
+	nNextType   = type;
+	nNextLen    = len;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Check if the next record is of the given type and belongs to the current
+ * cycle. A record for an earlier cycle means the machine did not follow the
+ * recorded run, the replay is stopped then.
+ */
+static bool Journal_Match(int type)
+{
+	if (nJournalMode != JOURNAL_REPLAY)
+		return false;
+
+	if (nNextCycle < nCyclesMainCounter)
+	{
+		Log_Printf(LOG_ERROR, "[Journal] Replay diverged at cycle %"FMT_ll"d, "
+		           "record of type %d for cycle %"FMT_ll"d was not used.\n",
+		           (long long)nCyclesMainCounter, nNextType, (long long)nNextCycle);
+		Journal_Close();
+		return false;
+	}
+	return nNextCycle == nCyclesMainCounter && nNextType == type;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Take the next record if it matches. Its data is kept in Data.
+ */
+static bool Journal_Take(int type)
+{
+	if (!Journal_Match(type))
+		return false;
+
+	memcpy(Data, NextData, nNextLen);
+	nDataLen = nNextLen;
+	Journal_ReadNext();
+	return true;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Open the journal configured for recording or replay. This has to be
+ * called before the machine is reset for the first time.
+ */
+void Journal_Init(void)
+{
+	char magic[sizeof(JOURNAL_MAGIC)];
+	int mode = ConfigureParams.Log.nJournalMode;
+	bool bRecord = (mode == JOURNAL_RECORD);
+
+	Journal_Close();
+	if (mode != JOURNAL_RECORD && mode != JOURNAL_REPLAY)
+		return;
+
+	JournalFile = fopen(ConfigureParams.Log.sJournalFileName, bRecord ? "wb" : "rb");
+	if (!JournalFile)
+	{
+		Log_Printf(LOG_ERROR, "[Journal] Unable to open '%s'.\n",
+		           ConfigureParams.Log.sJournalFileName);
+		return;
+	}
+	setvbuf(JournalFile, NULL, _IOFBF, JOURNAL_BUFFER_SIZE);
+
+	nLastCycle = 0;
+	nNextCycle = 0;
+	bInjecting = false;
+
+	if (bRecord)
+	{
+		strncpy(magic, JOURNAL_MAGIC, sizeof(magic));
+		magic[sizeof(magic) - 1] = JOURNAL_VERSION;
+		if (fwrite(magic, 1, sizeof(magic), JournalFile) != sizeof(magic))
+		{
+			Journal_Close();
+			return;
+		}
+		nJournalMode = JOURNAL_RECORD;
+		Log_Printf(LOG_WARN, "[Journal] Recording inputs to '%s'.\n",
+		           ConfigureParams.Log.sJournalFileName);
+	}
+	else
+	{
+		if (fread(magic, 1, sizeof(magic), JournalFile) != sizeof(magic) ||
+		    memcmp(magic, JOURNAL_MAGIC, sizeof(magic) - 1) ||
+		    magic[sizeof(magic) - 1] != JOURNAL_VERSION)
+		{
+			Log_Printf(LOG_ERROR, "[Journal] '%s' is not a journal of this version.\n",
+			           ConfigureParams.Log.sJournalFileName);
+			Journal_Close();
+			return;
+		}
+		nJournalMode = JOURNAL_REPLAY;
+		Log_Printf(LOG_WARN, "[Journal] Replaying inputs from '%s'.\n",
+		           ConfigureParams.Log.sJournalFileName);
+		Journal_ReadNext();
+	}
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Close the journal.
+ */
+void Journal_UnInit(void)
+{
+	Journal_Close();
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Check the journal mode.
+ */
+bool Journal_Active(void)
+{
+	return nJournalMode != JOURNAL_OFF;
+}
+
+bool Journal_Recording(void)
+{
+	return nJournalMode == JOURNAL_RECORD;
+}
+
+bool Journal_Replaying(void)
+{
+	return nJournalMode == JOURNAL_REPLAY;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Journal a host condition which is checked by the emulation. Returns if
+ * the condition happened on the host or in the recorded run.
+ */
+bool Journal_Event(int type, bool bHappened)
+{
+	switch (nJournalMode)
+	{
+	case JOURNAL_RECORD:
+		if (bHappened)
+			Journal_Write(type, NULL, 0);
+		break;
+	case JOURNAL_REPLAY:
+		if (Journal_Take(type))
+			return true;
+		if (nJournalMode == JOURNAL_REPLAY)
+			return false;
+		break;
+	}
+	return bHappened;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Journal a value read from the host. Returns the value from the host or
+ * from the recorded run.
+ */
+Sint64 Journal_Value(int type, Sint64 nValue)
+{
+	Uint8 buf[JOURNAL_MAX_NUMBER];
+	Uint64 n;
+
+	switch (nJournalMode)
+	{
+	case JOURNAL_RECORD:
+		Journal_Write(type, buf, Journal_EncodeNumber(buf, ZIGZAG(nValue)));
+		break;
+	case JOURNAL_REPLAY:
+		if (Journal_Take(type) && Journal_DecodeNumber(Data, nDataLen, &n))
+			return UNZIGZAG(n);
+		break;
+	}
+	return nValue;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Record data received from the host.
+ */
+void Journal_Record(int type, const void *pData, int nLen)
+{
+	if (nJournalMode == JOURNAL_RECORD)
+		Journal_Write(type, pData, nLen);
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Get data recorded for the current cycle. Returns the number of bytes
+ * copied or -1 if there is no such record.
+ */
+int Journal_Replay(int type, void *pData, int nMaxLen)
+{
+	if (!Journal_Take(type))
+		return -1;
+
+	if (nDataLen < nMaxLen)
+		nMaxLen = nDataLen;
+	memcpy(pData, Data, nMaxLen);
+	return nMaxLen;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Journal keyboard and mouse input. Returns false if the input comes from
+ * the host during replay and has to be ignored.
+ */
+bool Journal_Input(int type, int a, int b, int c, int d)
+{
+	Uint8 buf[4 * JOURNAL_MAX_NUMBER];
+	int n;
+
+	switch (nJournalMode)
+	{
+	case JOURNAL_RECORD:
+		n  = Journal_EncodeNumber(buf, ZIGZAG(a));
+		n += Journal_EncodeNumber(buf + n, ZIGZAG(b));
+		n += Journal_EncodeNumber(buf + n, ZIGZAG(c));
+		n += Journal_EncodeNumber(buf + n, ZIGZAG(d));
+		Journal_Write(type, buf, n);
+		break;
+	case JOURNAL_REPLAY:
+		return bInjecting;
+	}
+	return true;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Deliver keyboard and mouse input recorded for the current cycle. This is
+ * called from the event handler, where host input is processed.
+ */
+void Journal_ReplayInput(void)
+{
+	Uint64 n;
+	int arg[4];
+	int type, pos, len, i;
+
+	while (nJournalMode == JOURNAL_REPLAY && nNextType <= JOURNAL_MOUSE_BUTTON)
+	{
+		type = nNextType;
+		if (!Journal_Take(type))
+			break;
+
+		for (i = 0, pos = 0; i < 4; i++, pos += len)
+		{
+			len = Journal_DecodeNumber(Data + pos, nDataLen - pos, &n);
+			arg[i] = len ? UNZIGZAG(n) : 0;
+		}
+
+		bInjecting = true;
+		switch (type)
+		{
+		case JOURNAL_KEYDOWN:
+			kms_keydown(arg[0], arg[1]);
+			break;
+		case JOURNAL_KEYUP:
+			kms_keyup(arg[0], arg[1]);
+			break;
+		case JOURNAL_MOUSE_MOVE:
+			kms_mouse_move(arg[0], arg[1], arg[2], arg[3]);
+			break;
+		case JOURNAL_MOUSE_BUTTON:
+			kms_mouse_button(arg[0], arg[1]);
+			break;
+		}
+		bInjecting = false;
+	}
+}
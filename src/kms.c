@@ -20,6 +20,8 @@
 #include "snd.h"
 #include "video.h"
 #include "host.h"
+#include "memorySnapShot.h"
+#include "journal.h"
 
 #define LOG_KMS_LEVEL LOG_DEBUG
 #define IO_SEG_MASK	0x1FFFF
@@ -440,6 +442,9 @@ static bool kms_device_enabled(int dev_addr) {
 }
 
 void kms_keydown(Uint8 modkeys, Uint8 keycode) {
+    if (!Journal_Input(JOURNAL_KEYDOWN, modkeys, keycode, 0, 0))
+        return;
+    
     if ((keycode==0x26)&&(modkeys&0x18)) { /* backquote and one or both command keys */
         Log_Printf(LOG_WARN, "Keyboard initiated NMI!");
         set_interrupt(INT_NMI, SET_INT);
@@ -467,6 +472,9 @@ void kms_keydown(Uint8 modkeys, Uint8 keycode) {
 }
 
 void kms_keyup(Uint8 modkeys, Uint8 keycode) {
+    if (!Journal_Input(JOURNAL_KEYUP, modkeys, keycode, 0, 0))
+        return;
+    
     if (keycode==0x58) {
         rtc_stop_pdown_request();
         return;
@@ -482,6 +490,9 @@ void kms_keyup(Uint8 modkeys, Uint8 keycode) {
 }
 
 void kms_mouse_button(bool left, bool down) {
+    if (!Journal_Input(JOURNAL_MOUSE_BUTTON, left, down, 0, 0))
+        return;
+    
     if (left) {
         m_button_left = down;
     } else {
@@ -503,6 +514,9 @@ void kms_mouse_button(bool left, bool down) {
 void kms_mouse_move(int x, bool left, int y, bool up) {
     if (x<0 || y<0) abort();
     
+    if (!Journal_Input(JOURNAL_MOUSE_MOVE, x, left, y, up))
+        return;
+    
     m_move_left = left;
     m_move_up   = up;
 
@@ -560,3 +574,18 @@ void Mouse_Handler(void) {
         CycInt_AddRelativeInterruptUs((1000*1000)/MOUSE_STEP_FREQ, 0, INTERRUPT_MOUSE);
     }
 }
+
+/* Save/restore interface registers and a mouse movement in progress */
+void KMS_MemorySnapShot_Capture(bool bSave) {
+    MemorySnapShot_Store(&kms, sizeof(kms));
+    MemorySnapShot_Store(&km_address, sizeof(km_address));
+    MemorySnapShot_Store(&km_dev_msk, sizeof(km_dev_msk));
+    MemorySnapShot_Store(&m_button_right, sizeof(m_button_right));
+    MemorySnapShot_Store(&m_button_left, sizeof(m_button_left));
+    MemorySnapShot_Store(&m_move_left, sizeof(m_move_left));
+    MemorySnapShot_Store(&m_move_up, sizeof(m_move_up));
+    MemorySnapShot_Store(&m_move_x, sizeof(m_move_x));
+    MemorySnapShot_Store(&m_move_y, sizeof(m_move_y));
+    MemorySnapShot_Store(&m_move_dx, sizeof(m_move_dx));
+    MemorySnapShot_Store(&m_move_dy, sizeof(m_move_dy));
+}
@@ -14,8 +14,11 @@ const char M68000_fileid[] = "Hatari m68000.c : " __DATE__ " " __TIME__;
 #include "hatari-glue.h"
 #include "cycInt.h"
 #include "m68000.h"
+#include "memorySnapShot.h"
 
 #include "mmu_common.h"
+#include "cpummu.h"
+#include "cpummu030.h"
 
 Uint32 BusErrorAddress;         /* Stores the offending address for bus-/address errors */
 Uint32 BusErrorPC;              /* Value of the PC when bus error occurs */
@@ -25,6 +28,7 @@ int BusMode = BUS_MODE_CPU;	/* Used to tell which part is owning the bus (cpu, b
 int LastOpcodeFamily = i_NOP;	/* see the enum in readcpu.h i_XXX */
 int LastInstrCycles = 0;	/* number of cycles for previous instr. (not rounded to 4) */
 int Pairing = 0;		/* set to 1 if the latest 2 intr paired */
+Uint64 nCpuInstructions = 0;	/* number of executed instructions, for batch reports */
 char PairingArray[ MAX_OPCODE_FAMILY ][ MAX_OPCODE_FAMILY ];
 
 
@@ -141,6 +145,39 @@ void M68000_Init(void)
 
 static int pendingInterrupts = 0;
 
+/*-----------------------------------------------------------------------*/
+/**
+ * Save/Restore snapshot of CPU variables ('MemorySnapShot_Store' handles type)
+ */
+void M68000_MemorySnapShot_Capture(bool bSave)
+{
+	/* Keep pending requests to leave the CPU loop */
+	int spcFlags = regs.spcflags & (SPCFLAG_MODE_CHANGE | SPCFLAG_BRK);
+
+	if (bSave) {
+		regs.pc = m68k_getpc();
+		regs.pc_p = regs.pc_oldp = NULL;
+	}
+	MemorySnapShot_Store(&regs, sizeof(regs));
+	MemorySnapShot_Store(&regflags, sizeof(regflags));
+	MemorySnapShot_Store(&BusErrorAddress, sizeof(BusErrorAddress));
+	MemorySnapShot_Store(&BusErrorPC, sizeof(BusErrorPC));
+	MemorySnapShot_Store(&bBusErrorReadWrite, sizeof(bBusErrorReadWrite));
+	MemorySnapShot_Store(&BusMode, sizeof(BusMode));
+	MemorySnapShot_Store(&pendingInterrupts, sizeof(pendingInterrupts));
+	mmu030_MemorySnapShot_Capture(bSave);
+
+	if (!bSave) {
+		regs.pc_p = regs.pc_oldp = NULL;
+		regs.spcflags = (regs.spcflags & ~(SPCFLAG_MODE_CHANGE | SPCFLAG_BRK)) | spcFlags;
+		if (currprefs.mmu_model == 68040) {
+			/* The 68040 ATC is only a cache of the translation tables */
+			mmu_set_tc(regs.tcr);
+			mmu_set_super(regs.s != 0);
+		}
+	}
+}
+
 /*-----------------------------------------------------------------------*/
 /**
  * Reset CPU 68000 variables
@@ -31,7 +31,14 @@ const char Main_fileid[] = "Hatari main.c : " __DATE__ " " __TIME__;
 #include "audio.h"
 #include "debugui.h"
 #include "file.h"
+#include "memorySnapShot.h"
+#include "worker.h"
+#include "journal.h"
+#include "batch.h"
+#include "options.h"
 #include "dsp.h"
+#include "ethernet.h"
+#include "printer.h"
 #include "host.h"
 #include "dimension.hpp"
 
@@ -52,6 +59,10 @@ static bool bIgnoreNextMouseMotion = false;  /* Next mouse motion will be ignore
 
 volatile int mainPauseEmulation;
 
+#define THROTTLE_PERIOD_US    1000   /* check pacing every emulated ms */
+#define THROTTLE_MAX_SLEEP_US 10000
+#define THROTTLE_COARSE_US    10000
+
 typedef const char* (*report_func)(double realTime, double hostTime);
 
 typedef struct {
@@ -289,11 +300,7 @@ void Main_EventHandler(void) {
         }
         
         if (bEmulationActive) {
-            double time_offset = host_real_time_offset() * 1000;
-            if(time_offset > 10)
-                events = SDL_WaitEventTimeout(&event, time_offset);
-            else
-                events = SDL_PollEvent(&event);
+            events = SDL_PollEvent(&event);
         }
         else {
             ShortCut_ActKey();
@@ -385,7 +392,35 @@ void Main_EventHandler(void) {
 void Main_EventHandlerInterrupt() {
     CycInt_AcknowledgeInterrupt();
     Main_EventHandler();
+    Journal_ReplayInput();
+    Batch_Check();
     CycInt_AddRelativeInterruptUs((1000*1000)/200, 0, INTERRUPT_EVENT_LOOP); // poll events with 200 Hz
+
+    /* A reset from within the event handler clears all interrupts */
+    if (!CycInt_InterruptActive(INTERRUPT_THROTTLE))
+        CycInt_AddRelativeInterruptUsCycles(THROTTLE_PERIOD_US, 0, INTERRUPT_THROTTLE);
+}
+
+/* ----------------------------------------------------------------------- */
+/**
+ * Keep emulated time from running ahead of real time. This runs on emulated
+ * cycles independent of event polling, so it sleeps in small steps instead of
+ * blocking input handling. Hosts without accurate delays only sleep once the
+ * emulation is ahead by more than the delay granularity.
+ */
+void Main_ThrottleInterrupt(void) {
+    CycInt_AcknowledgeInterrupt();
+
+    /* Batch runs go as fast as possible */
+    if (bEmulationActive && !Batch_IsActive()) {
+        Sint64 offset = host_real_time_offset() * 1000 * 1000;
+        if (offset > (bAccurateDelays ? 0 : THROTTLE_COARSE_US)) {
+            if (offset > THROTTLE_MAX_SLEEP_US)
+                offset = THROTTLE_MAX_SLEEP_US;
+            host_sleep_us(offset);
+        }
+    }
+    CycInt_AddRelativeInterruptUsCycles(THROTTLE_PERIOD_US, 0, INTERRUPT_THROTTLE);
 }
 
 /*-----------------------------------------------------------------------*/
@@ -426,7 +461,8 @@ static void Main_Init(void) {
 	Keymap_Init();
 
     /* call menu at startup */
-    if (!File_Exists(sConfigFileName) || ConfigureParams.ConfigDialog.bShowConfigDialogAtStartup) {
+    if (!Batch_IsActive() &&
+        (!File_Exists(sConfigFileName) || ConfigureParams.ConfigDialog.bShowConfigDialogAtStartup)) {
         Dialog_DoProperty();
         if (bQuitProgram) {
             SDL_Quit();
@@ -434,13 +470,18 @@ static void Main_Init(void) {
         }
     }
 
-    Dialog_CheckFiles();
+    /* Missing files can not be selected in batch mode */
+    if (!Batch_IsActive())
+        Dialog_CheckFiles();
     
     if (bQuitProgram) {
         SDL_Quit();
         exit(-2);
     }
     
+    /* Inputs are journaled from the first reset on */
+    Journal_Init();
+    
     Reset_Cold();
     
 	IoMem_Init();
@@ -459,14 +500,18 @@ static void Main_Init(void) {
  */
 static void Main_UnInit(void) {
 	Screen_ReturnFromFullScreen();
+	DSP_UnInit();
 	IoMem_UnInit();
 	SDLGui_UnInit();
 	Screen_UnInit();
+	Printer_UnInit();
 	Exit680x0();
 
 	/* SDL uninit: */
 	SDL_Quit();
 
+	Journal_UnInit();
+
 	/* Close debug log file */
 	Log_UnInit();
 }
@@ -564,13 +609,11 @@ int main(int argc, char *argv[]) {
 	/* Now load the values from the configuration file */
 	Main_LoadInitialConfig();
     
-#if 0 /* FIXME: This sometimes causes exits when starting from application bundles */
 	/* Check for any passed parameters */
 	if (!Opt_ParseParameters(argc, (const char * const *)argv))
 	{
 		return 1;
 	}
-#endif
 	/* monitor type option might require "reset" -> true */
 	Configuration_Apply(true);
 
@@ -583,11 +626,29 @@ int main(int argc, char *argv[]) {
 	 */
 #if HAVE_SETENV
 	setenv("SDL_VIDEO_X11_WMCLASS", "previous", 1);
+	/* Batch runs have no window, unless another driver is asked for */
+	if (Batch_IsActive())
+		setenv("SDL_VIDEODRIVER", "dummy", 0);
 #endif
 
 	/* Init emulator system */
 	Main_Init();
 
+	/* Continue where the last session ended */
+	if ((ConfigureParams.Memory.bAutoSave || ConfigureParams.Memory.nForkWorkers > 0) &&
+	    File_Exists(ConfigureParams.Memory.szMemoryCaptureFileName))
+	{
+		MemorySnapShot_Restore(ConfigureParams.Memory.szMemoryCaptureFileName, false);
+	}
+
+	/* Run the machine in worker processes, the parent only waits for them */
+	if (ConfigureParams.Memory.nForkWorkers > 0 &&
+	    Worker_Fork(ConfigureParams.Memory.nForkWorkers) == 0)
+	{
+		Main_UnInit();
+		return Worker_ExitStatus();
+	}
+
 	/* Set initial Statusbar information */
 	Main_StatusbarSetup();
 	
@@ -597,11 +658,18 @@ int main(int argc, char *argv[]) {
 
 	/* Run emulation */
 	Main_UnPauseEmulation();
+	Batch_Start();
 	M68000_Start();                 /* Start emulation */
 
+	Batch_Report();
+
+	if (ConfigureParams.Memory.bAutoSave)
+	{
+		MemorySnapShot_Capture(ConfigureParams.Memory.szMemoryCaptureFileName, false);
+	}
 
 	/* Un-init emulation system */
 	Main_UnInit();
 
-	return 0;
+	return Batch_ExitStatus();
 }
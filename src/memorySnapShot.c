@@ -0,0 +1,590 @@
+/*
+  Previous - memorySnapShot.c
+
+  This file is distributed under the GNU Public License, version 2 or at
+  your option any later version. Read the file gpl.txt for details.
+
+  Memory snapshot
+
+  This handles saving and restoring the state of the emulated machine. Each
+  module provides a function <module>_MemorySnapShot_Capture(bool bSave)
+  which passes its variables to MemorySnapShot_Store() in a fixed order, so
+  the same code saves and restores them. The stream is compressed with zlib
+  if it is available.
+
+  Emulated memory is stored in pages. A full snapshot skips pages which are
+  zero, an incremental snapshot only contains the pages which changed since
+  the snapshot it is based on. Restoring an incremental snapshot restores its
+  base first, so a chain of incremental snapshots always ends with a full one.
+  Each snapshot has a random ID and incremental snapshots record the ID of
+  their base, so a base which has been replaced is not used.
+
+  Not part of a snapshot are the contents of disk images, connections of the
+  host network stack, pages which are being printed and NeXTdimension boards.
+*/
+const char MemorySnapShot_fileid[] = "Previous memorySnapShot.c : " __DATE__ " " __TIME__;
+
+#include <string.h>
+#include <time.h>
+
+#include "main.h"
+#if HAVE_LIBZ
+#include <zlib.h>
+#endif
+#include "configuration.h"
+#include "cycInt.h"
+#include "dialog.h"
+#include "file.h"
+#include "host.h"
+#include "m68000.h"
+#include "memorySnapShot.h"
+#include "reset.h"
+#include "statusbar.h"
+#include "sysReg.h"
+#include "tmc.h"
+#include "nbic.h"
+#include "bmap.h"
+#include "adb.h"
+#include "dma.h"
+#include "esp.h"
+#include "scsi.h"
+#include "mo.h"
+#include "floppy.h"
+#include "scc.h"
+#include "kms.h"
+#include "ethernet.h"
+#include "snd.h"
+#include "rtcnvram.h"
+#include "printer.h"
+#include "dsp.h"
+
+
+#define SNAPSHOT_MAGIC          "PREVSNAP"
+#define SNAPSHOT_VERSION        2       /* Increase if the stream layout changes */
+#define SNAPSHOT_INCREMENTAL    0x0001
+#define SNAPSHOT_MAX_CHAIN      64      /* Limit for incremental snapshots based on each other */
+#define SNAPSHOT_END_OF_PAGES   0xFFFFFFFF
+#define SNAPSHOT_END_MARKER     0x454E4421
+
+#if HAVE_LIBZ
+#define SNAPSHOT_FILE           gzFile
+#else
+#define SNAPSHOT_FILE           FILE*
+#endif
+
+static SNAPSHOT_FILE CaptureFile;
+static bool bCaptureSave;
+static bool bCaptureError;
+static bool bCaptureIncremental;    /* Only store pages which changed since the base snapshot */
+static int  nRestoreDepth;
+static bool bRestoreStarted;        /* The machine has been modified by the restore */
+
+/* Page hashes describe the last snapshot written or restored in this session */
+static bool bHashesValid = false;
+static char szLastSnapShot[FILENAME_MAX];
+static Uint64 nLastSnapShotId;
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Open snapshot file for reading or writing.
+ */
+static bool MemorySnapShot_OpenFile(const char *pszFileName, bool bSave)
+{
+#if HAVE_LIBZ
+	/* Favour speed over size, a booted system has a lot of memory in use */
+	CaptureFile = gzopen(pszFileName, bSave ? "wb1" : "rb");
+#else
+	CaptureFile = fopen(pszFileName, bSave ? "wb" : "rb");
+#endif
+	if (!CaptureFile)
+	{
+		Log_Printf(LOG_WARN, "[Snapshot] Unable to open '%s'.\n", pszFileName);
+		return false;
+	}
+	bCaptureSave  = bSave;
+	bCaptureError = false;
+	return true;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Close snapshot file. Returns false if any access to it failed.
+ */
+static bool MemorySnapShot_CloseFile(void)
+{
+#if HAVE_LIBZ
+	if (gzclose(CaptureFile) != Z_OK)
+		bCaptureError = true;
+#else
+	if (fclose(CaptureFile) != 0)
+		bCaptureError = true;
+#endif
+	CaptureFile = NULL;
+	return !bCaptureError;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Save/restore data to/from snapshot file.
+ */
+void MemorySnapShot_Store(void *pData, int Size)
+{
+	int nBytes;
+
+	if (bCaptureError)
+		return;
+
+#if HAVE_LIBZ
+	if (bCaptureSave)
+		nBytes = gzwrite(CaptureFile, pData, Size);
+	else
+		nBytes = gzread(CaptureFile, pData, Size);
+#else
+	if (bCaptureSave)
+		nBytes = fwrite(pData, 1, Size, CaptureFile);
+	else
+		nBytes = fread(pData, 1, Size, CaptureFile);
+#endif
+	if (nBytes != Size)
+	{
+		Log_Printf(LOG_WARN, "[Snapshot] Unable to %s %d bytes.\n",
+		           bCaptureSave ? "write" : "read", Size);
+		bCaptureError = true;
+	}
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Hash a page of emulated memory and tell if it contains only zeros. The
+ * four lanes are independent to keep the multiplier busy.
+ */
+static Uint64 MemorySnapShot_HashPage(const Uint8 *pPage, bool *pbZero)
+{
+	const Uint64 *p = (const Uint64 *)pPage;
+	const Uint64 k = 0x9E3779B97F4A7C15ULL;
+	Uint64 h0 = 0, h1 = 1, h2 = 2, h3 = 3, any = 0;
+	int i;
+
+	for (i = 0; i < SNAPSHOT_PAGE_SIZE / 8; i += 4)
+	{
+		h0 = (h0 ^ p[i+0]) * k;
+		h1 = (h1 ^ p[i+1]) * k;
+		h2 = (h2 ^ p[i+2]) * k;
+		h3 = (h3 ^ p[i+3]) * k;
+		any |= p[i+0] | p[i+1] | p[i+2] | p[i+3];
+	}
+	*pbZero = (any == 0);
+
+	h0 ^= (h1 << 16 | h1 >> 48) ^ (h2 << 32 | h2 >> 32) ^ (h3 << 48 | h3 >> 16);
+	h0 ^= h0 >> 29;
+	return h0 * k;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Save/restore a block of emulated memory as a list of pages. Each page is
+ * stored with its index, the list ends with SNAPSHOT_END_OF_PAGES. The hash
+ * table is allocated on first use and remembers the page contents of the
+ * last snapshot for incremental snapshots. Pages missing from a full snapshot
+ * are zero, which is how memory is left by the cold reset before restoring.
+ */
+void MemorySnapShot_StorePages(Uint8 *pMem, Uint32 nSize, Uint64 **ppHashes)
+{
+	Uint32 nPages = nSize / SNAPSHOT_PAGE_SIZE;
+	Uint32 nIndex;
+	Uint64 *pHashes;
+	Uint64 hash;
+	bool bZero;
+
+	if (*ppHashes == NULL)
+	{
+		*ppHashes = calloc(nPages, sizeof(Uint64));
+		if (*ppHashes == NULL)
+		{
+			bCaptureError = true;
+			return;
+		}
+	}
+	pHashes = *ppHashes;
+
+	if (bCaptureSave)
+	{
+		for (nIndex = 0; nIndex < nPages && !bCaptureError; nIndex++)
+		{
+			hash = MemorySnapShot_HashPage(pMem + nIndex * SNAPSHOT_PAGE_SIZE, &bZero);
+			if (bCaptureIncremental ? hash == pHashes[nIndex] : bZero)
+			{
+				pHashes[nIndex] = hash;
+				continue;
+			}
+			pHashes[nIndex] = hash;
+			MemorySnapShot_Store(&nIndex, sizeof(nIndex));
+			MemorySnapShot_Store(pMem + nIndex * SNAPSHOT_PAGE_SIZE, SNAPSHOT_PAGE_SIZE);
+		}
+		nIndex = SNAPSHOT_END_OF_PAGES;
+		MemorySnapShot_Store(&nIndex, sizeof(nIndex));
+		return;
+	}
+
+	for (;;)
+	{
+		MemorySnapShot_Store(&nIndex, sizeof(nIndex));
+		if (bCaptureError || nIndex == SNAPSHOT_END_OF_PAGES)
+			break;
+		if (nIndex >= nPages)
+		{
+			Log_Printf(LOG_WARN, "[Snapshot] Invalid page %u.\n", nIndex);
+			bCaptureError = true;
+			break;
+		}
+		MemorySnapShot_Store(pMem + nIndex * SNAPSHOT_PAGE_SIZE, SNAPSHOT_PAGE_SIZE);
+	}
+
+	/* Only the end of a chain of snapshots leaves memory in its final state */
+	if (nRestoreDepth == 0)
+	{
+		for (nIndex = 0; nIndex < nPages; nIndex++)
+			pHashes[nIndex] = MemorySnapShot_HashPage(pMem + nIndex * SNAPSHOT_PAGE_SIZE, &bZero);
+	}
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Create an ID for a new snapshot. It only needs to differ from the IDs of
+ * other snapshots which may be saved under the same file name.
+ */
+static Uint64 MemorySnapShot_NewId(void)
+{
+	static Uint64 nCount;
+	const Uint64 k = 0x9E3779B97F4A7C15ULL;
+	Uint64 id;
+
+	id  = ((Uint64)time(NULL) << 32) ^ host_time_us() ^ ++nCount;
+	id *= k;
+	id ^= id >> 29;
+	return id * k;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Save/restore the file header. Snapshots are only compatible with the
+ * version of Previous which created them, because they contain the raw
+ * structures of the emulated devices.
+ */
+static bool MemorySnapShot_Header(char *szBase, Uint64 *pnId, Uint64 *pnBaseId, int *pnFlags)
+{
+	char   szMagic[8];
+	char   szProgName[32];
+	Uint32 nVersion = SNAPSHOT_VERSION;
+	Uint32 nFlags   = *pnFlags;
+	Uint32 nLength  = strlen(szBase);
+
+	memcpy(szMagic, SNAPSHOT_MAGIC, sizeof(szMagic));
+	memset(szProgName, 0, sizeof(szProgName));
+	strncpy(szProgName, PROG_NAME, sizeof(szProgName) - 1);
+
+	MemorySnapShot_Store(szMagic, sizeof(szMagic));
+	MemorySnapShot_Store(&nVersion, sizeof(nVersion));
+	MemorySnapShot_Store(szProgName, sizeof(szProgName));
+	MemorySnapShot_Store(&nFlags, sizeof(nFlags));
+	MemorySnapShot_Store(pnId, sizeof(*pnId));
+	if (bCaptureError)
+		return false;
+
+	if (memcmp(szMagic, SNAPSHOT_MAGIC, sizeof(szMagic)) ||
+	    nVersion != SNAPSHOT_VERSION ||
+	    strncmp(szProgName, PROG_NAME, sizeof(szProgName)))
+	{
+		Log_Printf(LOG_WARN, "[Snapshot] File is not a snapshot of this version of %s.\n", PROG_NAME);
+		bCaptureError = true;
+		return false;
+	}
+	*pnFlags = nFlags;
+
+	if (nFlags & SNAPSHOT_INCREMENTAL)
+	{
+		MemorySnapShot_Store(pnBaseId, sizeof(*pnBaseId));
+		MemorySnapShot_Store(&nLength, sizeof(nLength));
+		if (nLength >= FILENAME_MAX)
+		{
+			bCaptureError = true;
+			return false;
+		}
+		MemorySnapShot_Store(szBase, nLength);
+		szBase[nLength] = '\0';
+	}
+	return !bCaptureError;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Save/restore the state of all modules. Incremental snapshots do not
+ * contain the configuration, it is the same as in their base.
+ */
+static void MemorySnapShot_CaptureState(bool bSave)
+{
+	Uint32 nMarker = SNAPSHOT_END_MARKER;
+
+	if (!bSave)
+		bRestoreStarted = true;
+
+	if (!bCaptureIncremental)
+		Configuration_MemorySnapShot_Capture(bSave);
+	M68000_MemorySnapShot_Capture(bSave);
+	memory_MemorySnapShot_Capture(bSave);
+	bmap_MemorySnapShot_Capture(bSave);
+	CycInt_MemorySnapShot_Capture(bSave);
+	SCR_MemorySnapShot_Capture(bSave);
+	TMC_MemorySnapShot_Capture(bSave);
+	nbic_MemorySnapShot_Capture(bSave);
+	ADB_MemorySnapShot_Capture(bSave);
+	DMA_MemorySnapShot_Capture(bSave);
+	ESP_MemorySnapShot_Capture(bSave);
+	SCSI_MemorySnapShot_Capture(bSave);
+	MO_MemorySnapShot_Capture(bSave);
+	Floppy_MemorySnapShot_Capture(bSave);
+	SCC_MemorySnapShot_Capture(bSave);
+	KMS_MemorySnapShot_Capture(bSave);
+	Ethernet_MemorySnapShot_Capture(bSave);
+	Sound_MemorySnapShot_Capture(bSave);
+	RTC_MemorySnapShot_Capture(bSave);
+	Printer_MemorySnapShot_Capture(bSave);
+	DSP_MemorySnapShot_Capture(bSave);
+
+	MemorySnapShot_Store(&nMarker, sizeof(nMarker));
+	if (nMarker != SNAPSHOT_END_MARKER)
+	{
+		Log_Printf(LOG_WARN, "[Snapshot] File is corrupted.\n");
+		bCaptureError = true;
+	}
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Check if the current machine can be saved.
+ */
+static bool MemorySnapShot_CanCapture(void)
+{
+	int i;
+
+	for (i = 0; i < ND_MAX_BOARDS; i++)
+	{
+		if (ConfigureParams.Dimension.board[i].bEnabled)
+		{
+			Log_AlertDlg(LOG_ERROR, "Snapshots of NeXTdimension boards are not supported.");
+			return false;
+		}
+	}
+	return true;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Save snapshot to file. If bIncremental is set and there is a snapshot
+ * of this session to base it on, only store changed memory pages.
+ */
+static bool MemorySnapShot_CaptureFile(const char *pszFileName, bool bConfirm, bool bIncremental)
+{
+	char   szBase[FILENAME_MAX];
+	int    nFlags = 0;
+	Uint64 nId = MemorySnapShot_NewId();
+	Uint64 nBaseId = 0;
+
+	if (!MemorySnapShot_CanCapture())
+		return false;
+
+	bCaptureIncremental = bIncremental && bHashesValid;
+	if (bCaptureIncremental && strcmp(pszFileName, szLastSnapShot) == 0)
+	{
+		/* Overwriting the base would break the chain */
+		bCaptureIncremental = false;
+	}
+	if (bCaptureIncremental)
+	{
+		nFlags |= SNAPSHOT_INCREMENTAL;
+		strcpy(szBase, szLastSnapShot);
+		nBaseId = nLastSnapShotId;
+	}
+	else
+	{
+		szBase[0] = '\0';
+	}
+
+	if (!MemorySnapShot_OpenFile(pszFileName, true))
+		return false;
+
+	MemorySnapShot_Header(szBase, &nId, &nBaseId, &nFlags);
+	MemorySnapShot_CaptureState(true);
+
+	if (!MemorySnapShot_CloseFile())
+	{
+		bHashesValid = false;
+		Log_AlertDlg(LOG_ERROR, "Unable to save memory snapshot to '%s'.", pszFileName);
+		return false;
+	}
+
+	bHashesValid = true;
+	snprintf(szLastSnapShot, sizeof(szLastSnapShot), "%s", pszFileName);
+	nLastSnapShotId = nId;
+
+	Log_Printf(LOG_WARN, "[Snapshot] Saved %s snapshot '%s'.\n",
+	           bCaptureIncremental ? "incremental" : "full", pszFileName);
+	if (bConfirm)
+		Statusbar_AddMessage("Memory snapshot saved.", 0);
+	return true;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Save full snapshot to file.
+ */
+bool MemorySnapShot_Capture(const char *pszFileName, bool bConfirm)
+{
+	return MemorySnapShot_CaptureFile(pszFileName, bConfirm, false);
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Save incremental snapshot to file, based on the last snapshot which has
+ * been saved or restored. Falls back to a full snapshot if there is none.
+ */
+bool MemorySnapShot_CaptureIncremental(const char *pszFileName, bool bConfirm)
+{
+	return MemorySnapShot_CaptureFile(pszFileName, bConfirm, true);
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Restore snapshot file and, for incremental snapshots, its bases. If
+ * bCheckId is set, the file must have the ID in *pnId, otherwise its ID
+ * is returned in *pnId.
+ */
+static bool MemorySnapShot_RestoreFile(const char *pszFileName, Uint64 *pnId, bool bCheckId)
+{
+	char   szBase[FILENAME_MAX];
+	int    nFlags = 0;
+	Uint64 nId = 0;
+	Uint64 nBaseId = 0;
+	bool   bOk;
+
+	szBase[0] = '\0';
+	if (!MemorySnapShot_OpenFile(pszFileName, false))
+		return false;
+
+	if (!MemorySnapShot_Header(szBase, &nId, &nBaseId, &nFlags))
+	{
+		MemorySnapShot_CloseFile();
+		return false;
+	}
+	if (bCheckId && nId != *pnId)
+	{
+		Log_Printf(LOG_WARN, "[Snapshot] '%s' is not the snapshot the next one is based on.\n", pszFileName);
+		MemorySnapShot_CloseFile();
+		return false;
+	}
+	*pnId = nId;
+
+	bCaptureIncremental = (nFlags & SNAPSHOT_INCREMENTAL) != 0;
+	if (bCaptureIncremental)
+	{
+		SNAPSHOT_FILE File = CaptureFile;
+
+		if (nRestoreDepth >= SNAPSHOT_MAX_CHAIN)
+		{
+			Log_Printf(LOG_WARN, "[Snapshot] Too many incremental snapshots.\n");
+			MemorySnapShot_CloseFile();
+			return false;
+		}
+		nRestoreDepth++;
+		bOk = MemorySnapShot_RestoreFile(szBase, &nBaseId, true);
+		nRestoreDepth--;
+
+		CaptureFile = File;
+		bCaptureSave = false;
+		bCaptureIncremental = true;
+		if (!bOk)
+		{
+			Log_Printf(LOG_WARN, "[Snapshot] Unable to restore base '%s' of '%s'.\n", szBase, pszFileName);
+			MemorySnapShot_CloseFile();
+			return false;
+		}
+	}
+
+	MemorySnapShot_CaptureState(false);
+	return MemorySnapShot_CloseFile();
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Restore snapshot from file. A snapshot which fails to restore after the
+ * machine has been modified leaves it in an undefined state, so it is reset
+ * in that case.
+ */
+bool MemorySnapShot_Restore(const char *pszFileName, bool bConfirm)
+{
+	Uint64 nId = 0;
+
+	if (!File_Exists(pszFileName))
+	{
+		Log_AlertDlg(LOG_ERROR, "Memory snapshot '%s' does not exist.", pszFileName);
+		return false;
+	}
+	if (bConfirm && !DlgAlert_Query("Restore memory snapshot? The current state of the machine will be lost."))
+		return false;
+
+	bHashesValid    = false;
+	bRestoreStarted = false;
+	nRestoreDepth   = 0;
+	if (!MemorySnapShot_RestoreFile(pszFileName, &nId, false))
+	{
+		Log_AlertDlg(LOG_ERROR, "Unable to restore memory snapshot from '%s'.", pszFileName);
+		if (bRestoreStarted)
+			Reset_Cold();
+		return false;
+	}
+
+	bHashesValid = true;
+	snprintf(szLastSnapShot, sizeof(szLastSnapShot), "%s", pszFileName);
+	nLastSnapShotId = nId;
+
+	Log_Printf(LOG_WARN, "[Snapshot] Restored '%s'.\n", pszFileName);
+	if (bConfirm)
+		Statusbar_AddMessage("Memory snapshot restored.", 0);
+	return true;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Forget the base for incremental snapshots. This is called on cold reset,
+ * because the configuration of the machine may have changed.
+ */
+void MemorySnapShot_Reset(void)
+{
+	bHashesValid = false;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Return the name of the last snapshot saved or restored in this session,
+ * or NULL if there is none.
+ */
+const char* MemorySnapShot_LastFileName(void)
+{
+	return bHashesValid ? szLastSnapShot : NULL;
+}
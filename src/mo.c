@@ -28,6 +28,7 @@
 #include "file.h"
 #include "rs.h"
 #include "statusbar.h"
+#include "memorySnapShot.h"
 
 
 #define LOG_MO_REG_LEVEL    LOG_DEBUG
@@ -60,6 +61,10 @@ struct {
 } mo;
 int sector_counter;
 
+/* Statistics for batch reports */
+Uint64 nMOSectorsRead;
+Uint64 nMOSectorsWritten;
+
 struct {
     Uint16 status;
     Uint16 dstat;
@@ -201,6 +206,21 @@ void MO_Uninit(void);
 #define SECTOR_IO_DELAY 1250
 #define CMD_DELAY       40
 
+/* Timing profiles: fast divides mechanical delays, instant limits them */
+#define MO_FAST_DIVISOR 4
+#define MO_INSTANT_TIME 100
+
+static int mo_timing(int delay) {
+    switch (ConfigureParams.MO.nTiming) {
+        case TIMING_FAST:
+            return delay / MO_FAST_DIVISOR;
+        case TIMING_INSTANT:
+            return delay < MO_INSTANT_TIME ? delay : MO_INSTANT_TIME;
+        default:
+            return delay;
+    }
+}
+
 #define SEEK_TIMING 1
 
 static void mo_set_signals(bool complete, bool attn, int delay);
@@ -811,7 +831,7 @@ void mo_formatter_cmd2(void) {
  *
  */
 
-#define ECC_DELAY SECTOR_IO_DELAY/5 /* must be a fraction of sector delay */
+#define ECC_DELAY (mo_timing(SECTOR_IO_DELAY)/5) /* must be a fraction of sector delay */
 
 bool ecc_repeat=false; /* This is for ECC blocks */
 
@@ -1029,6 +1049,7 @@ void mo_read_sector(Uint32 sector_id) {
                dnum, sector_num, sector_counter-1);
     
     File_Read(ecc_buffer[eccin].data, MO_SECTORSIZE_DISK, sector_num*MO_SECTORSIZE_DISK, modrv[dnum].dsk);
+    nMOSectorsRead++;
     
     ecc_buffer[eccin].limit = ecc_buffer[eccin].size = MO_SECTORSIZE_DISK;
 }
@@ -1041,6 +1062,7 @@ void mo_write_sector(Uint32 sector_id) {
     
     if (ecc_buffer[eccout].limit==MO_SECTORSIZE_DISK) {
         File_Write(ecc_buffer[eccout].data, MO_SECTORSIZE_DISK, sector_num*MO_SECTORSIZE_DISK, modrv[dnum].dsk);
+        nMOSectorsWritten++;
 
         ecc_buffer[eccout].size = 0;
         ecc_buffer[eccout].limit = MO_SECTORSIZE_DATA;
@@ -1328,7 +1350,7 @@ void mo_seek(Uint16 command) {
     }
     seek_time+=5000;
 
-    mo_set_signals(true, false, seek_time);
+    mo_set_signals(true, false, mo_timing(seek_time));
 #else
     mo_set_signals(true, false, CMD_DELAY);
 #endif
@@ -1554,7 +1576,7 @@ void mo_start_spiraling(void) {
     }
 
     if (!modrv[0].spiraling && !modrv[1].spiraling) { /* periodic disk operation already active? */
-        CycInt_AddRelativeInterruptUsCycles(SECTOR_IO_DELAY, 400, INTERRUPT_MO_IO);
+        CycInt_AddRelativeInterruptUsCycles(mo_timing(SECTOR_IO_DELAY), 400, INTERRUPT_MO_IO);
     }
     modrv[dnum].spiraling=true;
 
@@ -1589,7 +1611,7 @@ void mo_spiraling_operation(void) {
             modrv[i].sec_offset%=MO_SEC_PER_TRACK;
         }
     }
-    CycInt_AddRelativeInterruptUsCycles(SECTOR_IO_DELAY, 400, INTERRUPT_MO_IO);
+    CycInt_AddRelativeInterruptUsCycles(mo_timing(SECTOR_IO_DELAY), 400, INTERRUPT_MO_IO);
 }
 
 void mo_self_diagnostic(void) {
@@ -1793,3 +1815,58 @@ void MO_Reset(void) {
     MO_Uninit();
     MO_Init();
 }
+
+/* Reopen disk images read-only in a forked process, so the file position
+ * is not shared with other processes. The disks become write protected. */
+void MO_Reopen(void) {
+    int i;
+    
+    for (i = 0; i < MO_MAX_DRIVES; i++) {
+        if (modrv[i].dsk) {
+            File_Close(modrv[i].dsk);
+            modrv[i].dsk = File_Open(ConfigureParams.MO.drive[i].szImageName, "rb");
+            modrv[i].protected = true;
+            if (modrv[i].dsk == NULL) {
+                Log_Printf(LOG_WARN, "MO Disk%i: Cannot reopen image file %s\n",
+                           i, ConfigureParams.MO.drive[i].szImageName);
+                modrv[i].inserted = false;
+            }
+        }
+    }
+}
+
+/* Save/restore controller and drive state, disk image handles are kept */
+void MO_MemorySnapShot_Capture(bool bSave) {
+    int i;
+    
+    MemorySnapShot_Store(&mo, sizeof(mo));
+    MemorySnapShot_Store(&sector_counter, sizeof(sector_counter));
+    for (i = 0; i < MO_MAX_DRIVES; i++) {
+        FILE* dsk = modrv[i].dsk;
+        bool protected = modrv[i].protected;
+        bool inserted = modrv[i].inserted;
+        bool connected = modrv[i].connected;
+        
+        MemorySnapShot_Store(&modrv[i], sizeof(modrv[i]));
+        
+        modrv[i].dsk = dsk;
+        modrv[i].protected = protected;
+        modrv[i].inserted = inserted;
+        modrv[i].connected = connected;
+    }
+    MemorySnapShot_Store(&dnum, sizeof(dnum));
+    MemorySnapShot_Store(&sector_increment, sizeof(sector_increment));
+    MemorySnapShot_Store(&write_timing, sizeof(write_timing));
+    MemorySnapShot_Store(&sector_timer, sizeof(sector_timer));
+    MemorySnapShot_Store(&ecc_repeat, sizeof(ecc_repeat));
+    MemorySnapShot_Store(&eccin, sizeof(eccin));
+    MemorySnapShot_Store(&eccout, sizeof(eccout));
+    MemorySnapShot_Store(&ecc_mode, sizeof(ecc_mode));
+    MemorySnapShot_Store(&ecc_state, sizeof(ecc_state));
+    MemorySnapShot_Store(&fmt_mode, sizeof(fmt_mode));
+    MemorySnapShot_Store(&old_size, sizeof(old_size));
+    MemorySnapShot_Store(&delayed_compl, sizeof(delayed_compl));
+    MemorySnapShot_Store(&delayed_attn, sizeof(delayed_attn));
+    MemorySnapShot_Store(&delayed_drive, sizeof(delayed_drive));
+    MemorySnapShot_Store(ecc_buffer, sizeof(ecc_buffer));
+}
@@ -0,0 +1,271 @@
+/*
+  Previous - options.c
+
+  This file is distributed under the GNU Public License, version 2 or at
+  your option any later version. Read the file gpl.txt for details.
+
+  Functions for showing and parsing all of Previous' command line options.
+
+  Options are applied in the given order on top of the configuration file,
+  so later options override earlier ones. Every setting of the configuration
+  file can be changed with --set, the section and key names are the same as
+  in the file. Arguments starting with -psn_ are passed by macOS to programs
+  started from an application bundle and are ignored.
+*/
+const char Options_fileid[] = "Previous options.c : " __DATE__ " " __TIME__;
+
+#include "main.h"
+#include "configuration.h"
+#include "file.h"
+#include "batch.h"
+#include "options.h"
+
+enum {
+	OPT_HELP,
+	OPT_VERSION,
+	OPT_CONFIGFILE,
+	OPT_SET,
+	OPT_RECORD,
+	OPT_REPLAY,
+	OPT_BATCH,
+	OPT_RUNTIME,
+	OPT_EXITWRITE,
+	OPT_EXITSERIAL,
+	OPT_REPORT,
+	OPT_NONE
+};
+
+typedef struct {
+	unsigned int id;    /* option ID */
+	const char *chr;    /* short option */
+	const char *str;    /* long option */
+	const char *arg;    /* type name for argument, if any */
+	const char *desc;   /* option description */
+} opt_t;
+
+static const opt_t PreviousOptions[] = {
+	{ OPT_HELP,       "-h", "--help",
+	  NULL, "Print this help text and exit" },
+	{ OPT_VERSION,    "-v", "--version",
+	  NULL, "Print version number and exit" },
+	{ OPT_CONFIGFILE, "-c", "--configfile",
+	  "<file>", "Read additional configuration values from <file>" },
+	{ OPT_SET,        "-s", "--set",
+	  "<section.key=value>", "Set a configuration value, e.g. System.nCpuFreq=33" },
+	{ OPT_RECORD,     NULL, "--record",
+	  "<file>", "Record host inputs to journal <file>" },
+	{ OPT_REPLAY,     NULL, "--replay",
+	  "<file>", "Replay host inputs from journal <file>" },
+	{ OPT_BATCH,      NULL, "--batch",
+	  NULL, "Run without user interaction as fast as possible" },
+	{ OPT_RUNTIME,    NULL, "--run-time",
+	  "<seconds>", "Stop batch run after <seconds> of emulated time" },
+	{ OPT_EXITWRITE,  NULL, "--exit-on-write",
+	  "<addr>=<value>", "Stop batch run when guest writes long <value> to <addr>" },
+	{ OPT_EXITSERIAL, NULL, "--exit-on-serial",
+	  "<string>", "Stop batch run when guest sends <string> to a serial port" },
+	{ OPT_REPORT,     NULL, "--report",
+	  "<file>", "Write batch report to <file> instead of standard output" },
+	{ OPT_NONE, NULL, NULL, NULL, NULL }
+};
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Show program usage.
+ */
+static void Opt_ShowHelp(void)
+{
+	const opt_t *opt;
+	char buf[64];
+
+	printf("Usage:\n previous [options]\n\nOptions:\n");
+	for (opt = PreviousOptions; opt->id != OPT_NONE; opt++)
+	{
+		snprintf(buf, sizeof(buf), "%s%s%s%s%s",
+		         opt->chr ? opt->chr : "", opt->chr ? ", " : "", opt->str,
+		         opt->arg ? " " : "", opt->arg ? opt->arg : "");
+		printf("  %-34s %s\n", buf, opt->desc);
+	}
+	printf("\nThe batch report is written in JSON format. The exit status is 1\n"
+	       "if a batch run stops before the guest reached a given marker.\n");
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Show an error for an option and return false.
+ */
+static bool Opt_ShowError(const char *psOption, const char *psArg, const char *psReason)
+{
+	if (psArg)
+		fprintf(stderr, "Error for option '%s' with argument '%s': %s\n", psOption, psArg, psReason);
+	else
+		fprintf(stderr, "Error for option '%s': %s\n", psOption, psReason);
+	fprintf(stderr, "Use --help to list the available options.\n");
+	return false;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Set a configuration value given as <section>.<key>=<value>.
+ */
+static bool Opt_SetValue(const char *psArg)
+{
+	char sSection[64];
+	char sKey[64];
+	const char *psDot, *psEqual;
+
+	psDot = strchr(psArg, '.');
+	psEqual = strchr(psArg, '=');
+	if (!psDot || !psEqual || psDot > psEqual ||
+	    psDot - psArg >= (int)sizeof(sSection) || psEqual - psDot - 1 >= (int)sizeof(sKey))
+	{
+		return false;
+	}
+	if (strlen(psEqual + 1) >= FILENAME_MAX)
+		return false;
+
+	memcpy(sSection, psArg, psDot - psArg);
+	sSection[psDot - psArg] = '\0';
+	memcpy(sKey, psDot + 1, psEqual - psDot - 1);
+	sKey[psEqual - psDot - 1] = '\0';
+
+	return Configuration_SetValue(sSection, sKey, psEqual + 1);
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Set a journal file name and mode.
+ */
+static bool Opt_SetJournal(const char *psFileName, JOURNALMODE nMode)
+{
+	if (strlen(psFileName) >= sizeof(ConfigureParams.Log.sJournalFileName))
+		return false;
+	strcpy(ConfigureParams.Log.sJournalFileName, psFileName);
+	ConfigureParams.Log.nJournalMode = nMode;
+	return true;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Parse a write marker given as <addr>=<value>.
+ */
+static bool Opt_SetWriteMarker(const char *psArg)
+{
+	unsigned long nAddr, nValue;
+	char *psEnd;
+
+	nAddr = strtoul(psArg, &psEnd, 0);
+	if (psEnd == psArg || *psEnd != '=')
+		return false;
+	psArg = psEnd + 1;
+	nValue = strtoul(psArg, &psEnd, 0);
+	if (psEnd == psArg || *psEnd)
+		return false;
+
+	return Batch_SetWriteMarker(nAddr, nValue);
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Parse the command line options. Returns false if the program should
+ * exit, e.g. after showing the help text or because of an invalid option.
+ */
+bool Opt_ParseParameters(int argc, const char * const argv[])
+{
+	const opt_t *opt;
+	const char *psArg;
+	double dSeconds;
+	char *psEnd;
+	int i;
+
+	for (i = 1; i < argc; i++)
+	{
+		/* Process serial number passed by macOS to bundled applications */
+		if (!strncmp(argv[i], "-psn_", 5))
+			continue;
+
+		for (opt = PreviousOptions; opt->id != OPT_NONE; opt++)
+		{
+			if ((opt->chr && !strcmp(argv[i], opt->chr)) || !strcmp(argv[i], opt->str))
+				break;
+		}
+		if (opt->id == OPT_NONE)
+			return Opt_ShowError(argv[i], NULL, "Unknown option");
+
+		psArg = NULL;
+		if (opt->arg)
+		{
+			if (i + 1 >= argc)
+				return Opt_ShowError(argv[i], NULL, "Missing argument");
+			psArg = argv[++i];
+		}
+
+		switch (opt->id)
+		{
+		case OPT_HELP:
+			Opt_ShowHelp();
+			return false;
+
+		case OPT_VERSION:
+			printf(PROG_NAME "\n");
+			return false;
+
+		case OPT_CONFIGFILE:
+			if (strlen(psArg) >= sizeof(sConfigFileName) || !File_Exists(psArg))
+				return Opt_ShowError(opt->str, psArg, "Configuration file not found");
+			strcpy(sConfigFileName, psArg);
+			Configuration_Load(NULL);
+			break;
+
+		case OPT_SET:
+			if (!Opt_SetValue(psArg))
+				return Opt_ShowError(opt->str, psArg, "Unknown or invalid configuration value");
+			break;
+
+		case OPT_RECORD:
+			if (!Opt_SetJournal(psArg, JOURNAL_RECORD))
+				return Opt_ShowError(opt->str, psArg, "File name too long");
+			break;
+
+		case OPT_REPLAY:
+			if (!File_Exists(psArg) || !Opt_SetJournal(psArg, JOURNAL_REPLAY))
+				return Opt_ShowError(opt->str, psArg, "Journal file not found");
+			break;
+
+		case OPT_BATCH:
+			Batch_Enable();
+			break;
+
+		case OPT_RUNTIME:
+			dSeconds = strtod(psArg, &psEnd);
+			if (psEnd == psArg || *psEnd || dSeconds <= 0)
+				return Opt_ShowError(opt->str, psArg, "Invalid number of seconds");
+			Batch_SetRunTime(dSeconds);
+			break;
+
+		case OPT_EXITWRITE:
+			if (!Opt_SetWriteMarker(psArg))
+				return Opt_ShowError(opt->str, psArg, "Invalid address or value");
+			break;
+
+		case OPT_EXITSERIAL:
+			if (!Batch_SetSerialMarker(psArg))
+				return Opt_ShowError(opt->str, psArg, "Invalid marker string");
+			break;
+
+		case OPT_REPORT:
+			if (strlen(psArg) >= FILENAME_MAX)
+				return Opt_ShowError(opt->str, psArg, "File name too long");
+			Batch_SetReportFile(psArg);
+			break;
+		}
+	}
+
+	return true;
+}
@@ -16,6 +16,8 @@
 #include "dma.h"
 #include "statusbar.h"
 #include "file.h"
+#include "host.h"
+#include "memorySnapShot.h"
 
 #if HAVE_LIBPNG
 #include <png.h>
@@ -54,9 +56,9 @@ void lp_interface_status(Uint8 stat, bool set);
 void lp_gpo_access(Uint8 data);
 void lp_printer_reset(void);
 
-void lp_png_setup(Uint32 data);
-void lp_png_print(void);
-void lp_png_finish(void);
+void lp_page_setup(Uint32 data);
+void lp_page_print(void);
+void lp_page_finish(void);
 
 bool lp_data_transfer = false;
 
@@ -355,10 +357,10 @@ void lp_interface_command(Uint8 cmd, Uint32 data) {
                 if (cmd&LP_CMD_DATA_EN) {
                     Log_Printf(LOG_LP_LEVEL,"[LP] Enable printer data transfer");
                     /* Setup printing buffer */
-                    lp_png_setup(nlp.margins);
+                    lp_page_setup(nlp.margins);
                     lp_data_transfer = true;
                     if (lp_buffer.size) {
-                        lp_png_print();
+                        lp_page_print();
                         lp_buffer.size = 0;
                     }
                     Statusbar_AddMessage("Laser Printer Printing Page.", 0);
@@ -367,7 +369,7 @@ void lp_interface_command(Uint8 cmd, Uint32 data) {
                     Log_Printf(LOG_LP_LEVEL,"[LP] Disable printer data transfer");
                     if (lp_data_transfer) {
                         /* Save buffered printing data to image file */
-                        lp_png_finish();
+                        lp_page_finish();
                     }
                     lp_data_transfer = false;
                 }
@@ -623,7 +625,7 @@ void Printer_IO_Handler(void) {
             return;
         }
         /* Save data to printing buffer */
-        lp_png_print();
+        lp_page_print();
         
         lp_buffer.size = 0;
         
@@ -645,9 +647,18 @@ void Printer_Reset(void) {
     set_interrupt(INT_PRINTER, RELEASE_INT);
 }
 
+/* Save/restore interface state. A page being rendered is not saved. */
+void Printer_MemorySnapShot_Capture(bool bSave) {
+    MemorySnapShot_Store(&nlp, sizeof(nlp));
+    MemorySnapShot_Store(&lp_data_transfer, sizeof(lp_data_transfer));
+    MemorySnapShot_Store(&lp_copyright_sequence, sizeof(lp_copyright_sequence));
+    MemorySnapShot_Store(&lp_serial_phase, sizeof(lp_serial_phase));
+    MemorySnapShot_Store(&lp_buffer, sizeof(lp_buffer));
+}
+
 
 /* Helper function for building path and filename of output file */
-static const char *lp_get_filename(void) {
+static const char *lp_get_filename(const char *ext) {
     static const char *lp_outfile = NULL;
     static char lp_filename[32];
     static char lp_extension[16];
@@ -659,9 +670,9 @@ static const char *lp_get_filename(void) {
         
         do {
             if (lp_duplicate_count) {
-                sprintf(lp_extension, "%i.png",lp_duplicate_count);
+                sprintf(lp_extension, "%i%s",lp_duplicate_count,ext);
             } else {
-                sprintf(lp_extension, ".png");
+                sprintf(lp_extension, "%s",ext);
             }
             lp_outfile = File_MakePath(ConfigureParams.Printer.szPrintToFileName,
                                        lp_filename, lp_extension);
@@ -681,92 +692,224 @@ static const char *lp_get_filename(void) {
 }
 
 
-/* PNG printing functions */
-#if HAVE_LIBPNG
+/* Page rendering functions
+ *
+ * Pages are assembled in one contiguous bitmap taken from a small pool and
+ * handed to a worker thread for encoding, so that writing a 400 dpi page
+ * does not stall the emulation. The emulation thread only waits if the
+ * worker falls behind by more than LP_PAGE_POOL pages.
+ */
 const int MAX_PAGE_LEN = 400 * 14; // 14 inches is the length of US legal paper, longest paper that fits into the NeXT printer cartridge
-png_structp png_ptr          = NULL;
-png_infop   png_info_ptr     = NULL;
-png_byte**  png_row_pointers = NULL;
-int         png_width;
-int         png_height;
-int         png_count;
-int         png_page_count   = 0;
-const char* png_path;
-#endif
+#define LP_MAX_WIDTH    (0x7F * 32)
+#define LP_PAGE_POOL    2
+
+typedef struct {
+    Uint8* bits;    /* one bit per pixel, set bits are black */
+    int    width;   /* in pixels, multiple of 32 */
+    int    height;
+    int    format;
+    bool   busy;
+    char   path[FILENAME_MAX];
+} lp_page_t;
+
+static lp_page_t  lp_pages[LP_PAGE_POOL];
+static lp_page_t* lp_page_queue[LP_PAGE_POOL+1];
+static int        lp_queue_in, lp_queue_out;
+static lock_t     lp_page_lock;
+static SDL_sem*   lp_page_free  = NULL;
+static SDL_sem*   lp_page_ready = NULL;
+static thread_t*  lp_page_thread = NULL;
+static atomic_int lp_page_error;
+
+static lp_page_t* lp_page = NULL;   /* page currently being printed */
+static Uint32     lp_page_bytes;
 
-void lp_png_setup(Uint32 data) {
 #if HAVE_LIBPNG
+static bool lp_write_png(FILE* fp, lp_page_t* page) {
+    png_structp png_ptr;
+    png_infop   png_info_ptr;
+    png_bytep*  png_row_pointers;
     int i;
-    png_width = ((data >> 16) & 0x7F) * 32;
-    
-    if (png_ptr) {
-        for (i = 0; i < MAX_PAGE_LEN; i++) {
-            png_free(png_ptr, png_row_pointers[i]);
-        }
-        png_free(png_ptr, png_row_pointers);
-        png_destroy_write_struct(&png_ptr, &png_info_ptr);
-    }
     
     png_ptr = png_create_write_struct(PNG_LIBPNG_VER_STRING, NULL, NULL, NULL);
     if (png_ptr == NULL) {
-        return;
+        return false;
     }
     png_info_ptr = png_create_info_struct(png_ptr);
-    if (png_info_ptr == NULL) {
+    png_row_pointers = malloc(page->height * sizeof(png_bytep));
+    if (png_info_ptr == NULL || png_row_pointers == NULL) {
+        free(png_row_pointers);
         png_destroy_write_struct(&png_ptr, &png_info_ptr);
-        png_ptr = NULL;
-        return;
+        return false;
     }
-    
-    png_row_pointers = png_malloc(png_ptr, MAX_PAGE_LEN * sizeof (png_byte *));
-    for (i = 0; i < MAX_PAGE_LEN; i++) {
-        png_row_pointers[i] = png_malloc(png_ptr, sizeof (uint8_t) * (png_width / 8));
+    for (i = 0; i < page->height; i++) {
+        png_row_pointers[i] = page->bits + i * (page->width / 8);
+    }
+    if (setjmp(png_jmpbuf(png_ptr))) {
+        free(png_row_pointers);
+        png_destroy_write_struct(&png_ptr, &png_info_ptr);
+        return false;
     }
-    png_count  = 0;
-    png_height = 0;
+    
+    png_set_IHDR(png_ptr,
+                 png_info_ptr,
+                 page->width,
+                 page->height,
+                 1,
+                 PNG_COLOR_TYPE_GRAY,
+                 PNG_INTERLACE_NONE,
+                 PNG_COMPRESSION_TYPE_DEFAULT,
+                 PNG_FILTER_TYPE_DEFAULT);
+    
+    png_init_io(png_ptr, fp);
+    png_set_rows(png_ptr, png_info_ptr, png_row_pointers);
+    png_write_png(png_ptr, png_info_ptr, PNG_TRANSFORM_INVERT_MONO, NULL);
+    
+    free(png_row_pointers);
+    png_destroy_write_struct(&png_ptr, &png_info_ptr);
+    return true;
+}
 #endif
+
+/* Binary PBM uses the same bit layout as the printer, several images may
+ * follow each other in one file. */
+static bool lp_write_pbm(FILE* fp, lp_page_t* page) {
+    fprintf(fp, "P4\n%d %d\n", page->width, page->height);
+    return fwrite(page->bits, page->width / 8, page->height, fp) == (size_t)page->height;
 }
 
-void lp_png_print(void) {
+static int lp_page_worker(void* unused) {
+    lp_page_t* page;
+    
+    for (;;) {
+        SDL_SemWait(lp_page_ready);
+        host_lock(&lp_page_lock);
+        page = lp_page_queue[lp_queue_out];
+        lp_queue_out = (lp_queue_out + 1) % (LP_PAGE_POOL+1);
+        host_unlock(&lp_page_lock);
+        
+        if (page == NULL) {
+            break;
+        }
+        
+        FILE* fp = File_Open(page->path, page->format == PRINT_PBM_STREAM ? "ab" : "wb");
+        bool ok = false;
+        
+        if (fp) {
 #if HAVE_LIBPNG
-    if(png_ptr) {
-        int i;
+            if (page->format == PRINT_PNG) {
+                ok = lp_write_png(fp, page);
+            } else
+#endif
+            ok = lp_write_pbm(fp, page);
+            File_Close(fp);
+        }
+        if (!ok) {
+            Log_Printf(LOG_WARN, "[LP] Could not write page to %s", page->path);
+            host_atomic_set(&lp_page_error, 1);
+        }
         
-        for (i = 0; i < lp_buffer.size; i++) {
-            png_row_pointers[png_count/png_width][(png_count%png_width)/8] = ~lp_buffer.data[i];
-            png_count += 8;
+        host_lock(&lp_page_lock);
+        page->busy = false;
+        host_unlock(&lp_page_lock);
+        SDL_SemPost(lp_page_free);
+    }
+    return 0;
+}
+
+static bool lp_page_init(void) {
+    int i;
+    
+    for (i = 0; i < LP_PAGE_POOL; i++) {
+        lp_pages[i].bits = malloc(MAX_PAGE_LEN * (LP_MAX_WIDTH / 8));
+        if (lp_pages[i].bits == NULL) {
+            return false;
         }
+        lp_pages[i].busy = false;
     }
-#endif
+    lp_queue_in   = 0;
+    lp_queue_out  = 0;
+    lp_page_free  = SDL_CreateSemaphore(LP_PAGE_POOL);
+    lp_page_ready = SDL_CreateSemaphore(0);
+    if (lp_page_free && lp_page_ready) {
+        lp_page_thread = host_thread_create(lp_page_worker, "[Previous] printer", NULL);
+    }
+    return lp_page_thread != NULL;
 }
 
-void lp_png_finish(void) {
-#if HAVE_LIBPNG
-    if(png_ptr) {
-        png_set_IHDR(png_ptr,
-                     png_info_ptr,
-                     png_width,
-                     png_count / png_width,
-                     1,
-                     PNG_COLOR_TYPE_GRAY,
-                     PNG_INTERLACE_NONE,
-                     PNG_COMPRESSION_TYPE_DEFAULT,
-                     PNG_FILTER_TYPE_DEFAULT);
+static void lp_page_queue_add(lp_page_t* page) {
+    host_lock(&lp_page_lock);
+    lp_page_queue[lp_queue_in] = page;
+    lp_queue_in = (lp_queue_in + 1) % (LP_PAGE_POOL+1);
+    host_unlock(&lp_page_lock);
+    SDL_SemPost(lp_page_ready);
+}
+
+void lp_page_setup(Uint32 data) {
+    int i;
+    
+    if (lp_page == NULL) {
+        if (lp_page_thread == NULL && !lp_page_init()) {
+            Statusbar_AddMessage("Laser Printer Error: Could not allocate page buffer!", 10000);
+            return;
+        }
+        SDL_SemWait(lp_page_free);
+        host_lock(&lp_page_lock);
+        for (i = 0; lp_pages[i].busy; i++) {}
+        lp_page = &lp_pages[i];
+        lp_page->busy = true;
+        host_unlock(&lp_page_lock);
+    }
+    lp_page->width = ((data >> 16) & 0x7F) * 32;
+    lp_page_bytes  = 0;
+}
+
+void lp_page_print(void) {
+    if (lp_page) {
+        Uint32 size = MAX_PAGE_LEN * (lp_page->width / 8);
+        Uint32 len  = lp_buffer.size;
         
-        png_path = lp_get_filename();
+        if (len > size - lp_page_bytes) {
+            len = size - lp_page_bytes;
+        }
+        memcpy(lp_page->bits + lp_page_bytes, lp_buffer.data, len);
+        lp_page_bytes += len;
+    }
+}
+
+void lp_page_finish(void) {
+    if (lp_page) {
+        const char* path;
         
-        FILE* png_fp = File_Open(png_path, "wb");
+        if (host_atomic_set(&lp_page_error, 0)) {
+            Statusbar_AddMessage("Laser Printer Error: Could not create output file!", 10000);
+        }
         
-        if (png_fp) {
-            png_init_io(png_ptr, png_fp);
-            png_set_rows(png_ptr, png_info_ptr, png_row_pointers);
-            png_write_png(png_ptr, png_info_ptr, PNG_TRANSFORM_IDENTITY, NULL);
+        lp_page->height = lp_page->width ? lp_page_bytes / (lp_page->width / 8) : 0;
+        lp_page->format = ConfigureParams.Printer.nOutputFormat;
+#if !HAVE_LIBPNG
+        if (lp_page->format == PRINT_PNG) {
+            lp_page->format = PRINT_PBM;
+        }
+#endif
+        if (lp_page->format == PRINT_PBM_STREAM) {
+            path = File_DirExists(ConfigureParams.Printer.szPrintToFileName) ?
+                   File_MakePath(ConfigureParams.Printer.szPrintToFileName, "next_printer", ".pbm") : "";
         } else {
-            Statusbar_AddMessage("Laser Printer Error: Could not create output file!", 10000);
+            path = lp_get_filename(lp_page->format == PRINT_PNG ? ".png" : ".pbm");
         }
+        snprintf(lp_page->path, sizeof(lp_page->path), "%s", path);
         
-        File_Close(png_fp);
-        png_page_count++;
+        lp_page_queue_add(lp_page);
+        lp_page = NULL;
+    }
+}
+
+/* Wait for pending pages to be written */
+void Printer_UnInit(void) {
+    if (lp_page_thread) {
+        lp_page_queue_add(NULL);
+        host_thread_wait(lp_page_thread);
+        lp_page_thread = NULL;
     }
-#endif
 }
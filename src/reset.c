@@ -28,6 +28,7 @@ const char Reset_fileid[] = "Hatari reset.c : " __DATE__ " " __TIME__;
 #include "printer.h"
 #include "dsp.h"
 #include "kms.h"
+#include "memorySnapShot.h"
 #include "NextBus.hpp"
 
 /*-----------------------------------------------------------------------*/
@@ -42,6 +43,7 @@ static const char* Reset_NeXT(bool bCold)
 		if (error_str!=NULL) {
 			return error_str;
 		}
+		MemorySnapShot_Reset();   /* Memory no longer matches the last snapshot */
 	}
     
     host_reset();                 /* Reset host related timing vars */
@@ -55,6 +55,113 @@ const Uint32 t_rem[256] = {
 	0x416732ec, 0x4e514aac, 0x5f0bc26c, 0x503dba2c, 0x7dbfcff1, 0x7289b7b1, 0x63d33f71, 0x6ce54731,
 };
 
+/* Slicing tables for processing four symbols per step,
+ t_remN[i] = (i*x^(N+3)) % ((x-1)*(x-2)*(x-4)*(x-8)) */
+const Uint32 t_rem2[256] = {
+	0x00000000, 0x6357d2e7, 0xc6aeb9d3, 0xa5f96b34, 0x91416fbb, 0xf216bd5c, 0x57efd668, 0x34b8048f,
+	0x3f82de6b, 0x5cd50c8c, 0xf92c67b8, 0x9a7bb55f, 0xaec3b1d0, 0xcd946337, 0x686d0803, 0x0b3adae4,
+	0x7e19a1d6, 0x1d4e7331, 0xb8b71805, 0xdbe0cae2, 0xef58ce6d, 0x8c0f1c8a, 0x29f677be, 0x4aa1a559,
+	0x419b7fbd, 0x22ccad5a, 0x8735c66e, 0xe4621489, 0xd0da1006, 0xb38dc2e1, 0x1674a9d5, 0x75237b32,
+	0xfc325fb1, 0x9f658d56, 0x3a9ce662, 0x59cb3485, 0x6d73300a, 0x0e24e2ed, 0xabdd89d9, 0xc88a5b3e,
+	0xc3b081da, 0xa0e7533d, 0x051e3809, 0x6649eaee, 0x52f1ee61, 0x31a63c86, 0x945f57b2, 0xf7088555,
+	0x822bfe67, 0xe17c2c80, 0x448547b4, 0x27d29553, 0x136a91dc, 0x703d433b, 0xd5c4280f, 0xb693fae8,
+	0xbda9200c, 0xdefef2eb, 0x7b0799df, 0x18504b38, 0x2ce84fb7, 0x4fbf9d50, 0xea46f664, 0x89112483,
+	0xe564be7f, 0x86336c98, 0x23ca07ac, 0x409dd54b, 0x7425d1c4, 0x17720323, 0xb28b6817, 0xd1dcbaf0,
+	0xdae66014, 0xb9b1b2f3, 0x1c48d9c7, 0x7f1f0b20, 0x4ba70faf, 0x28f0dd48, 0x8d09b67c, 0xee5e649b,
+	0x9b7d1fa9, 0xf82acd4e, 0x5dd3a67a, 0x3e84749d, 0x0a3c7012, 0x696ba2f5, 0xcc92c9c1, 0xafc51b26,
+	0xa4ffc1c2, 0xc7a81325, 0x62517811, 0x0106aaf6, 0x35beae79, 0x56e97c9e, 0xf31017aa, 0x9047c54d,
+	0x1956e1ce, 0x7a013329, 0xdff8581d, 0xbcaf8afa, 0x88178e75, 0xeb405c92, 0x4eb937a6, 0x2deee541,
+	0x26d43fa5, 0x4583ed42, 0xe07a8676, 0x832d5491, 0xb795501e, 0xd4c282f9, 0x713be9cd, 0x126c3b2a,
+	0x674f4018, 0x041892ff, 0xa1e1f9cb, 0xc2b62b2c, 0xf60e2fa3, 0x9559fd44, 0x30a09670, 0x53f74497,
+	0x58cd9e73, 0x3b9a4c94, 0x9e6327a0, 0xfd34f547, 0xc98cf1c8, 0xaadb232f, 0x0f22481b, 0x6c759afc,
+	0xd7c861fe, 0xb49fb319, 0x1166d82d, 0x72310aca, 0x46890e45, 0x25dedca2, 0x8027b796, 0xe3706571,
+	0xe84abf95, 0x8b1d6d72, 0x2ee40646, 0x4db3d4a1, 0x790bd02e, 0x1a5c02c9, 0xbfa569fd, 0xdcf2bb1a,
+	0xa9d1c028, 0xca8612cf, 0x6f7f79fb, 0x0c28ab1c, 0x3890af93, 0x5bc77d74, 0xfe3e1640, 0x9d69c4a7,
+	0x96531e43, 0xf504cca4, 0x50fda790, 0x33aa7577, 0x071271f8, 0x6445a31f, 0xc1bcc82b, 0xa2eb1acc,
+	0x2bfa3e4f, 0x48adeca8, 0xed54879c, 0x8e03557b, 0xbabb51f4, 0xd9ec8313, 0x7c15e827, 0x1f423ac0,
+	0x1478e024, 0x772f32c3, 0xd2d659f7, 0xb1818b10, 0x85398f9f, 0xe66e5d78, 0x4397364c, 0x20c0e4ab,
+	0x55e39f99, 0x36b44d7e, 0x934d264a, 0xf01af4ad, 0xc4a2f022, 0xa7f522c5, 0x020c49f1, 0x615b9b16,
+	0x6a6141f2, 0x09369315, 0xaccff821, 0xcf982ac6, 0xfb202e49, 0x9877fcae, 0x3d8e979a, 0x5ed9457d,
+	0x32acdf81, 0x51fb0d66, 0xf4026652, 0x9755b4b5, 0xa3edb03a, 0xc0ba62dd, 0x654309e9, 0x0614db0e,
+	0x0d2e01ea, 0x6e79d30d, 0xcb80b839, 0xa8d76ade, 0x9c6f6e51, 0xff38bcb6, 0x5ac1d782, 0x39960565,
+	0x4cb57e57, 0x2fe2acb0, 0x8a1bc784, 0xe94c1563, 0xddf411ec, 0xbea3c30b, 0x1b5aa83f, 0x780d7ad8,
+	0x7337a03c, 0x106072db, 0xb59919ef, 0xd6cecb08, 0xe276cf87, 0x81211d60, 0x24d87654, 0x478fa4b3,
+	0xce9e8030, 0xadc952d7, 0x083039e3, 0x6b67eb04, 0x5fdfef8b, 0x3c883d6c, 0x99715658, 0xfa2684bf,
+	0xf11c5e5b, 0x924b8cbc, 0x37b2e788, 0x54e5356f, 0x605d31e0, 0x030ae307, 0xa6f38833, 0xc5a45ad4,
+	0xb08721e6, 0xd3d0f301, 0x76299835, 0x157e4ad2, 0x21c64e5d, 0x42919cba, 0xe768f78e, 0x843f2569,
+	0x8f05ff8d, 0xec522d6a, 0x49ab465e, 0x2afc94b9, 0x1e449036, 0x7d1342d1, 0xd8ea29e5, 0xbbbdfb02,
+};
+
+const Uint32 t_rem3[256] = {
+	0x00000000, 0x5c07bfe5, 0xb80e63d7, 0xe409dc32, 0x6d1cc6b3, 0x311b7956, 0xd512a564, 0x89151a81,
+	0xda38917b, 0x863f2e9e, 0x6236f2ac, 0x3e314d49, 0xb72457c8, 0xeb23e82d, 0x0f2a341f, 0x532d8bfa,
+	0xa9703ff6, 0xf5778013, 0x117e5c21, 0x4d79e3c4, 0xc46cf945, 0x986b46a0, 0x7c629a92, 0x20652577,
+	0x7348ae8d, 0x2f4f1168, 0xcb46cd5a, 0x974172bf, 0x1e54683e, 0x4253d7db, 0xa65a0be9, 0xfa5db40c,
+	0x4fe07ef1, 0x13e7c114, 0xf7ee1d26, 0xabe9a2c3, 0x22fcb842, 0x7efb07a7, 0x9af2db95, 0xc6f56470,
+	0x95d8ef8a, 0xc9df506f, 0x2dd68c5d, 0x71d133b8, 0xf8c42939, 0xa4c396dc, 0x40ca4aee, 0x1ccdf50b,
+	0xe6904107, 0xba97fee2, 0x5e9e22d0, 0x02999d35, 0x8b8c87b4, 0xd78b3851, 0x3382e463, 0x6f855b86,
+	0x3ca8d07c, 0x60af6f99, 0x84a6b3ab, 0xd8a10c4e, 0x51b416cf, 0x0db3a92a, 0xe9ba7518, 0xb5bdcafd,
+	0x9eddfcff, 0xc2da431a, 0x26d39f28, 0x7ad420cd, 0xf3c13a4c, 0xafc685a9, 0x4bcf599b, 0x17c8e67e,
+	0x44e56d84, 0x18e2d261, 0xfceb0e53, 0xa0ecb1b6, 0x29f9ab37, 0x75fe14d2, 0x91f7c8e0, 0xcdf07705,
+	0x37adc309, 0x6baa7cec, 0x8fa3a0de, 0xd3a41f3b, 0x5ab105ba, 0x06b6ba5f, 0xe2bf666d, 0xbeb8d988,
+	0xed955272, 0xb192ed97, 0x559b31a5, 0x099c8e40, 0x808994c1, 0xdc8e2b24, 0x3887f716, 0x648048f3,
+	0xd13d820e, 0x8d3a3deb, 0x6933e1d9, 0x35345e3c, 0xbc2144bd, 0xe026fb58, 0x042f276a, 0x5828988f,
+	0x0b051375, 0x5702ac90, 0xb30b70a2, 0xef0ccf47, 0x6619d5c6, 0x3a1e6a23, 0xde17b611, 0x821009f4,
+	0x784dbdf8, 0x244a021d, 0xc043de2f, 0x9c4461ca, 0x15517b4b, 0x4956c4ae, 0xad5f189c, 0xf158a779,
+	0xa2752c83, 0xfe729366, 0x1a7b4f54, 0x467cf0b1, 0xcf69ea30, 0x936e55d5, 0x776789e7, 0x2b603602,
+	0x21a7e5e3, 0x7da05a06, 0x99a98634, 0xc5ae39d1, 0x4cbb2350, 0x10bc9cb5, 0xf4b54087, 0xa8b2ff62,
+	0xfb9f7498, 0xa798cb7d, 0x4391174f, 0x1f96a8aa, 0x9683b22b, 0xca840dce, 0x2e8dd1fc, 0x728a6e19,
+	0x88d7da15, 0xd4d065f0, 0x30d9b9c2, 0x6cde0627, 0xe5cb1ca6, 0xb9cca343, 0x5dc57f71, 0x01c2c094,
+	0x52ef4b6e, 0x0ee8f48b, 0xeae128b9, 0xb6e6975c, 0x3ff38ddd, 0x63f43238, 0x87fdee0a, 0xdbfa51ef,
+	0x6e479b12, 0x324024f7, 0xd649f8c5, 0x8a4e4720, 0x035b5da1, 0x5f5ce244, 0xbb553e76, 0xe7528193,
+	0xb47f0a69, 0xe878b58c, 0x0c7169be, 0x5076d65b, 0xd963ccda, 0x8564733f, 0x616daf0d, 0x3d6a10e8,
+	0xc737a4e4, 0x9b301b01, 0x7f39c733, 0x233e78d6, 0xaa2b6257, 0xf62cddb2, 0x12250180, 0x4e22be65,
+	0x1d0f359f, 0x41088a7a, 0xa5015648, 0xf906e9ad, 0x7013f32c, 0x2c144cc9, 0xc81d90fb, 0x941a2f1e,
+	0xbf7a191c, 0xe37da6f9, 0x07747acb, 0x5b73c52e, 0xd266dfaf, 0x8e61604a, 0x6a68bc78, 0x366f039d,
+	0x65428867, 0x39453782, 0xdd4cebb0, 0x814b5455, 0x085e4ed4, 0x5459f131, 0xb0502d03, 0xec5792e6,
+	0x160a26ea, 0x4a0d990f, 0xae04453d, 0xf203fad8, 0x7b16e059, 0x27115fbc, 0xc318838e, 0x9f1f3c6b,
+	0xcc32b791, 0x90350874, 0x743cd446, 0x283b6ba3, 0xa12e7122, 0xfd29cec7, 0x192012f5, 0x4527ad10,
+	0xf09a67ed, 0xac9dd808, 0x4894043a, 0x1493bbdf, 0x9d86a15e, 0xc1811ebb, 0x2588c289, 0x798f7d6c,
+	0x2aa2f696, 0x76a54973, 0x92ac9541, 0xceab2aa4, 0x47be3025, 0x1bb98fc0, 0xffb053f2, 0xa3b7ec17,
+	0x59ea581b, 0x05ede7fe, 0xe1e43bcc, 0xbde38429, 0x34f69ea8, 0x68f1214d, 0x8cf8fd7f, 0xd0ff429a,
+	0x83d2c960, 0xdfd57685, 0x3bdcaab7, 0x67db1552, 0xeece0fd3, 0xb2c9b036, 0x56c06c04, 0x0ac7d3e1,
+};
+
+const Uint32 t_rem4[256] = {
+	0x00000000, 0x548c479e, 0xa8058e21, 0xfc89c9bf, 0x4d0a0142, 0x198646dc, 0xe50f8f63, 0xb183c8fd,
+	0x9a140284, 0xce98451a, 0x32118ca5, 0x669dcb3b, 0xd71e03c6, 0x83924458, 0x7f1b8de7, 0x2b97ca79,
+	0x29280415, 0x7da4438b, 0x812d8a34, 0xd5a1cdaa, 0x64220557, 0x30ae42c9, 0xcc278b76, 0x98abcce8,
+	0xb33c0691, 0xe7b0410f, 0x1b3988b0, 0x4fb5cf2e, 0xfe3607d3, 0xaaba404d, 0x563389f2, 0x02bfce6c,
+	0x5250082a, 0x06dc4fb4, 0xfa55860b, 0xaed9c195, 0x1f5a0968, 0x4bd64ef6, 0xb75f8749, 0xe3d3c0d7,
+	0xc8440aae, 0x9cc84d30, 0x6041848f, 0x34cdc311, 0x854e0bec, 0xd1c24c72, 0x2d4b85cd, 0x79c7c253,
+	0x7b780c3f, 0x2ff44ba1, 0xd37d821e, 0x87f1c580, 0x36720d7d, 0x62fe4ae3, 0x9e77835c, 0xcafbc4c2,
+	0xe16c0ebb, 0xb5e04925, 0x4969809a, 0x1de5c704, 0xac660ff9, 0xf8ea4867, 0x046381d8, 0x50efc646,
+	0xa4a01054, 0xf02c57ca, 0x0ca59e75, 0x5829d9eb, 0xe9aa1116, 0xbd265688, 0x41af9f37, 0x1523d8a9,
+	0x3eb412d0, 0x6a38554e, 0x96b19cf1, 0xc23ddb6f, 0x73be1392, 0x2732540c, 0xdbbb9db3, 0x8f37da2d,
+	0x8d881441, 0xd90453df, 0x258d9a60, 0x7101ddfe, 0xc0821503, 0x940e529d, 0x68879b22, 0x3c0bdcbc,
+	0x179c16c5, 0x4310515b, 0xbf9998e4, 0xeb15df7a, 0x5a961787, 0x0e1a5019, 0xf29399a6, 0xa61fde38,
+	0xf6f0187e, 0xa27c5fe0, 0x5ef5965f, 0x0a79d1c1, 0xbbfa193c, 0xef765ea2, 0x13ff971d, 0x4773d083,
+	0x6ce41afa, 0x38685d64, 0xc4e194db, 0x906dd345, 0x21ee1bb8, 0x75625c26, 0x89eb9599, 0xdd67d207,
+	0xdfd81c6b, 0x8b545bf5, 0x77dd924a, 0x2351d5d4, 0x92d21d29, 0xc65e5ab7, 0x3ad79308, 0x6e5bd496,
+	0x45cc1eef, 0x11405971, 0xedc990ce, 0xb945d750, 0x08c61fad, 0x5c4a5833, 0xa0c3918c, 0xf44fd612,
+	0x555d20a8, 0x01d16736, 0xfd58ae89, 0xa9d4e917, 0x185721ea, 0x4cdb6674, 0xb052afcb, 0xe4dee855,
+	0xcf49222c, 0x9bc565b2, 0x674cac0d, 0x33c0eb93, 0x8243236e, 0xd6cf64f0, 0x2a46ad4f, 0x7ecaead1,
+	0x7c7524bd, 0x28f96323, 0xd470aa9c, 0x80fced02, 0x317f25ff, 0x65f36261, 0x997aabde, 0xcdf6ec40,
+	0xe6612639, 0xb2ed61a7, 0x4e64a818, 0x1ae8ef86, 0xab6b277b, 0xffe760e5, 0x036ea95a, 0x57e2eec4,
+	0x070d2882, 0x53816f1c, 0xaf08a6a3, 0xfb84e13d, 0x4a0729c0, 0x1e8b6e5e, 0xe202a7e1, 0xb68ee07f,
+	0x9d192a06, 0xc9956d98, 0x351ca427, 0x6190e3b9, 0xd0132b44, 0x849f6cda, 0x7816a565, 0x2c9ae2fb,
+	0x2e252c97, 0x7aa96b09, 0x8620a2b6, 0xd2ace528, 0x632f2dd5, 0x37a36a4b, 0xcb2aa3f4, 0x9fa6e46a,
+	0xb4312e13, 0xe0bd698d, 0x1c34a032, 0x48b8e7ac, 0xf93b2f51, 0xadb768cf, 0x513ea170, 0x05b2e6ee,
+	0xf1fd30fc, 0xa5717762, 0x59f8bedd, 0x0d74f943, 0xbcf731be, 0xe87b7620, 0x14f2bf9f, 0x407ef801,
+	0x6be93278, 0x3f6575e6, 0xc3ecbc59, 0x9760fbc7, 0x26e3333a, 0x726f74a4, 0x8ee6bd1b, 0xda6afa85,
+	0xd8d534e9, 0x8c597377, 0x70d0bac8, 0x245cfd56, 0x95df35ab, 0xc1537235, 0x3ddabb8a, 0x6956fc14,
+	0x42c1366d, 0x164d71f3, 0xeac4b84c, 0xbe48ffd2, 0x0fcb372f, 0x5b4770b1, 0xa7ceb90e, 0xf342fe90,
+	0xa3ad38d6, 0xf7217f48, 0x0ba8b6f7, 0x5f24f169, 0xeea73994, 0xba2b7e0a, 0x46a2b7b5, 0x122ef02b,
+	0x39b93a52, 0x6d357dcc, 0x91bcb473, 0xc530f3ed, 0x74b33b10, 0x203f7c8e, 0xdcb6b531, 0x883af2af,
+	0x8a853cc3, 0xde097b5d, 0x2280b2e2, 0x760cf57c, 0xc78f3d81, 0x93037a1f, 0x6f8ab3a0, 0x3b06f43e,
+	0x10913e47, 0x441d79d9, 0xb894b066, 0xec18f7f8, 0x5d9b3f05, 0x0917789b, 0xf59eb124, 0xa112f6ba,
+};
+
 const Uint8 t_exp[768] = {
 	0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x1d, 0x3a, 0x74, 0xe8, 0xcd, 0x87, 0x13, 0x26,
 	0x4c, 0x98, 0x2d, 0x5a, 0xb4, 0x75, 0xea, 0xc9, 0x8f, 0x03, 0x06, 0x0c, 0x18, 0x30, 0x60, 0xc0,
@@ -128,15 +235,13 @@ const Uint8 t_log[256] = {
 static Uint32 ecc_block(const Uint8 *s, int ss)
 {
     int i;
-    Uint32 r = (s[0] << 24) | (s[ss] << 16) | (s[2*ss] << 8) | s[3*ss];
+    Uint32 r = 0;
     
-    s += 4*ss;
-    for(i=4; i<36; i++) {
-        r = t_rem[r >> 24] ^ (r << 8);
-        if(i < 32) {
-            r ^= *s;
-            s += ss;
-        }
+    /* Feed four symbols at a time, the remainder stays 4 symbols wide */
+    for(i=0; i<32; i+=4) {
+        r ^= (s[0] << 24) | (s[ss] << 16) | (s[2*ss] << 8) | s[3*ss];
+        r = t_rem4[r >> 24] ^ t_rem3[(r >> 16) & 0xff] ^ t_rem2[(r >> 8) & 0xff] ^ t_rem[r & 0xff];
+        s += 4*ss;
     }
     return r;
 }
@@ -16,6 +16,7 @@
 #include "dimension.hpp"
 #include "sysReg.h"
 #include "rtcnvram.h"
+#include "memorySnapShot.h"
 
 #include <time.h>
 
@@ -914,6 +915,15 @@ void nvram_checksum(int force) {
 }
 
 
+void RTC_MemorySnapShot_Capture(bool bSave) {
+    MemorySnapShot_Store(&rtc, sizeof(rtc));
+    MemorySnapShot_Store(&newrtc, sizeof(newrtc));
+    MemorySnapShot_Store(&rtc_addr, sizeof(rtc_addr));
+    MemorySnapShot_Store(&rtc_val, sizeof(rtc_val));
+    MemorySnapShot_Store(&phase, sizeof(phase));
+}
+
+
 #if 1
 static char rtc_ram_info[1024];
 char * get_rtc_ram_info(void) {
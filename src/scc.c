@@ -16,6 +16,8 @@
 #include "scc.h"
 #include "sysReg.h"
 #include "dma.h"
+#include "memorySnapShot.h"
+#include "batch.h"
 
 #define IO_SEG_MASK	0x1FFFF
 
@@ -187,6 +189,8 @@ void scc_data_write(Uint8 ch, Uint8 val) {
 	
 	scc[ch].rreg[R_STATUS] = RR0_TXEMPTY|RR0_RXAVAIL;
 
+	Batch_SerialOutput(val);
+
 	Log_Printf(LOG_SCC_LEVEL,"[SCC] Channel %c: Data write %02X\n",
 			   ch?'B':'A',val);
 }
@@ -260,3 +264,9 @@ void scc_write_master_intr_reset(Uint8 val) {
 			break;
 	}
 }
+
+void SCC_MemorySnapShot_Capture(bool bSave) {
+	MemorySnapShot_Store(scc, sizeof(scc));
+	MemorySnapShot_Store(&scc_register_pointer, sizeof(scc_register_pointer));
+	MemorySnapShot_Store(scc_buf, sizeof(scc_buf));
+}
@@ -7,6 +7,7 @@
 #include "m68000.h"
 #include "statusbar.h"
 #include "scsi.h"
+#include "memorySnapShot.h"
 #include "file.h"
 
 #define LOG_SCSI_LEVEL  LOG_DEBUG    /* Print debugging messages */
@@ -142,6 +143,10 @@ struct {
     Uint8** shadow;
 } SCSIdisk[ESP_MAX_DEVS];
 
+/* Statistics for batch reports */
+Uint64 nSCSIBlocksRead;
+Uint64 nSCSIBlocksWritten;
+
 
 /* Mode Pages */
 #define MODEPAGE_MAX_SIZE 24
@@ -725,19 +730,19 @@ void scsi_write_sector(void) {
             File_Write(scsi_buffer.data, BLOCKSIZE, offset, SCSIdisk[target].dsk);
         } else {
             Log_Printf(LOG_SCSI_LEVEL, "[SCSI] WARNING: File write disabled!");
-            if(SCSIdisk[target].shadow) {
-                if(!(SCSIdisk[target].shadow[SCSIdisk[target].lba]))
-                    SCSIdisk[target].shadow[SCSIdisk[target].lba] = malloc(BLOCKSIZE);
-                memcpy(SCSIdisk[target].shadow[SCSIdisk[target].lba], scsi_buffer.data, BLOCKSIZE);
-            } else {
+            if(!SCSIdisk[target].shadow) {
                 Uint32 blocks = SCSIdisk[target].size / BLOCKSIZE;
                 SCSIdisk[target].shadow = malloc(sizeof(Uint8*) * blocks);
                 for(int i = blocks; --i >= 0;)
                     SCSIdisk[target].shadow[i] = NULL;
             }
+            if(!(SCSIdisk[target].shadow[SCSIdisk[target].lba]))
+                SCSIdisk[target].shadow[SCSIdisk[target].lba] = malloc(BLOCKSIZE);
+            memcpy(SCSIdisk[target].shadow[SCSIdisk[target].lba], scsi_buffer.data, BLOCKSIZE);
         }
         scsi_buffer.limit=BLOCKSIZE;
         scsi_buffer.size=0;
+        nSCSIBlocksWritten++;
 
         SCSIdisk[target].status = STAT_GOOD;
         SCSIdisk[target].sense.code = SC_NO_ERROR;
@@ -806,6 +811,7 @@ void scsi_read_sector(void) {
             File_Read(scsi_buffer.data, BLOCKSIZE, offset, SCSIdisk[target].dsk);
         }
         scsi_buffer.limit=scsi_buffer.size=BLOCKSIZE;
+        nSCSIBlocksRead++;
 
         SCSIdisk[target].status = STAT_GOOD;
         SCSIdisk[target].sense.code = SC_NO_ERROR;
@@ -1131,3 +1137,44 @@ void SCSI_FormatDrive(Uint8 *cdb) {
         SCSIbus.phase = PHASE_ST;
     }
 }
+
+
+/* Reopen disk images read-only in a forked process. The file position is
+ * not shared with other processes then, writes go to the shadow. */
+void SCSI_Reopen(void) {
+    int i;
+    
+    for (i = 0; i < ESP_MAX_DEVS; i++) {
+        if (SCSIdisk[i].dsk) {
+            File_Close(SCSIdisk[i].dsk);
+            SCSIdisk[i].dsk = File_Open(ConfigureParams.SCSI.target[i].szImageName, "rb");
+            if (SCSIdisk[i].dsk == NULL) {
+                Log_Printf(LOG_WARN, "SCSI Disk%i: Cannot reopen image file %s\n",
+                           i, ConfigureParams.SCSI.target[i].szImageName);
+                SCSIdisk[i].size = 0;
+            }
+        }
+    }
+}
+
+/* Save/restore bus and target state. Disk images are not part of the
+ * snapshot, the handles opened for the current configuration are kept. */
+void SCSI_MemorySnapShot_Capture(bool bSave) {
+    int i;
+    
+    for (i = 0; i < ESP_MAX_DEVS; i++) {
+        FILE* dsk = SCSIdisk[i].dsk;
+        Uint64 size = SCSIdisk[i].size;
+        bool readonly = SCSIdisk[i].readonly;
+        Uint8** shadow = SCSIdisk[i].shadow;
+        
+        MemorySnapShot_Store(&SCSIdisk[i], sizeof(SCSIdisk[i]));
+        
+        SCSIdisk[i].dsk = dsk;
+        SCSIdisk[i].size = size;
+        SCSIdisk[i].readonly = readonly;
+        SCSIdisk[i].shadow = shadow;
+    }
+    MemorySnapShot_Store(&SCSIbus, sizeof(SCSIbus));
+    MemorySnapShot_Store(&scsi_buffer, sizeof(scsi_buffer));
+}
@@ -24,6 +24,7 @@ const char ShortCut_fileid[] = "Hatari shortcut.c : " __DATE__ " " __TIME__;
 #include "video.h"
 #include "snd.h"
 #include "statusbar.h"
+#include "memorySnapShot.h"
 
 static SHORTCUTKEYIDX ShortCutKey = SHORTCUT_NONE;  /* current shortcut key */
 
@@ -211,6 +212,12 @@ void ShortCut_ActKey(void)
 	 case SHORTCUT_DIMENSION:
 		ShortCut_Dimension();
 		break;
+	 case SHORTCUT_SAVEMEM:
+		MemorySnapShot_Capture(ConfigureParams.Memory.szMemoryCaptureFileName, true);
+		break;
+	 case SHORTCUT_LOADMEM:
+		MemorySnapShot_Restore(ConfigureParams.Memory.szMemoryCaptureFileName, true);
+		break;
 	 case SHORTCUT_KEYS:
 	 case SHORTCUT_NONE:
 		/* ERROR: cannot happen, just make compiler happy */
@@ -237,6 +244,8 @@ bool Shortcut_Invoke(const char *shortcut)
 		{ SHORTCUT_COLDRESET, "coldreset" },
 		{ SHORTCUT_WARMRESET, "warmreset" },
 		{ SHORTCUT_QUIT, "quit" },
+		{ SHORTCUT_SAVEMEM, "savemem" },
+		{ SHORTCUT_LOADMEM, "loadmem" },
 		{ SHORTCUT_NONE, NULL }
 	};
 	int i;
@@ -7,6 +7,8 @@
 #include "dma.h"
 #include "snd.h"
 #include "kms.h"
+#include "memorySnapShot.h"
+#include "journal.h"
 
 #define LOG_SND_LEVEL   LOG_DEBUG
 #define LOG_VOL_LEVEL   LOG_DEBUG
@@ -178,7 +180,7 @@ void SND_Out_Handler(void) {
         return;
     }
 
-    if (sndout_inited && Audio_Output_Queue_Size() > AUDIO_BUFFER_SAMPLES * 2) {
+    if (Journal_Event(JOURNAL_SNDOUT_FULL, sndout_inited && Audio_Output_Queue_Size() > AUDIO_BUFFER_SAMPLES * 2)) {
         CycInt_AddRelativeInterruptUs(SND_CHECK_DELAY * AUDIO_BUFFER_SAMPLES, 0, INTERRUPT_SND_OUT);
         return;
     }
@@ -440,3 +442,27 @@ void snd_gpo_access(Uint8 data) {
     }
     old_data = data;
 }
+
+/* Save/restore sound loop and volume interface state */
+void Sound_MemorySnapShot_Capture(bool bSave) {
+    MemorySnapShot_Store(&sndout_state, sizeof(sndout_state));
+    MemorySnapShot_Store(&sound_output_active, sizeof(sound_output_active));
+    MemorySnapShot_Store(&sound_input_active, sizeof(sound_input_active));
+    MemorySnapShot_Store(&tmp_vol, sizeof(tmp_vol));
+    MemorySnapShot_Store(&chan_lr, sizeof(chan_lr));
+    MemorySnapShot_Store(&bit_num, sizeof(bit_num));
+    MemorySnapShot_Store(&old_data, sizeof(old_data));
+    
+    if (!bSave) {
+        if (sound_output_active && sndout_inited) {
+            Audio_Output_Enable(true);
+        }
+        if (sound_input_active && ConfigureParams.Sound.bEnableSound) {
+            if (!sndin_inited) {
+                sndin_inited = true;
+                Audio_Input_Init();
+            }
+            Audio_Input_Enable(true);
+        }
+    }
+}
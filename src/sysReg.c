@@ -13,6 +13,7 @@
 #include "rtcnvram.h"
 #include "statusbar.h"
 #include "host.h"
+#include "memorySnapShot.h"
 
 #define LOG_HARDCLOCK_LEVEL LOG_DEBUG
 #define LOG_SOFTINT_LEVEL   LOG_DEBUG
@@ -530,3 +531,37 @@ void color_video_interrupt(void) {
 		col_vid_intr &= ~VID_CMD_ENABLE_INT;
 	}
 }
+
+
+/* Save/restore system registers to/from memory snapshot. Host times are
+ * stored relative to the current time. */
+
+void SCR_MemorySnapShot_Capture(bool bSave) {
+	Uint64 now = host_time_us();
+	Uint64 latchAge = now - hardClockLastLatch;
+	Uint64 timerCount = now - sysTimerOffset;
+
+	MemorySnapShot_Store(&SCR_ROM_overlay, sizeof(SCR_ROM_overlay));
+	MemorySnapShot_Store(&scr1, sizeof(scr1));
+	MemorySnapShot_Store(&scr2_0, sizeof(scr2_0));
+	MemorySnapShot_Store(&scr2_1, sizeof(scr2_1));
+	MemorySnapShot_Store(&scr2_2, sizeof(scr2_2));
+	MemorySnapShot_Store(&scr2_3, sizeof(scr2_3));
+	MemorySnapShot_Store(&scrIntStat, sizeof(scrIntStat));
+	MemorySnapShot_Store(&scrIntMask, sizeof(scrIntMask));
+	MemorySnapShot_Store(&dsp_intr_at_block_end, sizeof(dsp_intr_at_block_end));
+	MemorySnapShot_Store(&dsp_dma_unpacked, sizeof(dsp_dma_unpacked));
+	MemorySnapShot_Store(&hardclock_csr, sizeof(hardclock_csr));
+	MemorySnapShot_Store(&hardclock0, sizeof(hardclock0));
+	MemorySnapShot_Store(&hardclock1, sizeof(hardclock1));
+	MemorySnapShot_Store(&latch_hardclock, sizeof(latch_hardclock));
+	MemorySnapShot_Store(&latchAge, sizeof(latchAge));
+	MemorySnapShot_Store(&timerCount, sizeof(timerCount));
+	MemorySnapShot_Store(&resetTimer, sizeof(resetTimer));
+	MemorySnapShot_Store(&col_vid_intr, sizeof(col_vid_intr));
+
+	if (!bSave) {
+		hardClockLastLatch = now - latchAge;
+		sysTimerOffset     = now - timerCount;
+	}
+}
@@ -0,0 +1,201 @@
+/*
+  Previous - worker.c
+
+  This file is distributed under the GNU Public License, version 2 or at
+  your option any later version. Read the file gpl.txt for details.
+
+  Worker processes
+
+  A booted machine can be forked into several worker processes which then
+  run independently. The host shares guest RAM and VRAM copy-on-write, so
+  a worker only uses memory for the pages it changes. Threads do not survive
+  fork(), they are stopped before and restarted in each worker. Disk images
+  are reopened, writes to SCSI disks go to a private overlay of each worker
+  and MO and floppy disks become write protected. Each worker starts its own
+  network backend.
+
+  The workers run without display, so the SDL video driver has to be one
+  which does not connect to a display server. The parent does not run the
+  machine any more, it waits until all workers have exited.
+*/
+const char Worker_fileid[] = "Previous worker.c : " __DATE__ " " __TIME__;
+
+#include "main.h"
+#if HAVE_FORK
+#include <errno.h>
+#include <unistd.h>
+#include <sys/wait.h>
+#endif
+
+#include "configuration.h"
+#include "dsp.h"
+#include "ethernet.h"
+#include "floppy.h"
+#include "journal.h"
+#include "log.h"
+#include "mo.h"
+#include "printer.h"
+#include "screen.h"
+#include "scsi.h"
+#include "snd.h"
+#include "worker.h"
+
+static int nWorkerIndex = 0;        /* 0 in the parent, 1..n in the workers */
+static int nWorkersFailed = 0;
+
+
+#if HAVE_FORK
+/*-----------------------------------------------------------------------*/
+/**
+ * Check if the current machine can be forked.
+ */
+static bool Worker_CanFork(void)
+{
+	const char *psDriver = SDL_GetCurrentVideoDriver();
+	int i;
+
+	for (i = 0; i < ND_MAX_BOARDS; i++)
+	{
+		if (ConfigureParams.Dimension.board[i].bEnabled)
+		{
+			Log_Printf(LOG_ERROR, "[Worker] Machines with NeXTdimension boards can not be forked.\n");
+			return false;
+		}
+	}
+	/* Workers would write to or read from the same journal file */
+	if (Journal_Active())
+	{
+		Log_Printf(LOG_ERROR, "[Worker] Machines with an active journal can not be forked.\n");
+		return false;
+	}
+	/* Otherwise all workers would share the connection to the display */
+	if (!psDriver || (strcmp(psDriver, "dummy") && strcmp(psDriver, "offscreen")))
+	{
+		Log_Printf(LOG_ERROR, "[Worker] Forking requires SDL_VIDEODRIVER=dummy or offscreen.\n");
+		return false;
+	}
+	return true;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Stop or restart all threads which run next to the CPU thread.
+ */
+static void Worker_Pause(bool pause)
+{
+	Log_Pause(pause);
+	DSP_Pause(pause);
+	Ethernet_Pause(pause);
+	Sound_Pause(pause);
+}
+#endif
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Fork the machine into nWorkers worker processes. Returns the number of
+ * the worker (1..nWorkers) in a worker, 0 in the parent after all workers
+ * have exited and -1 if the machine can not be forked.
+ */
+int Worker_Fork(int nWorkers)
+{
+#if HAVE_FORK
+	pid_t *pids;
+	pid_t pid;
+	int nStarted, nRunning, status, i;
+
+	if (!Worker_CanFork())
+		return -1;
+	pids = calloc(nWorkers, sizeof(pid_t));
+	if (!pids)
+		return -1;
+
+	/* The display is not restarted, neither parent nor workers show it */
+	Screen_UnInit();
+	Printer_UnInit();
+	Worker_Pause(true);
+	/* Buffered output would be written once by every process */
+	fflush(NULL);
+
+	for (nStarted = 0; nStarted < nWorkers; nStarted++)
+	{
+		pid = fork();
+		if (pid == 0)
+		{
+			free(pids);
+			nWorkerIndex = nStarted + 1;
+			/* The snapshot belongs to the parent */
+			ConfigureParams.Memory.bAutoSave = false;
+			ConfigureParams.SCSI.nWriteProtection = WRITEPROT_ON;
+			SCSI_Reopen();
+			MO_Reopen();
+			Floppy_Reopen();
+			Worker_Pause(false);
+			Log_Printf(LOG_WARN, "[Worker] Worker %d started (pid %d).\n", nWorkerIndex, (int)getpid());
+			return nWorkerIndex;
+		}
+		if (pid < 0)
+		{
+			Log_Printf(LOG_ERROR, "[Worker] Unable to fork worker %d: %s\n", nStarted + 1, strerror(errno));
+			nWorkersFailed += nWorkers - nStarted;
+			break;
+		}
+		pids[nStarted] = pid;
+	}
+
+	Log_Pause(false);
+	ConfigureParams.Memory.bAutoSave = false;
+	Log_Printf(LOG_WARN, "[Worker] Waiting for %d workers.\n", nStarted);
+
+	for (nRunning = nStarted; nRunning > 0; )
+	{
+		pid = wait(&status);
+		if (pid < 0)
+		{
+			if (errno == EINTR)
+				continue;
+			break;
+		}
+		for (i = 0; i < nStarted && pids[i] != pid; i++)
+			;
+		if (i == nStarted)
+			continue;
+		nRunning--;
+		if (WIFEXITED(status) && WEXITSTATUS(status) == 0)
+		{
+			Log_Printf(LOG_WARN, "[Worker] Worker %d finished.\n", i + 1);
+		}
+		else
+		{
+			nWorkersFailed++;
+			Log_Printf(LOG_WARN, "[Worker] Worker %d failed (status %d).\n", i + 1, status);
+		}
+	}
+	free(pids);
+	return 0;
+#else
+	Log_Printf(LOG_ERROR, "[Worker] Forking is not supported on this host.\n");
+	return -1;
+#endif
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Return the number of this worker, 0 if this is not a worker process.
+ */
+int Worker_GetIndex(void)
+{
+	return nWorkerIndex;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Return the exit status for the parent after all workers have exited.
+ */
+int Worker_ExitStatus(void)
+{
+	return nWorkersFailed ? 1 : 0;
+}